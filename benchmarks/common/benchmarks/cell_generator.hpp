@@ -0,0 +1,79 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Traccc include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace traccc::benchmarks {
+
+/// Generate a synthetic event of pixel cells
+///
+/// Mimics what @c extras/ccl_generator/ccl_generator.py does: every module
+/// receives a number of clusters, each grown as a random walk of 8-connected
+/// cells around a random centre. The cells are sorted the way the host
+/// clusterization algorithms expect them, i.e. by module, then by channel1,
+/// then by channel0.
+///
+/// @param[out] cells        The collection to fill
+/// @param[in] n_modules     The number of modules in the event
+/// @param[in] module_size   Number of channels along each side of a module
+/// @param[in] n_clusters    Number of clusters per module
+/// @param[in] cluster_size  Mean number of cells per cluster
+/// @param[in] seed          Seed of the random number generator
+///
+inline void generate_cells(edm::silicon_cell_collection::host& cells,
+                           unsigned int n_modules, unsigned int module_size,
+                           unsigned int n_clusters, double cluster_size,
+                           unsigned int seed = 42u) {
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<unsigned int> channel_dist(0u,
+                                                             module_size - 1u);
+    std::poisson_distribution<unsigned int> size_dist(cluster_size);
+    std::uniform_real_distribution<float> activation_dist(0.1f, 1.f);
+    std::uniform_int_distribution<int> step_dist(-1, 1);
+
+    cells.resize(0u);
+    std::set<std::tuple<channel_id, channel_id>> points;
+    std::vector<std::array<channel_id, 2>> module_cells;
+    for (unsigned int module = 0; module < n_modules; ++module) {
+
+        // Grow the clusters of the module.
+        points.clear();
+        for (unsigned int cluster = 0; cluster < n_clusters; ++cluster) {
+            std::array<int, 2> p{static_cast<int>(channel_dist(gen)),
+                                 static_cast<int>(channel_dist(gen))};
+            const unsigned int size = std::max(1u, size_dist(gen));
+            for (unsigned int i = 0; i < size; ++i) {
+                points.insert({static_cast<channel_id>(p[1]),
+                               static_cast<channel_id>(p[0])});
+                p[0] = std::clamp(p[0] + step_dist(gen), 0,
+                                  static_cast<int>(module_size) - 1);
+                p[1] = std::clamp(p[1] + step_dist(gen), 0,
+                                  static_cast<int>(module_size) - 1);
+            }
+        }
+
+        // Add them to the event, in (channel1, channel0) order.
+        for (const auto& [channel1, channel0] : points) {
+            cells.push_back({channel0, channel1, activation_dist(gen), 0.f,
+                             module});
+        }
+    }
+}
+
+}  // namespace traccc::benchmarks
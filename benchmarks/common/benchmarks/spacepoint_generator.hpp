@@ -0,0 +1,69 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Traccc include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+
+// System include(s).
+#include <array>
+#include <cmath>
+#include <random>
+
+namespace traccc::benchmarks {
+
+/// Generate a synthetic event of spacepoints for the seeding
+///
+/// Every track starts from a random point along the beam line, and leaves
+/// one (slightly smeared) spacepoint on each of a set of barrel layers
+/// inside of the default seeding region. The tracks are straight in the
+/// R-Z plane, and bend in the X-Y plane according to a random transverse
+/// momentum in a 2T field.
+///
+/// @param[out] spacepoints The collection to fill
+/// @param[in] n_tracks     The number of tracks in the event
+/// @param[in] seed         Seed of the random number generator
+///
+inline void generate_spacepoints(edm::spacepoint_collection::host& spacepoints,
+                                 unsigned int n_tracks,
+                                 unsigned int seed = 42u) {
+
+    /// Radii of the layers
+    static constexpr std::array<scalar, 5> radii{35.f, 70.f, 105.f, 140.f,
+                                                 175.f};
+
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<scalar> phi_dist(-3.1f, 3.1f);
+    std::uniform_real_distribution<scalar> cot_theta_dist(-6.f, 6.f);
+    std::normal_distribution<scalar> z0_dist(0.f, 50.f);
+    std::uniform_real_distribution<scalar> inv_pt_dist(-2.f, 2.f);
+    std::normal_distribution<scalar> smear_dist(0.f, 0.01f);
+
+    spacepoints.resize(0u);
+    spacepoints.reserve(n_tracks * radii.size());
+    for (unsigned int t = 0; t < n_tracks; ++t) {
+        const scalar phi0 = phi_dist(gen);
+        const scalar cot_theta = cot_theta_dist(gen);
+        const scalar z0 = z0_dist(gen);
+        // Curvature [1/mm] of a track with pT in [0.5, inf) GeV, in 2T.
+        const scalar curvature = inv_pt_dist(gen) * 0.0006f;
+        for (scalar r : radii) {
+            const scalar phi = phi0 + 0.5f * curvature * r + smear_dist(gen);
+            spacepoints.push_back(
+                {0u,
+                 edm::spacepoint_collection::host::INVALID_MEASUREMENT_INDEX,
+                 point3{r * std::cos(phi), r * std::sin(phi),
+                        z0 + r * cot_theta + smear_dist(gen)},
+                 0.01f,
+                 0.01f});
+        }
+    }
+}
+
+}  // namespace traccc::benchmarks
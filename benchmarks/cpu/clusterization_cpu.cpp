@@ -0,0 +1,80 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Traccc algorithm include(s).
+#include "traccc/clusterization/dbscan_algorithm.hpp"
+#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
+#include "traccc/clusterization/sparse_ccl_runs_algorithm.hpp"
+
+// Local include(s).
+#include "benchmarks/cell_generator.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/// Number of modules in the generated events
+constexpr unsigned int n_modules = 1000u;
+/// Number of channels along each side of a module
+constexpr unsigned int module_size = 336u;
+/// Mean number of cells per cluster
+constexpr double cluster_size = 4.;
+
+/// Run one of the host clusterization algorithms on a generated event
+///
+/// The benchmark's argument is the number of clusters per module.
+///
+template <typename ALGORITHM>
+void run_clusterization(benchmark::State& state, const ALGORITHM& alg,
+                        vecmem::memory_resource& mr) {
+
+    traccc::edm::silicon_cell_collection::host cells{mr};
+    traccc::benchmarks::generate_cells(
+        cells, n_modules, module_size,
+        static_cast<unsigned int>(state.range(0)), cluster_size);
+    const auto cells_data = vecmem::get_data(cells);
+
+    std::size_t n_clusters = 0;
+    for (auto _ : state) {
+        const auto clusters = alg(cells_data);
+        n_clusters = clusters.size();
+        benchmark::DoNotOptimize(n_clusters);
+    }
+
+    state.counters["cells"] = static_cast<double>(cells.size());
+    state.counters["clusters"] = static_cast<double>(n_clusters);
+    state.counters["cells_per_second"] = benchmark::Counter(
+        static_cast<double>(cells.size()),
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+static void BM_SparseCcl(benchmark::State& state) {
+    vecmem::host_memory_resource mr;
+    traccc::host::sparse_ccl_algorithm alg(mr);
+    run_clusterization(state, alg, mr);
+}
+BENCHMARK(BM_SparseCcl)->RangeMultiplier(4)->Range(4, 1024);
+
+static void BM_SparseCclRuns(benchmark::State& state) {
+    vecmem::host_memory_resource mr;
+    traccc::host::sparse_ccl_runs_algorithm alg(mr);
+    run_clusterization(state, alg, mr);
+}
+BENCHMARK(BM_SparseCclRuns)->RangeMultiplier(4)->Range(4, 1024);
+
+static void BM_Dbscan(benchmark::State& state) {
+    vecmem::host_memory_resource mr;
+    traccc::host::dbscan_algorithm alg(traccc::dbscan_config{}, mr);
+    run_clusterization(state, alg, mr);
+}
+BENCHMARK(BM_Dbscan)->RangeMultiplier(4)->Range(4, 1024);
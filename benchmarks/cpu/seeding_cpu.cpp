@@ -0,0 +1,130 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Traccc algorithm include(s).
+#include "traccc/seeding/detail/spacepoint_binning.hpp"
+#include "traccc/seeding/doublet_finding_batch_helper.hpp"
+#include "traccc/seeding/doublet_finding_helper.hpp"
+
+// Local include(s).
+#include "benchmarks/spacepoint_generator.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <vector>
+
+namespace {
+
+/// Run a doublet finding implementation on a generated event
+///
+/// The benchmark's argument is the number of tracks in the event. The
+/// functor is called for every middle spacepoint and every neighbour bin,
+/// and must return the number of (middle-bottom) doublets that it found.
+///
+template <typename FUNCTOR>
+void run_doublet_finding(benchmark::State& state, FUNCTOR&& find_doublets) {
+
+    vecmem::host_memory_resource mr;
+
+    // Generate and bin the spacepoints.
+    traccc::edm::spacepoint_collection::host spacepoints{mr};
+    traccc::benchmarks::generate_spacepoints(
+        spacepoints, static_cast<unsigned int>(state.range(0)));
+    const traccc::seedfinder_config config;
+    traccc::host::details::spacepoint_binning binning{
+        config, traccc::spacepoint_grid_config{config}, mr};
+    const traccc::details::flat_spacepoint_grid grid =
+        binning(vecmem::get_data(spacepoints));
+
+    std::size_t n_doublets = 0;
+    for (auto _ : state) {
+        n_doublets = 0;
+        for (unsigned int middle = 0; middle < grid.size(); ++middle) {
+            const traccc::details::binned_spacepoint middle_sp =
+                grid.at(middle);
+            for (detray::dindex phi_bin : grid.axis_p0().zone(
+                     middle_sp.phi(), config.neighbor_scope)) {
+                for (detray::dindex z_bin : grid.axis_p1().zone(
+                         middle_sp.z(), config.neighbor_scope)) {
+                    const unsigned int bin = static_cast<unsigned int>(
+                        phi_bin + z_bin * grid.axis_p0().bins());
+                    n_doublets += find_doublets(grid, config, middle,
+                                                grid.bin_begin(bin),
+                                                grid.bin_end(bin));
+                }
+            }
+        }
+        benchmark::DoNotOptimize(n_doublets);
+    }
+
+    state.counters["spacepoints"] = static_cast<double>(grid.size());
+    state.counters["doublets"] = static_cast<double>(n_doublets);
+    state.counters["middle_spacepoints_per_second"] = benchmark::Counter(
+        static_cast<double>(grid.size()),
+        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+static void BM_DoubletFindingScalar(benchmark::State& state) {
+    std::vector<traccc::lin_circle> lin_circles;
+    run_doublet_finding(
+        state, [&](const traccc::details::flat_spacepoint_grid& grid,
+                   const traccc::seedfinder_config& config,
+                   unsigned int middle, unsigned int begin, unsigned int end) {
+            const traccc::details::binned_spacepoint middle_sp =
+                grid.at(middle);
+            lin_circles.clear();
+            for (unsigned int i = begin; i < end; ++i) {
+                const traccc::details::binned_spacepoint other_sp = grid.at(i);
+                if (traccc::doublet_finding_helper::isCompatible<
+                        traccc::details::spacepoint_type::bottom>(
+                        middle_sp, other_sp, config)) {
+                    lin_circles.push_back(
+                        traccc::doublet_finding_helper::transform_coordinates<
+                            traccc::details::spacepoint_type::bottom>(
+                            middle_sp, other_sp));
+                }
+            }
+            return lin_circles.size();
+        });
+}
+BENCHMARK(BM_DoubletFindingScalar)->RangeMultiplier(4)->Range(256, 16384);
+
+static void BM_DoubletFindingBatch(benchmark::State& state) {
+    std::vector<unsigned char> compatible;
+    std::vector<unsigned int> candidates;
+    std::vector<traccc::lin_circle> lin_circles;
+    run_doublet_finding(
+        state, [&](const traccc::details::flat_spacepoint_grid& grid,
+                   const traccc::seedfinder_config& config,
+                   unsigned int middle, unsigned int begin, unsigned int end) {
+            const unsigned int n = end - begin;
+            compatible.resize(n);
+            traccc::doublet_finding_batch_helper::isCompatible<
+                traccc::details::spacepoint_type::bottom>(
+                grid, middle, begin, end, config, compatible.data());
+            candidates.resize(n);
+            unsigned int n_candidates = 0u;
+            for (unsigned int i = 0; i < n; ++i) {
+                candidates[n_candidates] = begin + i;
+                n_candidates += compatible[i];
+            }
+            lin_circles.resize(n_candidates);
+            traccc::doublet_finding_batch_helper::transform_coordinates<
+                traccc::details::spacepoint_type::bottom>(
+                grid, middle, candidates.data(), n_candidates,
+                lin_circles.data());
+            return lin_circles.size();
+        });
+}
+BENCHMARK(BM_DoubletFindingBatch)->RangeMultiplier(4)->Range(256, 16384);
@@ -8,9 +8,11 @@
 #pragma once
 
 // Library include(s).
+#include "traccc/clusterization/dbscan_algorithm.hpp"
+#include "traccc/clusterization/dbscan_config.hpp"
 #include "traccc/clusterization/measurement_creation_algorithm.hpp"
 #include "traccc/clusterization/sparse_ccl_algorithm.hpp"
-#include "traccc/clusterization/impl/dbscan_gower_algorithm.hpp"
+#include "traccc/clusterization/sparse_ccl_runs_algorithm.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/silicon_cell_collection.hpp"
 #include "traccc/geometry/silicon_detector_description.hpp"
@@ -22,7 +24,6 @@
 
 // System include(s).
 #include <functional>
-#include <variant>
 
 namespace traccc::host {
 
@@ -38,14 +39,26 @@ class clusterization_algorithm
       public messaging {
 
     public:
+    /// The clustering engines that the algorithm can use
     enum class ClusteringMode {
+        /// SparseCCL, with 8-cell connectivity
         CCL,
+        /// Run-based SparseCCL, producing the same clusters as @c CCL
+        CCL_RUNS,
+        /// DBSCAN, with a Gower distance between the cells
         DBSCAN_GOWER
     };
 
+    /// Configuration for the clusterization algorithm
     struct config_type {
+        /// The clustering engine to use
         ClusteringMode mode = ClusteringMode::CCL;
-        DBSCANGowerAlgorithm::Params dbscan_params = {0.3, 5}; // Example default values
+        /// Configuration of the DBSCAN engine
+        dbscan_config dbscan_params;
+        /// Process the detector modules in parallel, using TBB
+        bool parallel = false;
+        /// Maximum number of threads to use in parallel mode (0: automatic)
+        unsigned int max_threads = 0u;
     };
 
     /// Clusterization algorithm constructor
@@ -56,6 +69,15 @@ class clusterization_algorithm
         vecmem::memory_resource& mr,
         std::unique_ptr<const Logger> logger = getDummyLogger().clone());
 
+    /// Clusterization algorithm constructor
+    ///
+    /// @param config The configuration of the algorithm
+    /// @param mr The memory resource to use for the result objects
+    ///
+    clusterization_algorithm(
+        const config_type& config, vecmem::memory_resource& mr,
+        std::unique_ptr<const Logger> logger = getDummyLogger().clone());
+
     /// Construct measurements for each detector module
     ///
     /// @param cells_view The cells for every detector module in the event
@@ -67,14 +89,32 @@ class clusterization_algorithm
         const silicon_detector_description::const_view& dd_view) const override;
 
     private:
+    /// Construct measurements, processing the detector modules in parallel
+    ///
+    /// The clusters of every module are found (and turned into measurements)
+    /// independently, and are placed into the output using per-module
+    /// offsets. So the result is identical to that of the serial code.
+    ///
+    /// @param cells_view The cells for every detector module in the event
+    /// @param dd_view The detector description
+    /// @return The measurements reconstructed for every detector module
+    ///
+    output_type parallel_clusterization(
+        const edm::silicon_cell_collection::const_view& cells_view,
+        const silicon_detector_description::const_view& dd_view) const;
+
+    /// The configuration of the algorithm
     config_type m_config;
+
     /// @name Sub-algorithms used by this algorithm
     /// @{
 
     /// Per-module cluster creation algorithm
     sparse_ccl_algorithm m_cc;
-    /// Gower Distance And DB Scan
-    DBSCANGowerAlgorithm m_dbscanGower;
+    /// Per-module, run-based cluster creation algorithm
+    sparse_ccl_runs_algorithm m_cc_runs;
+    /// Per-module DBSCAN cluster creation algorithm
+    dbscan_algorithm m_dbscan;
     /// Per-module measurement creation algorithm
     measurement_creation_algorithm m_mc;
 
@@ -0,0 +1,68 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/dbscan_config.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/edm/silicon_cluster_collection.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/messaging.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc::host {
+
+/// Pixel cell clusterization based on DBSCAN with a Gower distance
+///
+/// The cells of every detector module are clustered independently. Region
+/// queries are answered from a per-module spatial grid in channel0/channel1,
+/// so the cost of the algorithm scales with the number of cells, and not
+/// with its square.
+///
+class dbscan_algorithm
+    : public algorithm<edm::silicon_cluster_collection::host(
+          const edm::silicon_cell_collection::const_view&)>,
+      public messaging {
+
+    public:
+    /// Constructor for the DBSCAN algorithm
+    ///
+    /// @param config The DBSCAN configuration
+    /// @param mr is the memory resource
+    ///
+    dbscan_algorithm(
+        const dbscan_config& config, vecmem::memory_resource& mr,
+        std::unique_ptr<const Logger> logger = getDummyLogger().clone());
+
+    /// @name Operator(s) to use in host code
+    /// @{
+
+    /// Callable operator for the clusterization
+    ///
+    /// @param cells_view Collection of input cells sorted by module
+    ///
+    /// @return a cluster container
+    ///
+    output_type operator()(const edm::silicon_cell_collection::const_view&
+                               cells_view) const override;
+
+    /// @}
+
+    private:
+    /// The DBSCAN configuration
+    dbscan_config m_config;
+    /// The memory resource used by the algorithm
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+};  // class dbscan_algorithm
+
+}  // namespace traccc::host
@@ -0,0 +1,45 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+
+namespace traccc {
+
+/// Configuration for the (host) DBSCAN clustering engine
+///
+/// Cells are compared using a Gower distance, i.e. the mean of the absolute
+/// feature differences, each normalised by a fixed range. Using fixed ranges
+/// (instead of ones derived from the data) keeps the neighbourhood of a cell
+/// bounded in channel space, which is what allows the engine to answer its
+/// region queries from a spatial grid.
+///
+struct dbscan_config {
+
+    /// Maximum Gower distance between two neighbouring cells
+    scalar epsilon = 0.25f;
+    /// Minimum number of cells (including itself) around a core cell
+    ///
+    /// With the default of 1 every cell is a core cell, and the engine
+    /// reduces to single-linkage clustering with an @c epsilon threshold.
+    ///
+    unsigned int min_pts = 1u;
+
+    /// Normalisation range of the channel0 feature
+    scalar channel0_range = 4.f;
+    /// Normalisation range of the channel1 feature
+    scalar channel1_range = 4.f;
+    /// Normalisation range of the activation feature (<= 0 disables it)
+    scalar activation_range = 0.f;
+    /// Normalisation range of the time feature (<= 0 disables it)
+    scalar time_range = 0.f;
+
+};  // struct dbscan_config
+
+}  // namespace traccc
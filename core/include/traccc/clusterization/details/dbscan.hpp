@@ -0,0 +1,106 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/clusterization/dbscan_config.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+// System include(s).
+#include <vector>
+
+namespace traccc::details {
+
+/// Scratch space of the DBSCAN engine
+///
+/// All per-cell arrays are stored in the order of the spatial grid built for
+/// the module being processed, so that region queries stream through
+/// contiguous memory. The object is meant to be re-used between modules (and
+/// events), to avoid re-allocating the arrays for every module.
+///
+struct dbscan_module_data {
+
+    /// @name Cell features, in grid order
+    /// @{
+
+    /// Raw channel0 values
+    std::vector<channel_id> channel0;
+    /// Raw channel1 values
+    std::vector<channel_id> channel1;
+    /// Normalised channel0 values
+    std::vector<scalar> feature0;
+    /// Normalised channel1 values
+    std::vector<scalar> feature1;
+    /// Normalised activation values
+    std::vector<scalar> feature2;
+    /// Normalised time values
+    std::vector<scalar> feature3;
+
+    /// @}
+
+    /// @name Spatial grid
+    /// @{
+
+    /// Offsets of the grid bins in the per-cell arrays
+    std::vector<unsigned int> bin_offsets;
+    /// Fill cursor of the grid bins, used while scattering the cells
+    std::vector<unsigned int> bin_cursor;
+    /// The index (within the module) of the cell at every grid position
+    std::vector<unsigned int> bin_cells;
+
+    /// @}
+
+    /// @name Clustering state
+    /// @{
+
+    /// Cluster labels of the cells, in grid order
+    std::vector<unsigned int> labels;
+    /// Result of the latest region query
+    std::vector<unsigned int> neighbours;
+    /// Cells waiting to be expanded into the current cluster
+    std::vector<unsigned int> queue;
+
+    /// @}
+
+};  // struct dbscan_module_data
+
+/// Run DBSCAN on the cells of a single detector module
+///
+/// @param[in] cells     All cells of the event, sorted by module
+/// @param[in] begin     Index of the first cell of the module
+/// @param[in] end       Index one past the last cell of the module
+/// @param[in] config    The DBSCAN configuration
+/// @param[inout] data   Scratch space for the engine
+/// @param[out] labels   Cluster index for every cell of the event
+/// @param[in] label_offset Index given to the first cluster of the module
+/// @return The number of clusters found in the module
+///
+inline unsigned int dbscan_module(
+    const edm::silicon_cell_collection::const_device& cells, unsigned int begin,
+    unsigned int end, const dbscan_config& config, dbscan_module_data& data,
+    vecmem::device_vector<unsigned int>& labels, unsigned int label_offset);
+
+/// Run DBSCAN on all cells of an event, one module at a time
+///
+/// @param[in] cells  All cells of the event, sorted by module
+/// @param[in] config The DBSCAN configuration
+/// @param[out] labels Cluster index for every cell of the event
+/// @return The number of clusters found in the event
+///
+inline unsigned int dbscan(
+    const edm::silicon_cell_collection::const_device& cells,
+    const dbscan_config& config, vecmem::device_vector<unsigned int>& labels);
+
+}  // namespace traccc::details
+
+// Include the implementation.
+#include "traccc/clusterization/impl/dbscan.ipp"
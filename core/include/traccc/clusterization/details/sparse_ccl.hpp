@@ -75,6 +75,21 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     const edm::silicon_cell_collection::const_device& cells,
     vecmem::device_vector<unsigned int>& labels);
 
+/// Sparce CCL algorithm, on a range of the cells
+///
+/// The range must not split the cells of a module.
+///
+/// @param cells is the cell collection
+/// @param begin is the index of the first cell to process
+/// @param end is the index one past the last cell to process
+/// @param labels is the vector of the output indices (to which cluster of the
+///               range a cell belongs to), for the cells in the range
+/// @return number of clusters in the range
+///
+TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
+    const edm::silicon_cell_collection::const_device& cells, unsigned int begin,
+    unsigned int end, vecmem::device_vector<unsigned int>& labels);
+
 }  // namespace traccc::details
 
 // Include the implementation.
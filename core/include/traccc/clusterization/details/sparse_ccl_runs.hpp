@@ -0,0 +1,69 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+// System include(s).
+#include <cstdint>
+#include <vector>
+
+namespace traccc::details {
+
+/// Scratch space of the run-based SparseCCL implementation
+///
+/// Meant to be re-used between modules (and events), to avoid re-allocating
+/// the arrays for every module.
+///
+struct ccl_run_data {
+
+    /// Flags marking the cells that start a new run
+    std::vector<std::uint8_t> run_starts;
+    /// Index of the first cell of every run
+    std::vector<unsigned int> first_cell;
+    /// The channel1 (row) value of every run
+    std::vector<channel_id> row;
+    /// The lowest channel0 value of every run
+    std::vector<channel_id> low;
+    /// The highest channel0 value of every run
+    std::vector<channel_id> high;
+    /// The union-find parent of every run
+    std::vector<unsigned int> parent;
+
+};  // struct ccl_run_data
+
+/// Run-based SparseCCL, on the cells of one detector module
+///
+/// Cells of the same channel1 row with consecutive channel0 values are
+/// packed into runs. Runs of neighbouring rows are merged with a linear
+/// sweep, using a union-find with path compression. The clusters (and their
+/// ordering) are the same as the ones produced by @c traccc::details::
+/// sparse_ccl.
+///
+/// Requires the cells to be sorted by channel1, and then by channel0.
+///
+/// @param[in] cells  All cells of the event
+/// @param[in] begin  Index of the first cell of the module
+/// @param[in] end    Index one past the last cell of the module
+/// @param[inout] data Scratch space for the algorithm
+/// @param[out] labels Cluster index (within the module) of every cell
+/// @return The number of clusters in the module
+///
+inline unsigned int sparse_ccl_runs(
+    const edm::silicon_cell_collection::const_device& cells, unsigned int begin,
+    unsigned int end, ccl_run_data& data,
+    vecmem::device_vector<unsigned int>& labels);
+
+}  // namespace traccc::details
+
+// Include the implementation.
+#include "traccc/clusterization/impl/sparse_ccl_runs.ipp"
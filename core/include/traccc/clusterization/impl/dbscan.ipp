@@ -0,0 +1,234 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace traccc::details {
+
+/// Label of cells that were not looked at yet
+static constexpr unsigned int dbscan_unclassified =
+    std::numeric_limits<unsigned int>::max();
+/// Label of cells that were (so far) found to be noise
+static constexpr unsigned int dbscan_noise = dbscan_unclassified - 1u;
+
+inline unsigned int dbscan_module(
+    const edm::silicon_cell_collection::const_device& cells, unsigned int begin,
+    unsigned int end, const dbscan_config& config, dbscan_module_data& data,
+    vecmem::device_vector<unsigned int>& labels, unsigned int label_offset) {
+
+    assert(begin < end);
+    assert(end <= cells.size());
+    assert(config.channel0_range > 0.f);
+    assert(config.channel1_range > 0.f);
+
+    const unsigned int n_cells = end - begin;
+
+    // Figure out which features take part in the distance calculation.
+    const bool use_activation = (config.activation_range > 0.f);
+    const bool use_time = (config.time_range > 0.f);
+    const scalar n_features = static_cast<scalar>(
+        2u + (use_activation ? 1u : 0u) + (use_time ? 1u : 0u));
+
+    // Two cells are neighbours if the sum of their normalised feature
+    // differences is below this value.
+    const scalar max_sum = config.epsilon * n_features;
+
+    // Since every term of the sum is non-negative, the channel differences
+    // of neighbouring cells are bounded by these windows.
+    const unsigned int window0 = static_cast<unsigned int>(
+        std::ceil(std::max(max_sum * config.channel0_range, scalar{0.f})));
+    const unsigned int window1 = static_cast<unsigned int>(
+        std::ceil(std::max(max_sum * config.channel1_range, scalar{0.f})));
+
+    // Find the extent of the module in channel space.
+    const auto& cells_channel0 = cells.channel0();
+    const auto& cells_channel1 = cells.channel1();
+    channel_id min0 = cells_channel0[begin], max0 = min0;
+    channel_id min1 = cells_channel1[begin], max1 = min1;
+    for (unsigned int i = begin + 1; i < end; ++i) {
+        min0 = std::min(min0, cells_channel0[i]);
+        max0 = std::max(max0, cells_channel0[i]);
+        min1 = std::min(min1, cells_channel1[i]);
+        max1 = std::max(max1, cells_channel1[i]);
+    }
+
+    // Set up the grid. The bins are at least as wide as the query window, but
+    // the number of bins per axis is capped, to keep the grid's memory usage
+    // proportional to the number of cells even for very sparse modules.
+    const unsigned int max_bins = std::max(
+        1u, static_cast<unsigned int>(std::sqrt(static_cast<float>(n_cells))));
+    const unsigned int span0 = max0 - min0;
+    const unsigned int span1 = max1 - min1;
+    const unsigned int n_bins0 =
+        std::min(span0 / (window0 + 1u) + 1u, max_bins);
+    const unsigned int n_bins1 =
+        std::min(span1 / (window1 + 1u) + 1u, max_bins);
+    const unsigned int bin_width0 = span0 / n_bins0 + 1u;
+    const unsigned int bin_width1 = span1 / n_bins1 + 1u;
+    const unsigned int n_bins = n_bins0 * n_bins1;
+
+    auto bin_index = [&](channel_id c0, channel_id c1) {
+        return ((c1 - min1) / bin_width1) * n_bins0 + (c0 - min0) / bin_width0;
+    };
+
+    // Counting pass.
+    data.bin_offsets.assign(n_bins + 1u, 0u);
+    for (unsigned int i = begin; i < end; ++i) {
+        ++data.bin_offsets[bin_index(cells_channel0[i], cells_channel1[i]) +
+                           1u];
+    }
+    // Prefix sum.
+    for (unsigned int b = 0; b < n_bins; ++b) {
+        data.bin_offsets[b + 1u] += data.bin_offsets[b];
+    }
+    assert(data.bin_offsets.back() == n_cells);
+
+    // Scatter the cells' features into grid order.
+    data.bin_cursor.assign(data.bin_offsets.begin(),
+                           data.bin_offsets.end() - 1);
+    data.channel0.resize(n_cells);
+    data.channel1.resize(n_cells);
+    data.feature0.resize(n_cells);
+    data.feature1.resize(n_cells);
+    data.feature2.resize(n_cells);
+    data.feature3.resize(n_cells);
+    data.bin_cells.resize(n_cells);
+    const scalar inv_range0 = 1.f / config.channel0_range;
+    const scalar inv_range1 = 1.f / config.channel1_range;
+    const scalar inv_range2 =
+        use_activation ? 1.f / config.activation_range : 0.f;
+    const scalar inv_range3 = use_time ? 1.f / config.time_range : 0.f;
+    for (unsigned int i = begin; i < end; ++i) {
+        const channel_id c0 = cells_channel0[i];
+        const channel_id c1 = cells_channel1[i];
+        const unsigned int pos = data.bin_cursor[bin_index(c0, c1)]++;
+        data.channel0[pos] = c0;
+        data.channel1[pos] = c1;
+        data.feature0[pos] = static_cast<scalar>(c0) * inv_range0;
+        data.feature1[pos] = static_cast<scalar>(c1) * inv_range1;
+        data.feature2[pos] = cells.activation()[i] * inv_range2;
+        data.feature3[pos] = cells.time()[i] * inv_range3;
+        data.bin_cells[pos] = i - begin;
+    }
+
+    // Collect all neighbours of the cell at grid position p (including
+    // itself) into data.neighbours.
+    auto region_query = [&](unsigned int p) {
+        data.neighbours.clear();
+        const channel_id c0 = data.channel0[p];
+        const channel_id c1 = data.channel1[p];
+        const unsigned int lo0 =
+            ((c0 > min0 + window0) ? (c0 - window0 - min0) : 0u) / bin_width0;
+        const unsigned int hi0 =
+            std::min(c0 - min0 + window0, span0) / bin_width0;
+        const unsigned int lo1 =
+            ((c1 > min1 + window1) ? (c1 - window1 - min1) : 0u) / bin_width1;
+        const unsigned int hi1 =
+            std::min(c1 - min1 + window1, span1) / bin_width1;
+        for (unsigned int b1 = lo1; b1 <= hi1; ++b1) {
+            // Bins of the same row are adjacent in memory.
+            const unsigned int row_begin =
+                data.bin_offsets[b1 * n_bins0 + lo0];
+            const unsigned int row_end =
+                data.bin_offsets[b1 * n_bins0 + hi0 + 1u];
+            for (unsigned int q = row_begin; q < row_end; ++q) {
+                const scalar sum =
+                    std::abs(data.feature0[q] - data.feature0[p]) +
+                    std::abs(data.feature1[q] - data.feature1[p]) +
+                    std::abs(data.feature2[q] - data.feature2[p]) +
+                    std::abs(data.feature3[q] - data.feature3[p]);
+                if (sum <= max_sum) {
+                    data.neighbours.push_back(q);
+                }
+            }
+        }
+    };
+
+    // The DBSCAN cluster expansion.
+    data.labels.assign(n_cells, dbscan_unclassified);
+    unsigned int n_clusters = 0;
+    for (unsigned int p = 0; p < n_cells; ++p) {
+
+        if (data.labels[p] != dbscan_unclassified) {
+            continue;
+        }
+        region_query(p);
+        if (data.neighbours.size() < config.min_pts) {
+            data.labels[p] = dbscan_noise;
+            continue;
+        }
+
+        // Start a new cluster from this core cell.
+        const unsigned int cluster = n_clusters++;
+        data.labels[p] = cluster;
+        data.queue.assign(data.neighbours.begin(), data.neighbours.end());
+        for (std::size_t head = 0; head < data.queue.size(); ++head) {
+            const unsigned int q = data.queue[head];
+            if (data.labels[q] == dbscan_noise) {
+                // Border cell, which does not get expanded any further.
+                data.labels[q] = cluster;
+                continue;
+            }
+            if (data.labels[q] != dbscan_unclassified) {
+                continue;
+            }
+            data.labels[q] = cluster;
+            region_query(q);
+            if (data.neighbours.size() >= config.min_pts) {
+                for (unsigned int r : data.neighbours) {
+                    if ((data.labels[r] == dbscan_unclassified) ||
+                        (data.labels[r] == dbscan_noise)) {
+                        data.queue.push_back(r);
+                    }
+                }
+            }
+        }
+    }
+
+    // Write out the labels. Noise cells become single-cell clusters, so that
+    // no cell gets lost on the way to measurement creation.
+    for (unsigned int p = 0; p < n_cells; ++p) {
+        if (data.labels[p] == dbscan_noise) {
+            data.labels[p] = n_clusters++;
+        }
+        labels[begin + data.bin_cells[p]] = label_offset + data.labels[p];
+    }
+
+    return n_clusters;
+}
+
+inline unsigned int dbscan(
+    const edm::silicon_cell_collection::const_device& cells,
+    const dbscan_config& config, vecmem::device_vector<unsigned int>& labels) {
+
+    dbscan_module_data data;
+    unsigned int n_clusters = 0;
+
+    // Process the cells one module at a time.
+    const unsigned int n_cells = cells.size();
+    const auto& module_index = cells.module_index();
+    unsigned int begin = 0;
+    while (begin < n_cells) {
+        unsigned int end = begin + 1;
+        while ((end < n_cells) && (module_index[end] == module_index[begin])) {
+            ++end;
+        }
+        n_clusters +=
+            dbscan_module(cells, begin, end, config, data, labels, n_clusters);
+        begin = end;
+    }
+
+    return n_clusters;
+}
+
+}  // namespace traccc::details
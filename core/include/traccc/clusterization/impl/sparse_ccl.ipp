@@ -117,14 +117,21 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     const edm::silicon_cell_collection::const_device& cells,
     vecmem::device_vector<unsigned int>& labels) {
 
-    unsigned int nlabels = 0;
+    return sparse_ccl(cells, 0u, cells.size(), labels);
+}
+
+TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
+    const edm::silicon_cell_collection::const_device& cells, unsigned int begin,
+    unsigned int end, vecmem::device_vector<unsigned int>& labels) {
+
+    assert(begin <= end);
+    assert(end <= cells.size());
 
-    // The number of cells.
-    const unsigned int n_cells = cells.size();
+    unsigned int nlabels = 0;
 
     // first scan: pixel association
-    unsigned int start_j = 0;
-    for (unsigned int i = 0; i < n_cells; ++i) {
+    unsigned int start_j = begin;
+    for (unsigned int i = begin; i < end; ++i) {
         labels[i] = i;
         unsigned int ai = i;
         for (unsigned int j = start_j; j < i; ++j) {
@@ -137,7 +144,7 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     }
 
     // second scan: transitive closure
-    for (unsigned int i = 0; i < n_cells; ++i) {
+    for (unsigned int i = begin; i < end; ++i) {
         if (labels[i] == i) {
             labels[i] = nlabels++;
         } else {
@@ -0,0 +1,131 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cassert>
+#include <numeric>
+
+namespace traccc::details {
+
+inline unsigned int sparse_ccl_runs(
+    const edm::silicon_cell_collection::const_device& cells, unsigned int begin,
+    unsigned int end, ccl_run_data& data,
+    vecmem::device_vector<unsigned int>& labels) {
+
+    assert(begin <= end);
+    assert(end <= cells.size());
+
+    const unsigned int n_cells = end - begin;
+    if (n_cells == 0u) {
+        return 0u;
+    }
+
+    const auto& channel0 = cells.channel0();
+    const auto& channel1 = cells.channel1();
+
+    // Flag the cells that start a new run. The iterations of this loop are
+    // independent of each other, and it has no branches, so that the
+    // compiler can vectorise it.
+    data.run_starts.resize(n_cells);
+    data.run_starts[0] = 1u;
+    for (unsigned int i = 1; i < n_cells; ++i) {
+        const unsigned int c = begin + i;
+        const unsigned int new_row = (channel1[c] != channel1[c - 1u]);
+        const unsigned int gap = (channel0[c] > channel0[c - 1u] + 1u);
+        data.run_starts[i] = static_cast<std::uint8_t>(new_row | gap);
+    }
+
+    // Pack the cells into runs.
+    data.first_cell.clear();
+    data.row.clear();
+    data.low.clear();
+    data.high.clear();
+    for (unsigned int i = 0; i < n_cells; ++i) {
+        const unsigned int c = begin + i;
+        if (data.run_starts[i] != 0u) {
+            data.first_cell.push_back(i);
+            data.row.push_back(channel1[c]);
+            data.low.push_back(channel0[c]);
+            data.high.push_back(channel0[c]);
+        } else {
+            data.high.back() = channel0[c];
+        }
+    }
+    const unsigned int n_runs = static_cast<unsigned int>(data.row.size());
+    data.first_cell.push_back(n_cells);
+
+    // Set up the union-find structure. The root of every tree is always its
+    // lowest index, just like in the cell-based SparseCCL.
+    data.parent.resize(n_runs);
+    std::iota(data.parent.begin(), data.parent.end(), 0u);
+    auto find_run_root = [&data](unsigned int r) {
+        while (data.parent[r] != r) {
+            // Path halving.
+            data.parent[r] = data.parent[data.parent[r]];
+            r = data.parent[r];
+        }
+        return r;
+    };
+    auto merge_runs = [&data, &find_run_root](unsigned int r1,
+                                              unsigned int r2) {
+        r1 = find_run_root(r1);
+        r2 = find_run_root(r2);
+        if (r1 < r2) {
+            data.parent[r2] = r1;
+        } else {
+            data.parent[r1] = r2;
+        }
+    };
+
+    // Merge the runs of neighbouring rows, sweeping through the runs of the
+    // current and the previous row in parallel.
+    unsigned int row_begin = 0, prev_begin = 0, prev_end = 0, prev = 0;
+    for (unsigned int r = 0; r < n_runs; ++r) {
+        if ((r == 0u) || (data.row[r] != data.row[r - 1u])) {
+            // A new row starts. Only consider the previous one if it is
+            // directly next to this one.
+            if ((r > 0u) && (data.row[r] == data.row[r - 1u] + 1u)) {
+                prev_begin = row_begin;
+                prev_end = r;
+            } else {
+                prev_begin = r;
+                prev_end = r;
+            }
+            row_begin = r;
+            prev = prev_begin;
+        }
+        // Skip the runs of the previous row that are completely to the left
+        // of this run. They are also to the left of all later runs.
+        while ((prev < prev_end) && (data.high[prev] + 1u < data.low[r])) {
+            ++prev;
+        }
+        // Merge with all (8-connected) overlapping runs.
+        for (unsigned int q = prev;
+             (q < prev_end) && (data.low[q] <= data.high[r] + 1u); ++q) {
+            merge_runs(r, q);
+        }
+    }
+
+    // Label the runs, and through them the cells. Roots always come before
+    // the other runs of their cluster.
+    unsigned int n_clusters = 0;
+    for (unsigned int r = 0; r < n_runs; ++r) {
+        const unsigned int root = find_run_root(r);
+        const unsigned int label =
+            (root == r) ? n_clusters++ : labels[begin + data.first_cell[root]];
+        for (unsigned int i = data.first_cell[r]; i < data.first_cell[r + 1u];
+             ++i) {
+            labels[begin + i] = label;
+        }
+    }
+
+    return n_clusters;
+}
+
+}  // namespace traccc::details
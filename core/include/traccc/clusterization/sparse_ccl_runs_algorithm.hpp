@@ -0,0 +1,64 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/edm/silicon_cluster_collection.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/messaging.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc::host {
+
+/// Pixel cell clusterization based on a run-length encoded SparseCCL
+///
+/// Produces the same clusters as @c traccc::host::sparse_ccl_algorithm, but
+/// instead of testing cell pairs one by one, it packs the cells of every
+/// module into runs of consecutive channel0 values, and merges the runs of
+/// neighbouring channel1 rows.
+///
+class sparse_ccl_runs_algorithm
+    : public algorithm<edm::silicon_cluster_collection::host(
+          const edm::silicon_cell_collection::const_view&)>,
+      public messaging {
+
+    public:
+    /// Constructor for the run-based SparseCCL algorithm
+    ///
+    /// @param mr is the memory resource
+    ///
+    sparse_ccl_runs_algorithm(
+        vecmem::memory_resource& mr,
+        std::unique_ptr<const Logger> logger = getDummyLogger().clone());
+
+    /// @name Operator(s) to use in host code
+    /// @{
+
+    /// Callable operator for the connected component labelling
+    ///
+    /// @param cells_view Collection of input cells sorted by module
+    ///
+    /// @return a cluster container
+    ///
+    output_type operator()(const edm::silicon_cell_collection::const_view&
+                               cells_view) const override;
+
+    /// @}
+
+    private:
+    /// The memory resource used by the algorithm
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+};  // class sparse_ccl_runs_algorithm
+
+}  // namespace traccc::host
@@ -0,0 +1,135 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/utils/pair.hpp"
+
+// Detray include(s).
+#include <detray/geometry/barcode.hpp>
+
+// System include(s).
+#include <cstddef>
+
+namespace traccc {
+
+/// The [begin, end) index range of the measurements of one surface
+using measurement_range = pair<unsigned int, unsigned int>;
+
+/// Declare all measurement range collection types
+///
+/// A collection of measurement ranges is used as a dense index over a
+/// measurement collection sorted by surface, with one element per detector
+/// surface, addressed with the surface index of the surfaces' barcodes.
+///
+using measurement_range_collection_types = collection_types<measurement_range>;
+
+/// Fill the measurement index for one measurement
+///
+/// Sets the beginning and / or the end of the range of the measurement's
+/// surface, if the measurement is the first and / or the last one on it. So
+/// calling it for every measurement, in any order, fills the index in a single
+/// pass over the measurements. The index must have been filled with empty
+/// ranges beforehand.
+///
+/// @param measurement_id The index of the measurement to process
+/// @param measurements   All measurements of an event, sorted by surface
+/// @param index          The measurement index to fill
+///
+TRACCC_HOST_DEVICE inline void fill_measurement_index(
+    const unsigned int measurement_id,
+    const measurement_collection_types::const_device& measurements,
+    measurement_range_collection_types::device& index) {
+
+    const detray::geometry::barcode bcd =
+        measurements.at(measurement_id).surface_link;
+    measurement_range& range = index.at(bcd.index());
+
+    if ((measurement_id == 0u) ||
+        (measurements.at(measurement_id - 1u).surface_link != bcd)) {
+        range.first = measurement_id;
+    }
+    if ((measurement_id + 1u == measurements.size()) ||
+        (measurements.at(measurement_id + 1u).surface_link != bcd)) {
+        range.second = measurement_id + 1u;
+    }
+}
+
+/// Functor giving the smallest measurement index size covering a measurement
+///
+/// The maximum of its results over all measurements of an event is the size
+/// of a measurement index that covers the event, for the code that does not
+/// know the number of surfaces in the detector.
+///
+struct measurement_index_size {
+    TRACCC_HOST_DEVICE
+    unsigned int operator()(const measurement& meas) const {
+        return static_cast<unsigned int>(meas.surface_link.index()) + 1u;
+    }
+};
+
+/// Get the range of the measurements of a surface from a measurement index
+///
+/// @param index The measurement index to use
+/// @param bcd   The barcode of the surface
+/// @return The [begin, end) range of the surface's measurements
+///
+TRACCC_HOST_DEVICE inline measurement_range get_measurement_range(
+    const measurement_range_collection_types::const_device& index,
+    const detray::geometry::barcode& bcd) {
+
+    if (bcd.index() >= index.size()) {
+        return {0u, 0u};
+    }
+    return index.at(bcd.index());
+}
+
+namespace host {
+
+/// Fill the measurement index of an event
+///
+/// Re-uses the memory of the received index, so that calling it for every
+/// event would only allocate memory when the detector grows.
+///
+/// @param measurements All measurements of an event, sorted by surface
+/// @param n_surfaces   The number of surfaces in the detector
+/// @param result       The index of the measurements' ranges, one per surface
+///
+inline void fill_measurement_index(
+    const measurement_collection_types::const_device& measurements,
+    const std::size_t n_surfaces,
+    measurement_range_collection_types::host& result) {
+
+    result.assign(n_surfaces, measurement_range{0u, 0u});
+    measurement_range_collection_types::device index{vecmem::get_data(result)};
+    for (unsigned int i = 0u; i < measurements.size(); ++i) {
+        traccc::fill_measurement_index(i, measurements, index);
+    }
+}
+
+/// Build the measurement index of an event
+///
+/// @param measurements All measurements of an event, sorted by surface
+/// @param n_surfaces   The number of surfaces in the detector
+/// @param mr           The memory resource to create the index with
+/// @return The index of the measurements' ranges, one per surface
+///
+inline measurement_range_collection_types::host make_measurement_index(
+    const measurement_collection_types::const_device& measurements,
+    const std::size_t n_surfaces, vecmem::memory_resource& mr) {
+
+    measurement_range_collection_types::host result(&mr);
+    fill_measurement_index(measurements, n_surfaces, result);
+    return result;
+}
+
+}  // namespace host
+}  // namespace traccc
@@ -22,6 +22,7 @@
 
 // System include(s).
 #include <functional>
+#include <memory>
 
 namespace traccc::host {
 
@@ -30,6 +31,10 @@ namespace traccc::host {
 /// This is the main host-based track finding algorithm of the project. More
 /// documentation to be written later...
 ///
+/// The temporary data of the track finding is kept in workspaces owned by the
+/// algorithm, one for every concurrently processed event, which are re-used
+/// from event to event.
+///
 class combinatorial_kalman_filter_algorithm
     : public algorithm<edm::track_candidate_collection<default_algebra>::host(
           const default_detector::host&,
@@ -55,6 +60,15 @@ class combinatorial_kalman_filter_algorithm
     explicit combinatorial_kalman_filter_algorithm(
         const config_type& config, vecmem::memory_resource& mr,
         std::unique_ptr<const Logger> logger = getDummyLogger().clone());
+    /// Move constructor
+    combinatorial_kalman_filter_algorithm(
+        combinatorial_kalman_filter_algorithm&&) noexcept;
+    /// Destructor
+    ~combinatorial_kalman_filter_algorithm();
+
+    /// Move assignment operator
+    combinatorial_kalman_filter_algorithm& operator=(
+        combinatorial_kalman_filter_algorithm&&) noexcept;
 
     /// Execute the algorithm
     ///
@@ -98,6 +112,11 @@ class combinatorial_kalman_filter_algorithm
     /// Memory resource
     std::reference_wrapper<vecmem::memory_resource> m_mr;
 
+    /// Pool of workspaces used by the track finding
+    struct workspace_pool;
+    /// The workspaces of the algorithm
+    std::unique_ptr<workspace_pool> m_workspaces;
+
 };  // class combinatorial_kalman_filter_algorithm
 
 }  // namespace traccc::host
@@ -8,13 +8,16 @@
 
 // Project include(s).
 #include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
 #include "traccc/edm/track_candidate_collection.hpp"
 #include "traccc/edm/track_state.hpp"
 #include "traccc/finding/actors/ckf_aborter.hpp"
 #include "traccc/finding/actors/interaction_register.hpp"
 #include "traccc/finding/candidate_link.hpp"
 #include "traccc/finding/details/combinatorial_kalman_filter_types.hpp"
+#include "traccc/finding/details/combinatorial_kalman_filter_workspace.hpp"
 #include "traccc/finding/finding_config.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_batch_updater.hpp"
 #include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
 #include "traccc/fitting/kalman_filter/is_line_visitor.hpp"
 #include "traccc/fitting/status_codes.hpp"
@@ -28,20 +31,42 @@
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
 
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
 // System include(s).
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 namespace traccc::host::details {
 
+/// Number of input parameters processed together by one task in the parallel
+/// track finding
+inline constexpr unsigned int ckf_parallel_chunk_size = 16u;
+
+/// Relative tolerance on @c traccc::finding_config::chi2_max when selecting
+/// the measurements to run the full Kalman update with
+inline constexpr float ckf_batch_chi2_tolerance = 1e-3f;
+
 /// Templated implementation of the track finding algorithm.
 ///
 /// Concrete track finding algorithms can use this function with the appropriate
 /// specializations, to find tracks on top of a specific detector type, magnetic
 /// field type, and track finding configuration.
 ///
+/// With @c traccc::finding_config::parallel set, the Kalman updates of the
+/// input parameters and the propagations of the links of every step are done
+/// in parallel, producing the same track candidates as the serial code.
+///
+/// All temporary data is kept in the received workspace, which is reset at
+/// the start of the function.
+///
 /// @tparam detector_t The (host) detector type to use
 /// @tparam bfield_t   The magnetic field type to use
 ///
@@ -51,6 +76,7 @@ namespace traccc::host::details {
 /// @param seeds_view        All seeds in an event to start the track finding
 ///                          with
 /// @param config            The track finding configuration
+/// @param ws                The workspace to use for the temporary data
 /// @param mr                The memory resource to use
 /// @param log               The logger object to use
 ///
@@ -62,8 +88,10 @@ combinatorial_kalman_filter(
     const detector_t& det, const bfield_t& field,
     const measurement_collection_types::const_view& measurements_view,
     const bound_track_parameters_collection_types::const_view& seeds_view,
-    const finding_config& config, vecmem::memory_resource& mr,
-    const Logger& log) {
+    const finding_config& config,
+    combinatorial_kalman_filter_workspace<typename detector_t::algebra_type>&
+        ws,
+    vecmem::memory_resource& mr, const Logger& log) {
 
     assert(config.min_step_length_for_next_surface >
                math::fabs(config.propagation.navigation.overstep_tolerance) &&
@@ -75,10 +103,22 @@ combinatorial_kalman_filter(
     using algebra_type = typename detector_t::algebra_type;
     /// The scalar type
     using scalar_type = detray::dscalar<algebra_type>;
+    /// The propagator type
+    using propagator_type =
+        traccc::details::ckf_propagator_t<detector_t, bfield_t>;
+    /// The bound track parameter type
+    using bound_params_type = bound_track_parameters<algebra_type>;
+    /// The branch finding storage type
+    using branch_buffer =
+        typename combinatorial_kalman_filter_workspace<algebra_type>::
+            branch_buffer;
 
     // Create a logger.
     auto logger = [&log]() -> const Logger& { return log; };
 
+    // Start from a clean workspace.
+    ws.reset();
+
     /*****************************************************************
      * Measurement Operations
      *****************************************************************/
@@ -89,60 +129,84 @@ combinatorial_kalman_filter(
     // Check contiguity of the measurements
     assert(is_contiguous_on(measurement_module_projection(), measurements));
 
-    // Get copy of barcode uniques
-    std::vector<measurement> uniques;
-    uniques.resize(measurements.size());
-
-    std::vector<measurement>::iterator uniques_end =
-        std::unique_copy(measurements.begin(), measurements.end(),
-                         uniques.begin(), measurement_equal_comp());
-    const auto n_modules =
-        static_cast<unsigned int>(uniques_end - uniques.begin());
-
-    // Get upper bounds of unique elements
-    std::vector<unsigned int> upper_bounds;
-    upper_bounds.reserve(n_modules);
-    for (unsigned int i = 0; i < n_modules; i++) {
-        measurement_collection_types::const_device::iterator up =
-            std::upper_bound(measurements.begin(), measurements.end(),
-                             uniques[i], measurement_sort_comp());
-        upper_bounds.push_back(
-            static_cast<unsigned int>(std::distance(measurements.begin(), up)));
-    }
     const measurement_collection_types::const_device::size_type n_meas =
         measurements.size();
 
-    // Get the number of measurements of each module
-    std::vector<unsigned int> sizes(n_modules);
-    std::adjacent_difference(upper_bounds.begin(), upper_bounds.end(),
-                             sizes.begin());
-
-    // Create barcode sequence
-    std::vector<detray::geometry::barcode> barcodes(n_modules);
-    std::transform(uniques.begin(), uniques_end, barcodes.begin(),
-                   [](const measurement& m) { return m.surface_link; });
-
-    std::vector<std::vector<candidate_link>> links;
-    links.resize(config.max_track_candidates_per_track);
-
-    std::vector<std::vector<std::size_t>> param_to_link;
-    param_to_link.resize(config.max_track_candidates_per_track);
+    // Index the measurements of every surface
+    fill_measurement_index(measurements, det.surfaces().size(),
+                           ws.measurement_index);
+    const measurement_range_collection_types::const_device
+        measurement_index_device{vecmem::get_data(ws.measurement_index)};
+
+    // Sort the measurements of every surface by their local0 position, if
+    // the chi2 is only to be evaluated in a window around the predictions.
+    // The window is only used on surfaces where local0 of the measurements
+    // is the first coordinate of their subspace.
+    if (config.use_measurement_window) {
+        ws.local0_order.resize(n_meas);
+        std::iota(ws.local0_order.begin(), ws.local0_order.end(), 0u);
+        ws.local0.resize(n_meas);
+        ws.max_local0_variance.assign(ws.measurement_index.size(), -1.f);
+        for (unsigned int sf_id = 0u; sf_id < ws.measurement_index.size();
+             ++sf_id) {
+            const measurement_range range = ws.measurement_index[sf_id];
+            bool usable = true;
+            scalar max_variance = 0.f;
+            for (unsigned int i = range.first; i < range.second; ++i) {
+                const measurement& meas = measurements[i];
+                usable = usable &&
+                         (meas.subs.get_indices()[0] == e_bound_loc0) &&
+                         std::isfinite(meas.local[0]) &&
+                         std::isfinite(meas.variance[0]);
+                max_variance = std::max(max_variance, meas.variance[0]);
+            }
+            if (!usable) {
+                continue;
+            }
+            std::sort(ws.local0_order.begin() + range.first,
+                      ws.local0_order.begin() + range.second,
+                      [&measurements](unsigned int a, unsigned int b) {
+                          return measurements[a].local[0] <
+                                 measurements[b].local[0];
+                      });
+            for (unsigned int i = range.first; i < range.second; ++i) {
+                ws.local0[i] = measurements[ws.local0_order[i]].local[0];
+            }
+            ws.max_local0_variance[sf_id] = max_variance;
+        }
+    }
 
-    std::vector<std::pair<unsigned int, unsigned int>> tips;
+    // Access the links of a given step
+    auto link_at = [&ws](unsigned int step,
+                         unsigned int link_id) -> const candidate_link& {
+        assert(ws.step_links_begin[step] + link_id < ws.links.size());
+        return ws.links[ws.step_links_begin[step] + link_id];
+    };
+    // Access the link that an input parameter of a given step was propagated
+    // from
+    auto link_of_param = [&ws, &link_at](unsigned int step,
+                                         unsigned int param_id)
+        -> const candidate_link& {
+        assert(ws.step_params_begin[step] + param_id <
+               ws.param_to_link.size());
+        return link_at(
+            step, ws.param_to_link[ws.step_params_begin[step] + param_id]);
+    };
 
     // Create propagator
-    traccc::details::ckf_propagator_t<detector_t, bfield_t> propagator(
-        config.propagation);
+    propagator_type propagator(config.propagation);
+
+    // The arena that the parallel loops are executed in, if requested.
+    tbb::task_arena arena(config.max_threads > 0u
+                              ? static_cast<int>(config.max_threads)
+                              : tbb::task_arena::automatic);
 
     // Create the input seeds container.
     bound_track_parameters_collection_types::const_device seeds{seeds_view};
 
     // Copy seed to input parameters
-    std::vector<bound_track_parameters<algebra_type>> in_params(seeds.size());
-    std::copy(seeds.begin(), seeds.end(), in_params.begin());
-    std::vector<unsigned int> n_trks_per_seed(seeds.size());
-
-    std::vector<bound_track_parameters<algebra_type>> out_params;
+    ws.in_params.assign(seeds.begin(), seeds.end());
+    ws.n_trks_per_seed.resize(seeds.size());
 
     for (unsigned int step = 0u; step < config.max_track_candidates_per_track;
          step++) {
@@ -152,40 +216,41 @@ combinatorial_kalman_filter(
                        << config.max_track_candidates_per_track);
 
         // Iterate over input parameters
-        const std::size_t n_in_params = in_params.size();
+        const std::size_t n_in_params = ws.in_params.size();
 
         // Terminate if there is no parameter to proceed
         if (n_in_params == 0) {
             break;
         }
 
-        // Rough estimation on out parameters size
-        out_params.reserve(n_in_params);
+        // The links and the input parameter to link mapping of this step
+        // start at the current ends of the collections
+        ws.step_links_begin.push_back(
+            static_cast<unsigned int>(ws.links.size()));
+        ws.step_params_begin.push_back(
+            static_cast<unsigned int>(ws.param_to_link.size()));
 
         // Previous step ID
-        std::fill(n_trks_per_seed.begin(), n_trks_per_seed.end(), 0u);
+        std::fill(ws.n_trks_per_seed.begin(), ws.n_trks_per_seed.end(), 0u);
 
         // Parameters updated by Kalman fitter
-        std::vector<bound_track_parameters<algebra_type>> updated_params;
-
-        for (unsigned int in_param_id = 0; in_param_id < n_in_params;
-             in_param_id++) {
+        ws.updated_params.clear();
 
-            bound_track_parameters<algebra_type>& in_param =
-                in_params[in_param_id];
+        // Find the branches of one input parameter, appending the links and
+        // the updated parameters to the received vectors.
+        auto find_branches = [&](unsigned int in_param_id, branch_buffer& tmp,
+                                 std::vector<candidate_link>& step_links,
+                                 std::vector<bound_params_type>& step_params) {
+            bound_params_type& in_param = ws.in_params[in_param_id];
 
             assert(!in_param.is_invalid());
 
             const unsigned int orig_param_id =
-                (step == 0
-                     ? in_param_id
-                     : links[step - 1][param_to_link[step - 1][in_param_id]]
-                           .seed_idx);
+                (step == 0 ? in_param_id
+                           : link_of_param(step - 1, in_param_id).seed_idx);
             const unsigned int skip_counter =
-                (step == 0
-                     ? 0
-                     : links[step - 1][param_to_link[step - 1][in_param_id]]
-                           .n_skipped);
+                (step == 0 ? 0
+                           : link_of_param(step - 1, in_param_id).n_skipped);
 
             TRACCC_VERBOSE("Processing input parameter "
                            << in_param_id + 1 << " / " << n_in_params << ": "
@@ -218,90 +283,139 @@ combinatorial_kalman_filter(
             // Get barcode and measurements range on surface
             const auto bcd = in_param.surface_link();
             assert(!bcd.is_invalid());
-            std::pair<unsigned int, unsigned int> range;
-
-            // Find the corresponding index of bcd in barcode vector
-
-            const auto lo2 =
-                std::lower_bound(barcodes.begin(), barcodes.end(), bcd);
-
-            const auto bcd_id = std::distance(barcodes.begin(), lo2);
-
-            if (lo2 == barcodes.begin()) {
-                range.first = 0u;
-                range.second = upper_bounds[static_cast<std::size_t>(bcd_id)];
-            } else if (lo2 == barcodes.end()) {
-                range.first = 0u;
-                range.second = 0u;
-            } else {
-                range.first =
-                    upper_bounds[static_cast<std::size_t>(bcd_id - 1)];
-                range.second = upper_bounds[static_cast<std::size_t>(bcd_id)];
-            }
+            const measurement_range range =
+                get_measurement_range(measurement_index_device, bcd);
 
             /*****************************************************************
              * Find tracks (CKF)
              *****************************************************************/
 
-            std::vector<std::tuple<candidate_link, track_state<algebra_type>>>
-                best_links;
-
-            // Iterate over the measurements
-            for (unsigned int item_id = range.first; item_id < range.second;
-                 item_id++) {
-
-                const auto& meas = measurements[item_id];
+            tmp.candidates.clear();
+
+            const bool is_line = sf.template visit_mask<is_line_visitor>();
+
+            // Restrict the measurements to a window in local0 around the
+            // prediction, if requested. For positive definite covariances
+            // chi2 >= r0^2 / (HCH^T + V)_00, so measurements outside of
+            // the window can not pass chi2_max. The window is widened a bit
+            // to be safe against rounding errors in the chi2.
+            measurement_range window = range;
+            bool use_window = false;
+            if (config.use_measurement_window && (range.first < range.second) &&
+                (ws.max_local0_variance[bcd.index()] >= 0.f)) {
+                // Measurements on line surfaces are compared to the absolute
+                // value of the predicted local0.
+                const scalar loc0 = in_param.bound_local()[0];
+                const scalar center = (is_line && loc0 < 0.f) ? -loc0 : loc0;
+                const scalar variance =
+                    getter::element(in_param.covariance(), e_bound_loc0,
+                                    e_bound_loc0) +
+                    ws.max_local0_variance[bcd.index()];
+                const scalar half_width =
+                    1.01f * math::sqrt(config.chi2_max * variance);
+                if (std::isfinite(center) && std::isfinite(half_width)) {
+                    const auto begin = ws.local0.begin() + range.first;
+                    const auto end = ws.local0.begin() + range.second;
+                    window.first = static_cast<unsigned int>(
+                        std::lower_bound(begin, end, center - half_width) -
+                        ws.local0.begin());
+                    window.second = static_cast<unsigned int>(
+                        std::upper_bound(begin, end, center + half_width) -
+                        ws.local0.begin());
+                    use_window = true;
+                }
+            }
 
-                track_state<algebra_type> trk_state(meas);
+            // Evaluate the chi2 of all measurements in the window with
+            // respect to the same predicted parameters
+            gain_matrix_batch_updater<algebra_type> batch_updater(in_param,
+                                                                  is_line);
+            const scalar max_batch_chi2 =
+                config.chi2_max * (1.f + ckf_batch_chi2_tolerance);
+            if (batch_updater.status() == kalman_fitter_status::SUCCESS) {
+                for (unsigned int pos = window.first; pos < window.second;
+                     pos++) {
+
+                    const unsigned int item_id =
+                        use_window ? ws.local0_order[pos] : pos;
+                    const traccc::scalar chi2 =
+                        batch_updater.chi2(measurements[item_id]);
+
+                    // Only the filtered chi2 of the full Kalman update is
+                    // compared to chi2_max. This chi2 is mathematically the
+                    // same, but may differ from it by rounding, so it is
+                    // only compared with some tolerance.
+                    if (chi2 >= 0.f && chi2 < max_batch_chi2) {
+                        tmp.candidates.push_back(
+                            {.step = step,
+                             .previous_candidate_idx = in_param_id,
+                             .meas_idx = item_id,
+                             .seed_idx = orig_param_id,
+                             .n_skipped = skip_counter,
+                             .chi2 = chi2});
+                    }
+                }
+            }
 
-                const bool is_line = sf.template visit_mask<is_line_visitor>();
+            // Order the links by chi2, preferring the earlier measurements in
+            // case of a tie
+            const unsigned int n_candidates =
+                static_cast<unsigned int>(tmp.candidates.size());
+            tmp.order.resize(n_candidates);
+            std::iota(tmp.order.begin(), tmp.order.end(), 0u);
+            auto by_chi2 = [&tmp](unsigned int a, unsigned int b) {
+                const candidate_link& link_a = tmp.candidates[a];
+                const candidate_link& link_b = tmp.candidates[b];
+                return (link_a.chi2 < link_b.chi2) ||
+                       ((link_a.chi2 == link_b.chi2) &&
+                        (link_a.meas_idx < link_b.meas_idx));
+            };
+
+            // Run the full Kalman update on the best links, until enough of
+            // them succeed. Only as many links are sorted as branches are
+            // still needed, and the sorted prefix is only extended if some
+            // of the updates fail.
+            unsigned int n_branches = 0u;
+            unsigned int n_sorted = 0u;
+            for (unsigned int i = 0; i < n_candidates; ++i) {
+                if (n_branches == config.max_num_branches_per_surface) {
+                    break;
+                }
+                if (i == n_sorted) {
+                    n_sorted = std::min(
+                        n_candidates,
+                        i + (config.max_num_branches_per_surface - n_branches));
+                    std::partial_sort(tmp.order.begin() + i,
+                                      tmp.order.begin() + n_sorted,
+                                      tmp.order.end(), by_chi2);
+                }
+                candidate_link link = tmp.candidates[tmp.order[i]];
 
-                // Run the Kalman update on a copy of the track parameters
+                track_state<algebra_type> trk_state(
+                    measurements[link.meas_idx]);
                 const kalman_fitter_status res =
                     gain_matrix_updater<algebra_type>{}(trk_state, in_param,
                                                         is_line);
-
-                const traccc::scalar chi2 = trk_state.filtered_chi2();
+                link.chi2 = trk_state.filtered_chi2();
 
                 // The chi2 from Kalman update should be less than chi2_max
-                if (res == kalman_fitter_status::SUCCESS &&
-                    chi2 < config.chi2_max) {
-
-                    best_links.push_back(
-                        {{.step = step,
-                          .previous_candidate_idx = in_param_id,
-                          .meas_idx = item_id,
-                          .seed_idx = orig_param_id,
-                          .n_skipped = skip_counter,
-                          .chi2 = chi2},
-                         trk_state});
+                if ((res != kalman_fitter_status::SUCCESS) ||
+                    !(link.chi2 < config.chi2_max)) {
+                    continue;
                 }
-            }
-
-            // Sort the links by chi2
-            std::sort(best_links.begin(), best_links.end(),
-                      [](const auto& a, const auto& b) {
-                          return std::get<0>(a).chi2 < std::get<0>(b).chi2;
-                      });
-            // Take the best links
-            const unsigned int n_branches =
-                std::min(config.max_num_branches_per_surface,
-                         static_cast<unsigned int>(best_links.size()));
-            TRACCC_VERBOSE("Found " << n_branches << " branches for step "
-                                    << step << " and input parameter "
-                                    << in_param_id);
-            for (unsigned int i = 0; i < n_branches; ++i) {
-                const auto& [link, trk_state] = best_links[i];
 
                 // Add the link to the links container
-                links[step].push_back(link);
+                step_links.push_back(link);
 
                 // Add the updated parameter to the updated parameters
-                updated_params.push_back(trk_state.filtered());
-                TRACCC_VERBOSE("updated_params["
-                               << updated_params.size() - 1
-                               << "] = " << updated_params.back());
+                step_params.push_back(trk_state.filtered());
+                TRACCC_VERBOSE("updated parameter for input parameter "
+                               << in_param_id << " = " << step_params.back());
+                ++n_branches;
             }
+            TRACCC_VERBOSE("Found " << n_branches << " branches for step "
+                                    << step << " and input parameter "
+                                    << in_param_id);
 
             /*****************************************************************
              * Add a dummy links in case of no branches
@@ -310,7 +424,7 @@ combinatorial_kalman_filter(
             if (n_branches == 0) {
 
                 // Put an invalid link with max item id
-                links[step].push_back(
+                step_links.push_back(
                     {.step = step,
                      .previous_candidate_idx = in_param_id,
                      .meas_idx = std::numeric_limits<unsigned int>::max(),
@@ -318,10 +432,57 @@ combinatorial_kalman_filter(
                      .n_skipped = skip_counter + 1,
                      .chi2 = std::numeric_limits<traccc::scalar>::max()});
 
-                updated_params.push_back(in_param);
-                TRACCC_VERBOSE("updated_params["
-                               << updated_params.size() - 1
-                               << "] = " << updated_params.back());
+                step_params.push_back(in_param);
+                TRACCC_VERBOSE("updated parameter for input parameter "
+                               << in_param_id << " = " << step_params.back());
+            }
+        };
+
+        if (config.parallel) {
+
+            // Process fixed chunks of the input parameters in parallel, and
+            // concatenate their results in order, so that the links would
+            // come out in the same order as with the serial code.
+            const unsigned int n_chunks = static_cast<unsigned int>(
+                (n_in_params + ckf_parallel_chunk_size - 1u) /
+                ckf_parallel_chunk_size);
+            if (ws.chunk_branches.size() < n_chunks) {
+                ws.chunk_branches.resize(n_chunks);
+            }
+            arena.execute([&]() {
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0u, n_chunks),
+                    [&](const tbb::blocked_range<unsigned int>& chunks) {
+                        for (unsigned int chunk = chunks.begin();
+                             chunk != chunks.end(); ++chunk) {
+                            branch_buffer& tmp = ws.chunk_branches[chunk];
+                            tmp.links.clear();
+                            tmp.params.clear();
+                            const unsigned int end = static_cast<unsigned int>(
+                                std::min<std::size_t>(
+                                    (chunk + 1u) * ckf_parallel_chunk_size,
+                                    n_in_params));
+                            for (unsigned int in_param_id =
+                                     chunk * ckf_parallel_chunk_size;
+                                 in_param_id < end; ++in_param_id) {
+                                find_branches(in_param_id, tmp, tmp.links,
+                                              tmp.params);
+                            }
+                        }
+                    });
+            });
+            for (unsigned int chunk = 0u; chunk < n_chunks; ++chunk) {
+                const branch_buffer& tmp = ws.chunk_branches[chunk];
+                ws.links.insert(ws.links.end(), tmp.links.begin(),
+                                tmp.links.end());
+                ws.updated_params.insert(ws.updated_params.end(),
+                                         tmp.params.begin(), tmp.params.end());
+            }
+        } else {
+            for (unsigned int in_param_id = 0; in_param_id < n_in_params;
+                 in_param_id++) {
+                find_branches(in_param_id, ws.branches, ws.links,
+                              ws.updated_params);
             }
         }
 
@@ -329,28 +490,13 @@ combinatorial_kalman_filter(
          * Propagate to the next surface
          *********************************/
 
-        const std::size_t n_links = links[step].size();
-        for (unsigned int link_id = 0; link_id < n_links; link_id++) {
-
-            const unsigned int seed_idx = links.at(step).at(link_id).seed_idx;
-            n_trks_per_seed[seed_idx]++;
-
-            if (n_trks_per_seed[seed_idx] > config.max_num_branches_per_seed) {
-                continue;
-            }
-
-            // If number of skips is larger than the maximum value, consider the
-            // link to be a tip
-            if (links.at(step).at(link_id).n_skipped >
-                config.max_num_skipping_per_cand) {
-                tips.push_back({step, link_id});
-                continue;
-            }
-
-            const auto& param = updated_params[link_id];
+        // Propagate one updated parameter to the next surface, returning
+        // whether a surface was found.
+        auto propagate = [&](propagator_type& prop,
+                             const bound_params_type& param,
+                             bound_params_type& next_param) {
             // Create propagator state
-            typename traccc::details::ckf_propagator_t<
-                detector_t, bfield_t>::state propagation(param, field, det);
+            typename propagator_type::state propagation(param, field, det);
             propagation.set_particle(detail::correct_particle_hypothesis(
                 config.ptc_hypothesis, param));
 
@@ -374,35 +520,122 @@ combinatorial_kalman_filter(
             }
 
             // Propagate to the next surface
-            propagator.propagate_sync(propagation,
-                                      detray::tie(s0, s1, s2, s3, s4));
+            prop.propagate_sync(propagation, detray::tie(s0, s1, s2, s3, s4));
 
-            // If a surface found, add the parameter for the next
-            // step
             if (s4.success) {
                 assert(propagation._navigation.is_on_sensitive());
                 assert(!propagation._stepping.bound_params().is_invalid());
+                next_param = propagation._stepping.bound_params();
+            }
+            return s4.success;
+        };
 
-                out_params.push_back(propagation._stepping.bound_params());
-                param_to_link[step].push_back(link_id);
+        // Record the result of the propagation of one link.
+        auto record = [&](unsigned int link_id, bool success,
+                          const bound_params_type& next_param) {
+            // If a surface found, add the parameter for the next
+            // step
+            if (success) {
+                ws.out_params.push_back(next_param);
+                ws.param_to_link.push_back(link_id);
             }
             // Unless the track found a surface, it is considered a
             // tip
-            else if (!s4.success &&
+            else if (!success &&
                      (step >= (config.min_track_candidates_per_track - 1u))) {
-                tips.push_back({step, link_id});
+                ws.tips.push_back({step, link_id});
             }
 
             // If no more CKF step is expected, current candidate is
             // kept as a tip
-            if (s4.success &&
+            if (success &&
                 (step == (config.max_track_candidates_per_track - 1u))) {
-                tips.push_back({step, link_id});
+                ws.tips.push_back({step, link_id});
+            }
+        };
+
+        // Decide what to do with one link: skip it, consider it to be a tip
+        // or propagate it.
+        auto select = [&](unsigned int link_id) {
+            const candidate_link& link = link_at(step, link_id);
+            const unsigned int seed_idx = link.seed_idx;
+            ws.n_trks_per_seed[seed_idx]++;
+
+            if (ws.n_trks_per_seed[seed_idx] >
+                config.max_num_branches_per_seed) {
+                return ckf_link_action::skip;
+            }
+
+            // If number of skips is larger than the maximum value, consider the
+            // link to be a tip
+            if (link.n_skipped > config.max_num_skipping_per_cand) {
+                return ckf_link_action::tip;
+            }
+            return ckf_link_action::propagate;
+        };
+
+        const unsigned int n_links = static_cast<unsigned int>(
+            ws.links.size() - ws.step_links_begin[step]);
+        if (config.parallel) {
+
+            // Select the links to propagate in order, since the per-seed
+            // branch counting depends on it.
+            ws.link_actions.resize(n_links);
+            ws.to_propagate.clear();
+            for (unsigned int link_id = 0; link_id < n_links; link_id++) {
+                ws.link_actions[link_id] = select(link_id);
+                if (ws.link_actions[link_id] == ckf_link_action::propagate) {
+                    ws.to_propagate.push_back(link_id);
+                }
+            }
+
+            // Propagate the selected links in parallel. Every task uses its
+            // own propagator, like the device algorithms do.
+            const std::size_t n_propagate = ws.to_propagate.size();
+            ws.next_params.resize(n_propagate);
+            ws.propagated.assign(n_propagate, 0);
+            arena.execute([&]() {
+                tbb::parallel_for(
+                    tbb::blocked_range<std::size_t>(0u, n_propagate),
+                    [&](const tbb::blocked_range<std::size_t>& r) {
+                        propagator_type prop(config.propagation);
+                        for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                            ws.propagated[i] = propagate(
+                                prop, ws.updated_params[ws.to_propagate[i]],
+                                ws.next_params[i]);
+                        }
+                    });
+            });
+
+            // Record the results in the order of the links.
+            std::size_t i = 0u;
+            for (unsigned int link_id = 0; link_id < n_links; link_id++) {
+                if (ws.link_actions[link_id] == ckf_link_action::tip) {
+                    ws.tips.push_back({step, link_id});
+                } else if (ws.link_actions[link_id] ==
+                           ckf_link_action::propagate) {
+                    record(link_id, ws.propagated[i], ws.next_params[i]);
+                    ++i;
+                }
+            }
+        } else {
+            bound_params_type next_param;
+            for (unsigned int link_id = 0; link_id < n_links; link_id++) {
+                const ckf_link_action action = select(link_id);
+                if (action == ckf_link_action::tip) {
+                    ws.tips.push_back({step, link_id});
+                } else if (action == ckf_link_action::propagate) {
+                    const bool success = propagate(
+                        propagator, ws.updated_params[link_id], next_param);
+                    record(link_id, success, next_param);
+                }
             }
         }
 
-        in_params = std::move(out_params);
-        out_params.clear();
+        // The parameters found on the next surfaces are the input of the
+        // next step. Swapping keeps the memory of both collections.
+        std::swap(ws.in_params, ws.out_params);
+        ws.out_params.clear();
     }
 
     /**********************
@@ -412,11 +645,11 @@ combinatorial_kalman_filter(
     // Number of found tracks = number of tips
     typename edm::track_candidate_collection<algebra_type>::host
         output_candidates{mr};
-    output_candidates.reserve(tips.size());
+    output_candidates.reserve(ws.tips.size());
 
-    for (const auto& tip : tips) {
+    for (const auto& tip : ws.tips) {
         // Get the link corresponding to tip
-        auto L = links.at(tip.first).at(tip.second);
+        candidate_link L = link_at(tip.first, tip.second);
 
         const unsigned int n_cands = tip.first + 1 - L.n_skipped;
 
@@ -426,10 +659,7 @@ combinatorial_kalman_filter(
             continue;
         }
 
-        // Retrieve tip
-        L = links.at(tip.first).at(tip.second);
-
-        vecmem::vector<unsigned int> cands_per_track;
+        vecmem::vector<unsigned int>& cands_per_track = ws.cands_per_track;
         cands_per_track.resize(n_cands);
 
         // Track summary variables
@@ -441,10 +671,7 @@ combinatorial_kalman_filter(
              it++) {
 
             while (L.meas_idx >= n_meas && L.step != 0u) {
-                const auto link_pos =
-                    param_to_link.at(L.step - 1u).at(L.previous_candidate_idx);
-
-                L = links.at(L.step - 1u).at(link_pos);
+                L = link_of_param(L.step - 1u, L.previous_candidate_idx);
             }
 
             // Break if the measurement is still invalid
@@ -473,10 +700,7 @@ combinatorial_kalman_filter(
                 output_candidates.push_back({cand_seed, ndf_sum, chi2_sum, pval,
                                              L.n_skipped, cands_per_track});
             } else {
-                const auto l_pos =
-                    param_to_link.at(L.step - 1u).at(L.previous_candidate_idx);
-
-                L = links.at(L.step - 1u).at(l_pos);
+                L = link_of_param(L.step - 1u, L.previous_candidate_idx);
             }
         }
     }
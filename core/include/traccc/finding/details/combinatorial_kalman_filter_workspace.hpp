@@ -0,0 +1,143 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/measurement_index.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/finding/candidate_link.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <utility>
+#include <vector>
+
+namespace traccc::host::details {
+
+/// What to do with a link after the Kalman updates of a track finding step
+enum class ckf_link_action : unsigned char {
+    /// The seed of the link has too many branches already
+    skip = 0,
+    /// The link ends a track candidate
+    tip = 1,
+    /// The link needs to be propagated to the next surface
+    propagate = 2
+};
+
+/// Reusable storage of the host track finding
+///
+/// Holds all temporary collections used by
+/// @c traccc::host::details::combinatorial_kalman_filter. They are cleared,
+/// but keep their memory, at the start of every event. So that once they
+/// grew large enough, processing an event would not need to allocate memory
+/// besides for its result.
+///
+/// A workspace must only be used for one event at a time.
+///
+/// @tparam algebra_t The algebra type of the track finding
+///
+template <typename algebra_t>
+struct combinatorial_kalman_filter_workspace {
+
+    /// The bound track parameter type
+    using bound_params_type = bound_track_parameters<algebra_t>;
+
+    /// Storage used while finding the branches of input parameters
+    struct branch_buffer {
+        /// The chi2-passing candidate links of one input parameter
+        std::vector<candidate_link> candidates;
+        /// The indices of the candidate links, (partially) sorted by chi2
+        std::vector<unsigned int> order;
+        /// The links found for (a chunk of) input parameters
+        std::vector<candidate_link> links;
+        /// The updated parameters of the links
+        std::vector<bound_params_type> params;
+    };
+
+    /// Constructor
+    ///
+    /// @param mr The memory resource to use for the vecmem collections
+    ///
+    explicit combinatorial_kalman_filter_workspace(vecmem::memory_resource& mr)
+        : measurement_index(&mr), cands_per_track(&mr) {}
+
+    /// Clear all collections, keeping their memory
+    void reset() {
+        local0_order.clear();
+        local0.clear();
+        max_local0_variance.clear();
+        links.clear();
+        step_links_begin.clear();
+        param_to_link.clear();
+        step_params_begin.clear();
+        tips.clear();
+        in_params.clear();
+        out_params.clear();
+        updated_params.clear();
+        n_trks_per_seed.clear();
+        link_actions.clear();
+        to_propagate.clear();
+        next_params.clear();
+        propagated.clear();
+    }
+
+    /// The measurement index of the event
+    measurement_range_collection_types::host measurement_index;
+    /// The indices of the measurements, sorted by their local0 position on
+    /// every surface (only filled with a measurement window)
+    std::vector<unsigned int> local0_order;
+    /// The local0 positions of the measurements in @c local0_order
+    std::vector<scalar> local0;
+    /// The largest local0 variance of the measurements on every surface,
+    /// negative if the measurement window can not be used on the surface
+    std::vector<scalar> max_local0_variance;
+
+    /// The links of all steps, one step after the other
+    std::vector<candidate_link> links;
+    /// The index of the first link of every step in @c links
+    std::vector<unsigned int> step_links_begin;
+    /// The index of the link that every input parameter was propagated from,
+    /// relative to the first link of its step, for all steps
+    std::vector<unsigned int> param_to_link;
+    /// The index of the first element of every step in @c param_to_link
+    std::vector<unsigned int> step_params_begin;
+    /// The (step, link index) pairs of the links ending track candidates
+    std::vector<std::pair<unsigned int, unsigned int>> tips;
+
+    /// The input parameters of the current step
+    std::vector<bound_params_type> in_params;
+    /// The input parameters of the next step
+    std::vector<bound_params_type> out_params;
+    /// The updated parameters of the links of the current step
+    std::vector<bound_params_type> updated_params;
+    /// The number of branches of every seed in the current step
+    std::vector<unsigned int> n_trks_per_seed;
+
+    /// Branch finding storage of the serial track finding
+    branch_buffer branches;
+    /// Branch finding storage of the chunks of the parallel track finding
+    std::vector<branch_buffer> chunk_branches;
+
+    /// What to do with the links of the current step
+    std::vector<ckf_link_action> link_actions;
+    /// The links of the current step to propagate
+    std::vector<unsigned int> to_propagate;
+    /// The propagated parameters of the links
+    std::vector<bound_params_type> next_params;
+    /// Whether the propagation of the links found a surface
+    std::vector<char> propagated;
+
+    /// The measurement indices of the track candidate being built
+    vecmem::vector<unsigned int> cands_per_track;
+};
+
+}  // namespace traccc::host::details
@@ -67,6 +67,21 @@ struct finding_config {
     ///
     /// @note This parameter affects GPU-based track finding only.
     unsigned int initial_links_per_seed = 100;
+    /// Process the input parameters and the links of every step in parallel
+    /// in the host track finding, using TBB
+    ///
+    /// @note This parameter affects CPU-based track finding only.
+    bool parallel = false;
+    /// Maximum number of threads to use in parallel mode (0: automatic)
+    ///
+    /// @note This parameter affects CPU-based track finding only.
+    unsigned int max_threads = 0u;
+    /// Evaluate the chi2 only for the measurements of a surface that lie in
+    /// a window around the predicted local position, which is wide enough
+    /// not to lose any measurement passing @c chi2_max
+    ///
+    /// @note This parameter affects CPU-based track finding only.
+    bool use_measurement_window = false;
     /// @}
 
     /// Set the momentum limit to @param p
@@ -0,0 +1,186 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/math.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/fitting/status_codes.hpp"
+
+// System include(s).
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+namespace traccc {
+
+/// Kalman update of one set of predicted track parameters with many
+/// measurements
+///
+/// Evaluates the chi2 of the measurements on a surface with respect to the
+/// same predicted track parameters, computing the projection of the predicted
+/// parameters and covariance onto the measurement space only once for all
+/// measurements with the same subspace and dimension.
+///
+/// The chi2 is calculated from the predicted residual,
+/// @f$ r^T (H C H^T + V)^{-1} r @f$, which is algebraically identical to the
+/// filtered chi2 of @c traccc::gain_matrix_updater, so the two agree up to
+/// floating point rounding. The filtered parameters of the selected
+/// measurements can then be calculated with @c traccc::gain_matrix_updater.
+///
+/// @tparam algebra_t The algebra type to use
+///
+template <typename algebra_t>
+struct gain_matrix_batch_updater {
+
+    // Type declarations
+    using size_type = detray::dsize_type<algebra_t>;
+    template <size_type ROWS, size_type COLS>
+    using matrix_type = detray::dmatrix<algebra_t, ROWS, COLS>;
+    using scalar_type = detray::dscalar<algebra_t>;
+    using axes_type = std::decay_t<decltype(measurement{}.subs.get_indices())>;
+
+    /// Constructor
+    ///
+    /// @param predicted The predicted track parameters on the surface
+    /// @param is_line   Whether the surface is a line surface
+    ///
+    TRACCC_HOST_DEVICE
+    gain_matrix_batch_updater(
+        const bound_track_parameters<algebra_t>& predicted, const bool is_line)
+        : m_predicted(predicted), m_is_line(is_line) {
+
+        assert(!predicted.is_invalid());
+        assert(!predicted.surface_link().is_invalid());
+
+        // Return an error if the track is parallel to the z-axis, or phi is
+        // not finite, the same way as the single measurement update.
+        const scalar_type theta = predicted.theta();
+        if (theta <= 0.f || theta >= constant<traccc::scalar>::pi) {
+            m_status = kalman_fitter_status::ERROR_THETA_ZERO;
+        } else if (!std::isfinite(predicted.phi())) {
+            m_status = kalman_fitter_status::ERROR_INVERSION;
+        } else if (std::abs(predicted.qop()) == 0.f) {
+            m_status = kalman_fitter_status::ERROR_QOP_ZERO;
+        }
+    }
+
+    /// Status of the update, based only on the predicted parameters
+    ///
+    /// Measurements can only be added to the predicted parameters if this is
+    /// @c traccc::kalman_fitter_status::SUCCESS.
+    ///
+    TRACCC_HOST_DEVICE
+    kalman_fitter_status status() const { return m_status; }
+
+    /// Calculate the chi2 of one measurement
+    ///
+    /// The result is negative or not finite if the update with the
+    /// measurement fails.
+    ///
+    /// @param meas The measurement to evaluate
+    /// @return The chi2 of the measurement
+    ///
+    [[nodiscard]] TRACCC_HOST_DEVICE scalar_type chi2(const measurement& meas) {
+
+        const unsigned int dim = meas.meas_dim;
+        assert(dim == 1u || dim == 2u);
+
+        // Update the projection, if needed.
+        const axes_type& axes = meas.subs.get_indices();
+        if (!m_has_projection || (axes[0] != m_axes[0]) ||
+            (axes[1] != m_axes[1]) || (dim != m_dim)) {
+            project(meas, dim);
+        }
+
+        // The measurement and its covariance in the measurement space, the
+        // same way as @c traccc::track_state provides them.
+        assert((axes[0] == e_bound_loc0) || (axes[0] == e_bound_loc1));
+        const bool swap = (axes[0] == e_bound_loc1);
+        const scalar_type m0 = swap ? meas.local[1] : meas.local[0];
+        const scalar_type m1 = swap ? meas.local[0] : meas.local[1];
+        const scalar_type v0 = swap ? meas.variance[1] : meas.variance[0];
+        const scalar_type v1 =
+            (dim == 1u) ? 1.f : (swap ? meas.variance[0] : meas.variance[1]);
+        assert((dim > 1u) || (m1 == 0.f));
+
+        // The predicted residual and its covariance.
+        const scalar_type r0 = m0 - m_Hx[0];
+        const scalar_type r1 = m1 - m_Hx[1];
+        const scalar_type M00 = m_HCHt[0] + v0;
+        const scalar_type M01 = m_HCHt[1];
+        const scalar_type M10 = m_HCHt[2];
+        const scalar_type M11 = m_HCHt[3] + v1;
+        const scalar_type det = M00 * M11 - M01 * M10;
+        assert(det != 0.f);
+
+        return (M11 * r0 * r0 - (M01 + M10) * r0 * r1 + M00 * r1 * r1) / det;
+    }
+
+    private:
+    /// Project the predicted parameters onto the space of a measurement
+    ///
+    /// @param meas A measurement defining the projection
+    /// @param dim  The dimension of the measurement
+    ///
+    TRACCC_HOST_DEVICE void project(const measurement& meas,
+                                    const unsigned int dim) {
+
+        static constexpr unsigned int D = 2;
+
+        const bound_vector<algebra_t>& predicted_vec = m_predicted.vector();
+        const bound_matrix<algebra_t>& predicted_cov =
+            m_predicted.covariance();
+
+        // Build the projector the same way as the single measurement update.
+        matrix_type<D, e_bound_size> H = meas.subs.template projector<D>();
+        if (m_is_line && getter::element(predicted_vec, e_bound_loc0, 0u) < 0) {
+            getter::element(H, 0u, e_bound_loc0) = -1;
+        }
+        if (dim == 1) {
+            getter::element(H, 1u, 0u) = 0.f;
+            getter::element(H, 1u, 1u) = 0.f;
+        }
+
+        const matrix_type<D, 1> Hx = H * predicted_vec;
+        const matrix_type<D, D> HCHt =
+            H * predicted_cov * matrix::transpose(H);
+
+        m_Hx = {getter::element(Hx, 0u, 0u), getter::element(Hx, 1u, 0u)};
+        m_HCHt = {getter::element(HCHt, 0u, 0u), getter::element(HCHt, 0u, 1u),
+                  getter::element(HCHt, 1u, 0u),
+                  getter::element(HCHt, 1u, 1u)};
+        m_axes = meas.subs.get_indices();
+        m_dim = dim;
+        m_has_projection = true;
+    }
+
+    /// The predicted track parameters
+    const bound_track_parameters<algebra_t>& m_predicted;
+    /// Whether the surface is a line surface
+    bool m_is_line;
+    /// Status of the update
+    kalman_fitter_status m_status = kalman_fitter_status::SUCCESS;
+
+    /// Whether a projection was calculated already
+    bool m_has_projection = false;
+    /// The subspace axes of the current projection
+    axes_type m_axes{};
+    /// The measurement dimension of the current projection
+    unsigned int m_dim = 0u;
+    /// The projected predicted parameters
+    std::array<scalar_type, 2u> m_Hx{};
+    /// The projected predicted covariance, in row-major order
+    std::array<scalar_type, 4u> m_HCHt{};
+};
+
+}  // namespace traccc
@@ -0,0 +1,359 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+#include "traccc/seeding/detail/singlet.hpp"
+#include "traccc/seeding/detail/spacepoint_grid.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <span>
+
+namespace traccc::details {
+
+class flat_spacepoint_grid;
+
+/// Lightweight view of one spacepoint stored in a @c flat_spacepoint_grid
+///
+/// It provides the same (const) coordinate accessors as the spacepoint
+/// proxies of @c traccc::edm::spacepoint_collection, but reads pre-computed
+/// values, so that the seeding helpers could be used with either of them.
+///
+class binned_spacepoint {
+
+    public:
+    /// Constructor
+    ///
+    /// @param grid The grid holding the spacepoint
+    /// @param index The flat (bin ordered) index of the spacepoint in the grid
+    ///
+    binned_spacepoint(const flat_spacepoint_grid& grid, unsigned int index)
+        : m_grid{&grid}, m_index{index} {}
+
+    /// The X position of the spacepoint
+    scalar x() const;
+    /// The Y position of the spacepoint
+    scalar y() const;
+    /// The Z position of the spacepoint
+    scalar z() const;
+    /// The radius of the spacepoint in the XY plane
+    scalar radius() const;
+    /// The azimuthal angle of the spacepoint in the XY plane
+    scalar phi() const;
+    /// The variation on the spacepoint's Z coordinate
+    scalar z_variance() const;
+    /// The variation on the spacepoint radius
+    scalar radius_variance() const;
+
+    private:
+    /// The grid holding the spacepoint
+    const flat_spacepoint_grid* m_grid;
+    /// The flat index of the spacepoint in the grid
+    unsigned int m_index;
+
+};  // class binned_spacepoint
+
+/// Phi-Z spacepoint grid with a flat, contiguous storage
+///
+/// Used by the host seeding instead of @c spacepoint_grid_types::host. The
+/// spacepoints of all bins are stored in a single array in "compressed sparse
+/// row" layout, i.e. bin by bin, with an offset table giving where each bin
+/// starts. Next to the indices of the spacepoints in the original collection,
+/// the coordinates used by the seeding are also stored in this bin order,
+/// so that scanning the spacepoints of (neighbouring) bins would read memory
+/// linearly.
+///
+/// Spacepoints are still addressed by @c traccc::sp_location, with
+/// @c sp_idx being the position of the spacepoint inside of its bin.
+///
+class flat_spacepoint_grid {
+
+    public:
+    /// Phi axis type
+    using axis_p0_type = spacepoint_grid_types::host::axis_p0_type;
+    /// Z axis type
+    using axis_p1_type = spacepoint_grid_types::host::axis_p1_type;
+
+    /// Bin index marking spacepoints that should not be put into the grid
+    static constexpr unsigned int invalid_bin =
+        std::numeric_limits<unsigned int>::max();
+
+    /// Constructor creating an empty grid, with uniform Z bins
+    ///
+    /// @param axis_p0 The phi axis of the grid
+    /// @param axis_p1 The z axis of the grid
+    /// @param neighbor_scope The number of neighbouring Z bins to look at,
+    ///                       below and above the bin of a middle spacepoint
+    /// @param mr The memory resource to use
+    ///
+    flat_spacepoint_grid(const axis_p0_type& axis_p0,
+                         const axis_p1_type& axis_p1,
+                         const darray<unsigned int, 2>& neighbor_scope,
+                         vecmem::memory_resource& mr);
+
+    /// Constructor creating an empty grid, with non-uniform Z bins
+    ///
+    /// The neighbouring Z bins of every Z bin are all the bins overlapping
+    /// with the range that the (uniform) bins of @c axis_p1 and
+    /// @c neighbor_scope would cover around it. So the spacepoint pairs
+    /// considered by the seeding are a subset of what the uniform binning
+    /// would consider, without losing any pair that is within the
+    /// configured Z reach.
+    ///
+    /// @param axis_p0 The phi axis of the grid
+    /// @param axis_p1 The uniform z axis, defining the Z reach of the bins
+    /// @param z_edges The (increasing) edges of the Z bins, with the first
+    ///                and last ones matching the limits of @c axis_p1
+    /// @param neighbor_scope The number of uniform Z bins to reach, below
+    ///                       and above the bin of a middle spacepoint
+    /// @param mr The memory resource to use
+    ///
+    flat_spacepoint_grid(const axis_p0_type& axis_p0,
+                         const axis_p1_type& axis_p1,
+                         std::span<const scalar> z_edges,
+                         const darray<unsigned int, 2>& neighbor_scope,
+                         vecmem::memory_resource& mr);
+
+    /// Create an empty grid with the same binning as this one
+    ///
+    /// @param mr The memory resource to use
+    /// @return An empty grid with the same bins as this one
+    ///
+    flat_spacepoint_grid empty_copy(vecmem::memory_resource& mr) const;
+
+    /// Fill the grid with spacepoints
+    ///
+    /// The spacepoints are counted per bin, the bin offsets are calculated
+    /// with a prefix sum, and the spacepoints are then scattered into their
+    /// bins. Spacepoints keep their relative order inside of every bin.
+    ///
+    /// @param spacepoints All spacepoints of the event
+    /// @param sp_bins The global bin index of every spacepoint, or
+    ///                @c invalid_bin for the ones to leave out
+    ///
+    void fill(const edm::spacepoint_collection::const_device& spacepoints,
+              const vecmem::vector<unsigned int>& sp_bins);
+
+    /// Fill the grid with a subset of the spacepoints
+    ///
+    /// Works like the other @c fill function, but only touches the selected
+    /// spacepoints, so its cost does not depend on the size of the event.
+    ///
+    /// @param spacepoints All spacepoints of the event
+    /// @param sp_indices The indices of the spacepoints to put into the grid
+    /// @param sp_bins The global bin index of each selected spacepoint
+    ///
+    void fill(const edm::spacepoint_collection::const_device& spacepoints,
+              std::span<const unsigned int> sp_indices,
+              std::span<const unsigned int> sp_bins);
+
+    /// @name Grid geometry
+    /// @{
+
+    /// The phi axis of the grid
+    const axis_p0_type& axis_p0() const { return m_axis_p0; }
+    /// The uniform z axis of the grid
+    ///
+    /// Only describes the Z bins of the grid if @c has_uniform_z_bins() is
+    /// @c true.
+    ///
+    const axis_p1_type& axis_p1() const { return m_axis_p1; }
+    /// Whether the grid uses the uniform Z bins of @c axis_p1()
+    bool has_uniform_z_bins() const { return m_z_edges.empty(); }
+    /// The number of Z bins of the grid
+    unsigned int z_bins() const {
+        return has_uniform_z_bins()
+                   ? static_cast<unsigned int>(m_axis_p1.bins())
+                   : static_cast<unsigned int>(m_z_edges.size() - 1u);
+    }
+    /// The Z bin of a Z coordinate
+    unsigned int z_bin(scalar z) const {
+        if (has_uniform_z_bins()) {
+            return static_cast<unsigned int>(m_axis_p1.bin(z));
+        }
+        const auto it =
+            std::upper_bound(m_z_edges.begin() + 1, m_z_edges.end() - 1, z);
+        return static_cast<unsigned int>(it - m_z_edges.begin() - 1);
+    }
+    /// The global bin of a phi and Z coordinate pair
+    unsigned int bin_index(scalar phi, scalar z) const {
+        return static_cast<unsigned int>(m_axis_p0.bin(phi) +
+                                         m_axis_p0.bins() * z_bin(z));
+    }
+    /// The neighbouring Z bins of a Z bin (itself included)
+    ///
+    /// @param z_bin The Z bin to get the neighbours of
+    /// @return The first and one past the last neighbouring Z bin
+    ///
+    darray<unsigned int, 2> z_neighbors(unsigned int z_bin) const {
+        assert(z_bin < z_bins());
+        return {m_z_neighbors[2u * z_bin], m_z_neighbors[2u * z_bin + 1u]};
+    }
+    /// The total number of bins in the grid
+    unsigned int nbins() const {
+        return static_cast<unsigned int>(m_bin_offsets.size() - 1u);
+    }
+    /// The total number of spacepoints in the grid
+    unsigned int size() const {
+        return static_cast<unsigned int>(m_sp_indices.size());
+    }
+
+    /// @}
+
+    /// @name Bin access
+    /// @{
+
+    /// Flat index of the first spacepoint of a bin
+    unsigned int bin_begin(unsigned int bin) const {
+        assert(bin < nbins());
+        return m_bin_offsets[bin];
+    }
+    /// Flat index one past the last spacepoint of a bin
+    unsigned int bin_end(unsigned int bin) const {
+        assert(bin < nbins());
+        return m_bin_offsets[bin + 1u];
+    }
+    /// Indices (in the original collection) of the spacepoints of a bin
+    std::span<const unsigned int> bin(unsigned int bin) const {
+        return {m_sp_indices.data() + bin_begin(bin),
+                m_sp_indices.data() + bin_end(bin)};
+    }
+
+    /// @}
+
+    /// @name Spacepoint access
+    /// @{
+
+    /// Flat index of a spacepoint, from its location
+    unsigned int flat_index(const sp_location& location) const {
+        assert(location.sp_idx <
+               bin_end(location.bin_idx) - bin_begin(location.bin_idx));
+        return bin_begin(location.bin_idx) + location.sp_idx;
+    }
+    /// Location of a spacepoint, from its flat index
+    sp_location location(unsigned int index) const {
+        assert(index < size());
+        const unsigned int bin = static_cast<unsigned int>(
+            std::upper_bound(m_bin_offsets.begin(), m_bin_offsets.end(),
+                             index) -
+            m_bin_offsets.begin() - 1);
+        return {bin, index - m_bin_offsets[bin]};
+    }
+    /// Index of a spacepoint in the original collection, from its location
+    unsigned int sp_index(const sp_location& location) const {
+        return m_sp_indices[flat_index(location)];
+    }
+    /// Access a spacepoint by its flat index
+    binned_spacepoint at(unsigned int index) const {
+        assert(index < size());
+        return {*this, index};
+    }
+    /// Access a spacepoint by its location
+    binned_spacepoint at(const sp_location& location) const {
+        return {*this, flat_index(location)};
+    }
+
+    /// @}
+
+    /// @name Spacepoint coordinate columns, in bin order
+    /// @{
+
+    /// The X positions of the spacepoints
+    std::span<const scalar> x() const { return m_x; }
+    /// The Y positions of the spacepoints
+    std::span<const scalar> y() const { return m_y; }
+    /// The Z positions of the spacepoints
+    std::span<const scalar> z() const { return m_z; }
+    /// The radii of the spacepoints in the XY plane
+    std::span<const scalar> radius() const { return m_radius; }
+    /// The azimuthal angles of the spacepoints in the XY plane
+    std::span<const scalar> phi() const { return m_phi; }
+    /// The variations on the Z coordinates of the spacepoints
+    std::span<const scalar> z_variance() const { return m_z_variance; }
+    /// The variations on the radii of the spacepoints
+    std::span<const scalar> radius_variance() const {
+        return m_radius_variance;
+    }
+
+    /// @}
+
+    private:
+    /// Constructor creating an empty grid with the binning of another one
+    ///
+    /// @param parent The grid to take the binning from
+    /// @param mr The memory resource to use
+    ///
+    flat_spacepoint_grid(const flat_spacepoint_grid& parent,
+                         vecmem::memory_resource& mr);
+
+    /// Resize all flat arrays
+    void resize(unsigned int size);
+    /// Store a spacepoint at a given flat index
+    void set(unsigned int index,
+             const edm::spacepoint_collection::const_device& spacepoints,
+             unsigned int sp_index);
+
+    /// The phi axis
+    axis_p0_type m_axis_p0;
+    /// The (uniform) z axis
+    axis_p1_type m_axis_p1;
+    /// The edges of non-uniform Z bins (empty for uniform bins)
+    vecmem::vector<scalar> m_z_edges;
+    /// The first and one past the last neighbouring Z bin of each Z bin
+    vecmem::vector<unsigned int> m_z_neighbors;
+
+    /// Offsets of the bins in the flat arrays (with @c nbins()+1 elements)
+    vecmem::vector<unsigned int> m_bin_offsets;
+    /// Indices of the spacepoints in the original collection, in bin order
+    vecmem::vector<unsigned int> m_sp_indices;
+
+    /// @name Spacepoint coordinates, in bin order
+    /// @{
+    vecmem::vector<scalar> m_x;
+    vecmem::vector<scalar> m_y;
+    vecmem::vector<scalar> m_z;
+    vecmem::vector<scalar> m_radius;
+    vecmem::vector<scalar> m_phi;
+    vecmem::vector<scalar> m_z_variance;
+    vecmem::vector<scalar> m_radius_variance;
+    /// @}
+
+};  // class flat_spacepoint_grid
+
+inline scalar binned_spacepoint::x() const {
+    return m_grid->x()[m_index];
+}
+inline scalar binned_spacepoint::y() const {
+    return m_grid->y()[m_index];
+}
+inline scalar binned_spacepoint::z() const {
+    return m_grid->z()[m_index];
+}
+inline scalar binned_spacepoint::radius() const {
+    return m_grid->radius()[m_index];
+}
+inline scalar binned_spacepoint::phi() const {
+    return m_grid->phi()[m_index];
+}
+inline scalar binned_spacepoint::z_variance() const {
+    return m_grid->z_variance()[m_index];
+}
+inline scalar binned_spacepoint::radius_variance() const {
+    return m_grid->radius_variance()[m_index];
+}
+
+}  // namespace traccc::details
@@ -10,9 +10,11 @@
 // Project include(s).
 #include "traccc/edm/seed_collection.hpp"
 #include "traccc/edm/spacepoint_collection.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/seeding_statistics.hpp"
 #include "traccc/utils/messaging.hpp"
+#include "traccc/utils/scratch_memory_resource.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
@@ -46,15 +48,54 @@ class seed_finding : public messaging {
 
     /// Callable operator for the seed finding
     ///
+    /// With @c traccc::seedfinder_config::parallel set, the middle
+    /// spacepoints are processed in parallel, producing the same seeds, in
+    /// the same order, as the serial processing.
+    ///
     /// @param spacepoints All spacepoints in the event
     /// @param sp_grid The same spacepoints arranged in a 2D Phi-Z grid
     /// @return The spacepoint triplets that form the track seeds
     ///
     edm::seed_collection::host operator()(
         const edm::spacepoint_collection::const_view& spacepoints,
-        const traccc::details::spacepoint_grid_types::host& sp_grid) const;
+        const traccc::details::flat_spacepoint_grid& sp_grid) const;
+
+    /// Allocation statistics of the scratch memory used by the seed finding
+    ///
+    /// The temporary collections of the seed finding are allocated from
+    /// scratch memory resources (one per concurrently running thread) that
+    /// are rewound for every event. The statistics are summed over all of
+    /// them. Not to be called concurrently with the seed finding itself.
+    ///
+    scratch_memory_resource::statistics scratch_statistics() const;
+
+    /// Statistics collected by the seed finding
+    ///
+    /// Only filled with @c traccc::seedfinder_config::collect_statistics
+    /// set. Summed over all events processed so far.
+    ///
+    seeding_statistics statistics() const;
+
+    /// Add externally collected statistics to the ones of the seed finding
+    ///
+    /// Used to record the statistics of the spacepoint binning that precedes
+    /// the seed finding.
+    ///
+    /// @param stats The statistics to add
+    ///
+    void record_statistics(const seeding_statistics& stats) const;
 
     private:
+    /// Find the seeds, processing the middle spacepoints in parallel
+    ///
+    /// @param spacepoints All spacepoints in the event
+    /// @param sp_grid The same spacepoints arranged in a 2D Phi-Z grid
+    /// @return The spacepoint triplets that form the track seeds
+    ///
+    edm::seed_collection::host parallel_seed_finding(
+        const edm::spacepoint_collection::const_view& spacepoints,
+        const traccc::details::flat_spacepoint_grid& sp_grid) const;
+
     /// Internal implementation struct
     struct impl;
     /// Pointer to the internal implementation
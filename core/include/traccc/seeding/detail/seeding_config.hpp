@@ -103,6 +103,21 @@ struct seedfinder_config {
 
     darray<unsigned int, 2> neighbor_scope{1, 1};
 
+    // process the middle spacepoints in parallel in the host seed finding,
+    // using TBB (not used by the device algorithms)
+    bool parallel = false;
+    // maximum number of threads to use in parallel mode (0: automatic)
+    unsigned int max_threads = 0u;
+    // collect combinatorics and timing statistics in the host seeding
+    // (not used by the device algorithms)
+    bool collect_statistics = false;
+    // choose the Z bins of the host seeding's spacepoint grid based on the
+    // spacepoint occupancy of every event (not used by the device algorithms)
+    bool adaptive_z_binning = false;
+    // maximum number of sub-bins to split a uniform Z bin into, with adaptive
+    // Z binning
+    unsigned int max_z_bin_splits = 4u;
+
     TRACCC_HOST_DEVICE
     size_t get_num_rbins() const {
         return static_cast<size_t>(rMax + vector::norm(beamPos));
@@ -219,4 +234,22 @@ struct seedfilter_config {
     float spB_min_radius = 43.f * unit<float>::mm;
 };
 
+// strip spacepoint formation configuration
+struct strip_spacepoint_formation_config {
+    // relative tolerance on the strip lengths, when checking whether two
+    // strips cross each other
+    float strip_length_tolerance = 0.01f;
+
+    // module pair finding
+    // maximum distance in mm between the centres of two paired modules
+    float max_module_distance = 5.f * unit<float>::mm;
+    // maximum angle between the normals of two paired modules
+    float max_normal_angle = 0.1f;
+    // minimum (stereo) angle between the strips of two paired modules
+    float min_stereo_angle = 0.005f;
+
+    // maximum number of threads to use (0: automatic)
+    unsigned int max_threads = 0u;
+};
+
 }  // namespace traccc
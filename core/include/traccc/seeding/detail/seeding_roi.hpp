@@ -0,0 +1,76 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/common.hpp"
+#include "traccc/definitions/math.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/container.hpp"
+
+namespace traccc {
+
+/// Eta-phi region of interest for the seeding
+///
+/// Describes the region that tracks coming from a section of the beam line
+/// would traverse, for instance around a calorimeter object.
+///
+struct seeding_roi {
+
+    /// Lower edge of the pseudorapidity range
+    scalar eta_min = -1.f;
+    /// Upper edge of the pseudorapidity range
+    scalar eta_max = 1.f;
+
+    /// Lower edge of the azimuthal range
+    ///
+    /// The range wraps around +-pi if @c phi_min is larger than @c phi_max.
+    ///
+    scalar phi_min = -constant<scalar>::pi;
+    /// Upper edge of the azimuthal range
+    scalar phi_max = constant<scalar>::pi;
+
+    /// Lower edge of the beam line section that tracks may come from
+    scalar z_min = -250.f * unit<scalar>::mm;
+    /// Upper edge of the beam line section that tracks may come from
+    scalar z_max = 250.f * unit<scalar>::mm;
+};
+
+/// Declare all seeding RoI collection types
+using seeding_roi_collection_types = collection_types<seeding_roi>;
+
+/// Check whether a position is inside of a region of interest
+///
+/// A position is inside if a straight line from the RoI's beam line section
+/// through it would have a pseudorapidity inside of the RoI's range.
+///
+/// @param roi The region of interest
+/// @param r   The radius of the position
+/// @param z   The Z coordinate of the position
+/// @param phi The azimuthal angle of the position
+/// @return @c true if the position is inside of the RoI
+///
+TRACCC_HOST_DEVICE inline bool is_inside(const seeding_roi& roi, scalar r,
+                                         scalar z, scalar phi) {
+
+    // Check the azimuthal angle.
+    if (roi.phi_min <= roi.phi_max) {
+        if ((phi < roi.phi_min) || (phi > roi.phi_max)) {
+            return false;
+        }
+    } else if ((phi < roi.phi_min) && (phi > roi.phi_max)) {
+        return false;
+    }
+
+    // Check the pseudorapidity, for the full beam line section.
+    return ((z >= roi.z_min + r * math::sinh(roi.eta_min)) &&
+            (z <= roi.z_max + r * math::sinh(roi.eta_max)));
+}
+
+}  // namespace traccc
@@ -9,12 +9,17 @@
 
 // Library include(s).
 #include "traccc/edm/spacepoint_collection.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
 #include "traccc/utils/messaging.hpp"
 
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
 // System include(s).
 #include <functional>
+#include <span>
 #include <utility>
 
 namespace traccc::host::details {
@@ -39,17 +44,78 @@ class spacepoint_binning : public messaging {
     /// @param spacepoints All of the spacepoints of the event
     /// @return The spacepoints arranged in a Phi-Z grid
     ///
-    traccc::details::spacepoint_grid_types::host operator()(
+    traccc::details::flat_spacepoint_grid operator()(
         const edm::spacepoint_collection::const_view& spacepoints) const;
 
+    /// Bin only the spacepoints inside of a set of regions of interest
+    ///
+    /// @param spacepoints All of the spacepoints of the event
+    /// @param rois The regions of interest
+    /// @return The spacepoints inside of any of the RoIs, arranged in a Phi-Z
+    ///         grid
+    ///
+    traccc::details::flat_spacepoint_grid operator()(
+        const edm::spacepoint_collection::const_view& spacepoints,
+        const seeding_roi_collection_types::const_view& rois) const;
+
+    /// Select the spacepoints of a single region of interest
+    ///
+    /// Only the bins of @c sp_grid overlapping the RoI are visited, so the
+    /// cost of this function scales with the size of the RoI.
+    ///
+    /// @param spacepoints All of the spacepoints of the event
+    /// @param sp_grid The grid to select the spacepoints from
+    /// @param roi The region of interest
+    /// @return The spacepoints inside of the RoI, arranged in a Phi-Z grid
+    ///
+    traccc::details::flat_spacepoint_grid operator()(
+        const edm::spacepoint_collection::const_view& spacepoints,
+        const traccc::details::flat_spacepoint_grid& sp_grid,
+        const seeding_roi& roi) const;
+
+    /// Use a fixed set of Z bin edges for all events
+    ///
+    /// Meant for using Z bins determined on a calibration sample. Overrides
+    /// both the uniform and the adaptive Z binning. Passing an empty range
+    /// goes back to the configured binning.
+    ///
+    /// @param z_edges The (increasing) edges of the Z bins, with the first
+    ///                and last ones matching the Z limits of the grid
+    ///
+    void set_z_bin_edges(std::span<const scalar> z_edges);
+
     private:
+    /// Create an empty grid, with the configured Z binning
+    ///
+    /// @param spacepoints All of the spacepoints of the event
+    /// @param sp_bins Marks the spacepoints that will be put into the grid
+    ///                with any value other than @c invalid_bin
+    /// @return The grid to put the spacepoints into
+    ///
+    traccc::details::flat_spacepoint_grid make_grid(
+        const edm::spacepoint_collection::const_device& spacepoints,
+        const vecmem::vector<unsigned int>& sp_bins) const;
+
+    /// Bin the spacepoints accepted by a selector function
+    ///
+    /// @param spacepoints All of the spacepoints of the event
+    /// @param selector Function deciding which (valid) spacepoints to bin
+    /// @return The selected spacepoints arranged in a Phi-Z grid
+    ///
+    template <typename selector_t>
+    traccc::details::flat_spacepoint_grid bin(
+        const edm::spacepoint_collection::const_view& spacepoints,
+        selector_t&& selector) const;
+
     /// @name Tool configuration
     /// @{
     seedfinder_config m_config;
     spacepoint_grid_config m_grid_config;
-    std::pair<traccc::details::spacepoint_grid_types::host::axis_p0_type,
-              traccc::details::spacepoint_grid_types::host::axis_p1_type>
+    std::pair<traccc::details::flat_spacepoint_grid::axis_p0_type,
+              traccc::details::flat_spacepoint_grid::axis_p1_type>
         m_axes;
+    /// Fixed Z bin edges to use (if not empty)
+    vecmem::vector<scalar> m_z_edges;
     /// @}
 
     /// Memory resource to use
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/definitions/primitives.hpp"
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/spacepoint_collection.hpp"
@@ -30,6 +31,46 @@ TRACCC_HOST_DEVICE inline void fill_pixel_spacepoint(edm::spacepoint<soa_t>& sp,
                                                      const detector_t& det,
                                                      const measurement& meas);
 
+/// Function helping with checking a measurement object for strip spacepoint
+/// creation
+///
+/// @param[in]  measurement The input measurement
+TRACCC_HOST_DEVICE inline bool is_valid_strip_measurement(
+    const measurement& meas);
+
+/// Calculate the global positions of the two ends of a measured strip
+///
+/// The strip runs along the @c strip_axis local axis of its module, centred
+/// on the origin of that axis. The (1D) measurement must measure the other
+/// local axis.
+///
+/// @param[in]  det         The tracking geometry
+/// @param[in]  meas        The strip measurement
+/// @param[in]  strip_axis  The local axis that the strip runs along
+/// @param[in]  half_length The half length of the strip
+/// @return The global positions of the two ends of the strip
+///
+template <typename detector_t>
+TRACCC_HOST_DEVICE inline darray<point3, 2> strip_end_points(
+    const detector_t& det, const measurement& meas, unsigned int strip_axis,
+    scalar half_length);
+
+/// Find the crossing point of two strips
+///
+/// The crossing point is found along the straight line from the origin that
+/// crosses both strips, and is placed on the first strip.
+///
+/// @param[in]  strip1    The end points of the first strip
+/// @param[in]  strip2    The end points of the second strip
+/// @param[in]  tolerance Relative tolerance on the length of the strips
+/// @param[out] crossing  The global position of the crossing point
+/// @return @c true if the strips cross, @c false if they don't (in which case
+///         @c crossing is not modified)
+///
+TRACCC_HOST_DEVICE inline bool strip_crossing_point(
+    const darray<point3, 2>& strip1, const darray<point3, 2>& strip2,
+    scalar tolerance, point3& crossing);
+
 }  // namespace traccc::details
 
 // Include the implementation.
@@ -0,0 +1,45 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/container.hpp"
+
+// Detray include(s).
+#include <detray/geometry/barcode.hpp>
+
+namespace traccc {
+
+/// A pair of back-to-back (stereo) strip detector modules
+///
+/// Spacepoints are formed out of the crossing points of the strips measured
+/// on the two modules of such a pair.
+///
+struct strip_module_pair {
+
+    /// Surface of the first module
+    detray::geometry::barcode first_surface;
+    /// Surface of the second module
+    detray::geometry::barcode second_surface;
+
+    /// Half length of the strips of the first module
+    scalar first_half_length = 0.f;
+    /// Half length of the strips of the second module
+    scalar second_half_length = 0.f;
+
+    /// Local axis that the strips of the first module run along
+    unsigned int first_strip_axis = 1u;
+    /// Local axis that the strips of the second module run along
+    unsigned int second_strip_axis = 1u;
+};
+
+/// Declare all strip module pair collection types
+using strip_module_pair_collection_types = collection_types<strip_module_pair>;
+
+}  // namespace traccc
@@ -16,16 +16,21 @@
 namespace traccc::details {
 
 /// Functor to sort triplets with, during their final selection.
+///
+/// @tparam grid_t The type of the spacepoint grid that the triplets refer to
+///
+template <typename grid_t = spacepoint_grid_types::const_device>
 class triplet_sorter {
 
     public:
     /// Constructor
     ///
     /// @param[in] spacepoints All spacepoints in the event
+    /// @param[in] sp_grid The spacepoint grid
     ///
     TRACCC_HOST_DEVICE
     triplet_sorter(const edm::spacepoint_collection::const_device& spacepoints,
-                   const spacepoint_grid_types::const_device& sp_grid)
+                   const grid_t& sp_grid)
         : m_spacepoints{&spacepoints}, m_sp_grid{&sp_grid} {}
 
     /// Compare two triplets.
@@ -74,7 +79,7 @@ class triplet_sorter {
     /// All spacepoints in the event
     const edm::spacepoint_collection::const_device* m_spacepoints;
     /// The spacepoint grid
-    const spacepoint_grid_types::const_device* m_sp_grid;
+    const grid_t* m_sp_grid;
 
 };  // struct triplet_sorter
 
@@ -0,0 +1,168 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
+#include "traccc/seeding/detail/lin_circle.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/spacepoint_type.hpp"
+
+// System include(s).
+#include <cmath>
+
+namespace traccc {
+
+/// Batched versions of the @c traccc::doublet_finding_helper functions
+///
+/// These work on many "other" spacepoints at once, reading their coordinates
+/// from the (bin ordered) columns of a
+/// @c traccc::details::flat_spacepoint_grid. The loops are kept free of
+/// branches and of indirect function calls, so that the compiler could
+/// vectorize them. The results are the same as the ones of the scalar
+/// functions.
+///
+/// Only used by the host seeding.
+///
+struct doublet_finding_batch_helper {
+
+    /// Check which spacepoints of a range form doublets with a middle one
+    ///
+    /// @param[in] grid The spacepoint grid
+    /// @param[in] middle The flat index of the middle spacepoint
+    /// @param[in] begin The flat index of the first other spacepoint
+    /// @param[in] end The flat index one past the last other spacepoint
+    /// @param[in] config The seed finding configuration
+    /// @param[out] result 1 for every compatible, 0 for every incompatible
+    ///                    spacepoint, with @c end-begin elements
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    ///                     doublets
+    ///
+    template <details::spacepoint_type otherSpType>
+    static inline void isCompatible(const details::flat_spacepoint_grid& grid,
+                                    unsigned int middle, unsigned int begin,
+                                    unsigned int end,
+                                    const seedfinder_config& config,
+                                    unsigned char* result);
+
+    /// Do the conformal transformation on a set of doublets
+    ///
+    /// @param[in] grid The spacepoint grid
+    /// @param[in] middle The flat index of the middle spacepoint
+    /// @param[in] others The flat indices of the other spacepoints
+    /// @param[in] n The number of other spacepoints
+    /// @param[out] result The transformed coordinates, with @c n elements
+    /// @tparam otherSpType is whether it is for middle-bottom or middle-top
+    ///                     doublets
+    ///
+    template <details::spacepoint_type otherSpType>
+    static inline void transform_coordinates(
+        const details::flat_spacepoint_grid& grid, unsigned int middle,
+        const unsigned int* others, unsigned int n, lin_circle* result);
+};
+
+template <details::spacepoint_type otherSpType>
+void doublet_finding_batch_helper::isCompatible(
+    const details::flat_spacepoint_grid& grid, unsigned int middle,
+    unsigned int begin, unsigned int end, const seedfinder_config& config,
+    unsigned char* result) {
+
+    static_assert(otherSpType == details::spacepoint_type::bottom ||
+                  otherSpType == details::spacepoint_type::top);
+
+    // Access the coordinates.
+    const scalar* radius = grid.radius().data();
+    const scalar* z = grid.z().data();
+    const scalar rM = radius[middle];
+    const scalar zM = z[middle];
+
+    // Copy the configuration into local variables, so that the compiler would
+    // not need to worry about aliasing.
+    const scalar deltaRMin = config.deltaRMin;
+    const scalar deltaRMax = config.deltaRMax;
+    const scalar cotThetaMax = config.cotThetaMax;
+    const scalar collisionRegionMin = config.collisionRegionMin;
+    const scalar collisionRegionMax = config.collisionRegionMax;
+
+    // Evaluate the same cuts as doublet_finding_helper::isCompatible, with
+    // non-short-circuiting operators.
+    const unsigned int n = end - begin;
+    for (unsigned int i = 0; i < n; ++i) {
+        scalar deltaR, cotTheta;
+        if constexpr (otherSpType == details::spacepoint_type::bottom) {
+            deltaR = rM - radius[begin + i];
+            cotTheta = zM - z[begin + i];
+        } else {
+            deltaR = radius[begin + i] - rM;
+            cotTheta = z[begin + i] - zM;
+        }
+        const scalar zOrigin = zM * deltaR - rM * cotTheta;
+        result[i] = static_cast<unsigned char>(
+            (deltaR < deltaRMax) & (deltaR > deltaRMin) &
+            (std::fabs(cotTheta) < cotThetaMax * deltaR) &
+            (zOrigin > collisionRegionMin * deltaR) &
+            (zOrigin < collisionRegionMax * deltaR));
+    }
+}
+
+template <details::spacepoint_type otherSpType>
+void doublet_finding_batch_helper::transform_coordinates(
+    const details::flat_spacepoint_grid& grid, unsigned int middle,
+    const unsigned int* others, unsigned int n, lin_circle* result) {
+
+    static_assert(otherSpType == details::spacepoint_type::bottom ||
+                  otherSpType == details::spacepoint_type::top);
+
+    // Access the coordinates.
+    const scalar* xs = grid.x().data();
+    const scalar* ys = grid.y().data();
+    const scalar* zs = grid.z().data();
+    const scalar* z_variances = grid.z_variance().data();
+    const scalar* radius_variances = grid.radius_variance().data();
+
+    // Properties of the middle spacepoint.
+    const scalar xM = xs[middle];
+    const scalar yM = ys[middle];
+    const scalar zM = zs[middle];
+    const scalar rM = grid.radius()[middle];
+    const scalar varianceZM = z_variances[middle];
+    const scalar varianceRM = radius_variances[middle];
+    const scalar cosPhiM = xM / rM;
+    const scalar sinPhiM = yM / rM;
+
+    // Perform the same calculation as
+    // doublet_finding_helper::transform_coordinates, for all doublets.
+    for (unsigned int i = 0; i < n; ++i) {
+        const unsigned int other = others[i];
+        const scalar deltaX = xs[other] - xM;
+        const scalar deltaY = ys[other] - yM;
+        const scalar deltaZ = zs[other] - zM;
+        const scalar x = deltaX * cosPhiM + deltaY * sinPhiM;
+        const scalar y = deltaY * cosPhiM - deltaX * sinPhiM;
+        const scalar iDeltaR2 =
+            static_cast<scalar>(1.) / (deltaX * deltaX + deltaY * deltaY);
+        const scalar iDeltaR = std::sqrt(iDeltaR2);
+        scalar cot_theta = deltaZ * iDeltaR;
+        if constexpr (otherSpType == details::spacepoint_type::bottom) {
+            cot_theta = -cot_theta;
+        }
+        lin_circle& l = result[i];
+        l.m_cotTheta = cot_theta;
+        l.m_Zo = zM - rM * cot_theta;
+        l.m_iDeltaR = iDeltaR;
+        l.m_U = x * iDeltaR2;
+        l.m_V = y * iDeltaR2;
+        l.m_Er = ((varianceZM + z_variances[other]) +
+                  (cot_theta * cot_theta) *
+                      (varianceRM + radius_variances[other])) *
+                 iDeltaR2;
+    }
+}
+
+}  // namespace traccc
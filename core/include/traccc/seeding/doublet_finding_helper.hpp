@@ -26,13 +26,14 @@ struct doublet_finding_helper {
     /// @param config is configuration parameter
     /// @tparam otherSpType is whether it is for middle-bottom or middle-top
     /// doublet
+    /// @tparam T1 and @tparam T2 are spacepoint types, providing the
+    /// (const) accessors of @c traccc::edm::spacepoint
     ///
     /// @return boolean value for compatibility
     ///
     template <details::spacepoint_type otherSpType, typename T1, typename T2>
     static inline TRACCC_HOST_DEVICE bool isCompatible(
-        const edm::spacepoint<T1>& sp1, const edm::spacepoint<T2>& sp2,
-        const seedfinder_config& config);
+        const T1& sp1, const T2& sp2, const seedfinder_config& config);
 
     /// Do the conformal transformation on doublet's coordinate
     ///
@@ -40,18 +41,19 @@ struct doublet_finding_helper {
     /// @param sp2 is bottom or top spacepoint
     /// @tparam otherSpType is whether it is for middle-bottom or middle-top
     /// doublet
+    /// @tparam T1 and @tparam T2 are spacepoint types, providing the
+    /// (const) accessors of @c traccc::edm::spacepoint
     ///
     /// @return lin_circle which contains the transformed coordinate information
     ///
     template <details::spacepoint_type otherSpType, typename T1, typename T2>
-    static inline TRACCC_HOST_DEVICE lin_circle transform_coordinates(
-        const edm::spacepoint<T1>& sp1, const edm::spacepoint<T2>& sp2);
+    static inline TRACCC_HOST_DEVICE lin_circle
+    transform_coordinates(const T1& sp1, const T2& sp2);
 };
 
 template <details::spacepoint_type otherSpType, typename T1, typename T2>
 bool TRACCC_HOST_DEVICE doublet_finding_helper::isCompatible(
-    const edm::spacepoint<T1>& sp1, const edm::spacepoint<T2>& sp2,
-    const seedfinder_config& config) {
+    const T1& sp1, const T2& sp2, const seedfinder_config& config) {
 
     static_assert(otherSpType == details::spacepoint_type::bottom ||
                   otherSpType == details::spacepoint_type::top);
@@ -80,7 +82,7 @@ bool TRACCC_HOST_DEVICE doublet_finding_helper::isCompatible(
 
 template <details::spacepoint_type otherSpType, typename T1, typename T2>
 lin_circle TRACCC_HOST_DEVICE doublet_finding_helper::transform_coordinates(
-    const edm::spacepoint<T1>& sp1, const edm::spacepoint<T2>& sp2) {
+    const T1& sp1, const T2& sp2) {
 
     static_assert(otherSpType == details::spacepoint_type::bottom ||
                   otherSpType == details::spacepoint_type::top);
@@ -8,7 +8,9 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/definitions/math.hpp"
 #include "traccc/definitions/primitives.hpp"
+#include "traccc/definitions/track_parametrization.hpp"
 
 // Detray include(s).
 #include <detray/geometry/tracking_surface.hpp>
@@ -40,4 +42,60 @@ TRACCC_HOST_DEVICE inline void fill_pixel_spacepoint(edm::spacepoint<soa_t>& sp,
     sp.z_variance() = 0.f;
 }
 
+TRACCC_HOST_DEVICE inline bool is_valid_strip_measurement(
+    const measurement& meas) {
+    // Strip spacepoints are made out of 1D measurements
+    return (meas.meas_dim == 1u);
+}
+
+template <typename detector_t>
+TRACCC_HOST_DEVICE inline darray<point3, 2> strip_end_points(
+    const detector_t& det, const measurement& meas, unsigned int strip_axis,
+    scalar half_length) {
+
+    // The measured position is the centre of the strip along its axis.
+    point2 end1 = meas.local;
+    point2 end2 = meas.local;
+    end1[strip_axis] = -half_length;
+    end2[strip_axis] = half_length;
+
+    // Transform the end points into global coordinates.
+    const detray::tracking_surface sf{det, meas.surface_link};
+    return {sf.local_to_global({}, end1, {}), sf.local_to_global({}, end2, {})};
+}
+
+TRACCC_HOST_DEVICE inline bool strip_crossing_point(
+    const darray<point3, 2>& strip1, const darray<point3, 2>& strip2,
+    scalar tolerance, point3& crossing) {
+
+    // The vectors along the strips, and (twice) the positions of the strip
+    // centres.
+    const vector3 q = strip1[1] - strip1[0];
+    const vector3 r = strip2[1] - strip2[0];
+    const vector3 s = strip1[0] + strip1[1];
+    const vector3 t = strip2[0] + strip2[1];
+
+    // Find the positions along the strips, in units of their half lengths,
+    // at which the straight line from the origin crosses them.
+    const vector3 qs = vector::cross(q, s);
+    const vector3 rt = vector::cross(r, t);
+    const scalar q_rt = vector::dot(q, rt);
+    const scalar r_qs = vector::dot(r, qs);
+    if ((q_rt == 0.f) || (r_qs == 0.f)) {
+        return false;
+    }
+    const scalar m = -vector::dot(s, rt) / q_rt;
+    const scalar n = -vector::dot(t, qs) / r_qs;
+
+    // Check that the crossing point is on both strips.
+    const scalar limit = 1.f + tolerance;
+    if ((math::fabs(m) > limit) || (math::fabs(n) > limit)) {
+        return false;
+    }
+
+    // Return the crossing point on the first strip.
+    crossing = 0.5f * (s + m * q);
+    return true;
+}
+
 }  // namespace traccc::details
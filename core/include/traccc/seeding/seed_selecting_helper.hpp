@@ -26,9 +26,8 @@ struct seed_selecting_helper {
     ///
     template <typename T1, typename T2, typename T3>
     static TRACCC_HOST_DEVICE void seed_weight(
-        const seedfilter_config& filter_config, const edm::spacepoint<T1>&,
-        const edm::spacepoint<T2>& spB, const edm::spacepoint<T3>& spT,
-        scalar& triplet_weight) {
+        const seedfilter_config& filter_config, const T1&, const T2& spB,
+        const T3& spT, scalar& triplet_weight) {
 
         scalar weight = 0;
 
@@ -54,9 +53,8 @@ struct seed_selecting_helper {
     /// @return boolean value
     template <typename T1, typename T2, typename T3>
     static TRACCC_HOST_DEVICE bool single_seed_cut(
-        const seedfilter_config& filter_config, const edm::spacepoint<T1>&,
-        const edm::spacepoint<T2>& spB, const edm::spacepoint<T3>&,
-        scalar triplet_weight) {
+        const seedfilter_config& filter_config, const T1&, const T2& spB,
+        const T3&, scalar triplet_weight) {
 
         return !(spB.radius() > filter_config.good_spB_min_radius &&
                  triplet_weight < filter_config.good_spB_min_weight);
@@ -70,11 +68,11 @@ struct seed_selecting_helper {
     /// @param seed             current seed to possibly cut
     ///
     /// @return boolean value
+    template <typename grid_t>
     static TRACCC_HOST_DEVICE bool cut_per_middle_sp(
         const seedfilter_config& filter_config,
         const edm::spacepoint_collection::const_device& spacepoints,
-        const details::spacepoint_grid_types::const_device& grid,
-        const triplet& seed) {
+        const grid_t& grid, const triplet& seed) {
 
         const edm::spacepoint_collection::const_device::const_proxy_type spB =
             spacepoints.at(grid.bin(seed.sp1.bin_idx)[seed.sp1.sp_idx]);
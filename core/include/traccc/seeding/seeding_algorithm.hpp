@@ -12,15 +12,21 @@
 #include "traccc/edm/spacepoint_collection.hpp"
 #include "traccc/seeding/detail/seed_finding.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/seeding_roi.hpp"
 #include "traccc/seeding/detail/spacepoint_binning.hpp"
+#include "traccc/seeding/seeding_statistics.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/messaging.hpp"
+#include "traccc/utils/scratch_memory_resource.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s).
+#include <functional>
 #include <memory>
+#include <span>
 
 namespace traccc::host {
 
@@ -30,6 +36,19 @@ class seeding_algorithm : public algorithm<edm::seed_collection::host(
                           public messaging {
 
     public:
+    /// Output type of the region-of-interest seeding
+    struct roi_output_type {
+        /// The seeds found in all of the regions of interest
+        edm::seed_collection::host seeds;
+        /// The offsets of the seeds of every RoI in @c seeds
+        ///
+        /// It has one more element than the number of RoIs. The seeds of
+        /// RoI @c i are at indices <tt>[roi_offsets[i],
+        /// roi_offsets[i+1])</tt>.
+        ///
+        vecmem::vector<unsigned int> roi_offsets;
+    };
+
     /// Constructor for the seed finding algorithm
     ///
     /// @param finder_config The configuration for the seed finder
@@ -51,11 +70,68 @@ class seeding_algorithm : public algorithm<edm::seed_collection::host(
     output_type operator()(const edm::spacepoint_collection::const_view&
                                spacepoints) const override;
 
+    /// Run the seeding only in a set of regions of interest
+    ///
+    /// Only the spacepoints inside of the RoIs are binned, and the seeds of
+    /// every RoI are found using only the spacepoints inside of that RoI.
+    /// So the time spent on an RoI scales with its size, not with the size
+    /// of the event. Seeds may appear in more than one RoI, if the RoIs
+    /// overlap.
+    ///
+    /// @param spacepoints All spacepoints in the event
+    /// @param rois The regions of interest
+    /// @return The seeds found in the RoIs, with their per-RoI offsets
+    ///
+    roi_output_type operator()(
+        const edm::spacepoint_collection::const_view& spacepoints,
+        const seeding_roi_collection_types::const_view& rois) const;
+
+    /// Allocation statistics of the scratch memory used by the seeding
+    ///
+    /// Meant for profiling the memory usage of the algorithm.
+    ///
+    /// @return The statistics summed over all events processed so far
+    ///
+    scratch_memory_resource::statistics scratch_statistics() const;
+
+    /// Use a fixed set of Z bin edges in the spacepoint grid
+    ///
+    /// Meant for using Z bins determined on a calibration sample, for
+    /// instance with @c traccc::get_adaptive_z_edges. Overrides both the
+    /// uniform and the adaptive Z binning. Not to be called concurrently
+    /// with the seeding itself.
+    ///
+    /// @param z_edges The (increasing) edges of the Z bins, with the first
+    ///                and last ones matching the Z limits of the grid
+    ///
+    void set_z_bin_edges(std::span<const scalar> z_edges);
+
+    /// Combinatorics and timing statistics of the seeding
+    ///
+    /// Only collected with @c traccc::seedfinder_config::collect_statistics
+    /// set. Meant for tuning the seeding configuration.
+    ///
+    /// @return The statistics summed over all events processed so far
+    ///
+    seeding_statistics statistics() const;
+
     private:
+    /// Bin the spacepoints, recording statistics about it if requested
+    ///
+    /// @param bin The callable performing the binning
+    /// @return The spacepoint grid
+    ///
+    template <typename binning_t>
+    traccc::details::flat_spacepoint_grid bin(const binning_t& bin) const;
+
     /// Tool performing the spacepoint binning
     details::spacepoint_binning m_binning;
     /// Tool performing the seed finding
     details::seed_finding m_finding;
+    /// Memory resource to use for the output containers
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// Whether to collect statistics
+    bool m_collect_statistics;
 
 };  // class seeding_algorithm
 
@@ -0,0 +1,127 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace traccc {
+
+/// Statistics collected by the host seeding
+///
+/// Counts the combinatorics of the different stages of the seeding, and the
+/// time spent in them. Only collected with
+/// @c traccc::seedfinder_config::collect_statistics set.
+///
+struct seeding_statistics {
+
+    /// Number of bins in the histograms
+    static constexpr std::size_t n_histogram_bins = 32u;
+    /// Histogram of non-negative integer values, with power-of-two bins
+    ///
+    /// Bin 0 counts the entries with value 0, and bin @c i > 0 counts the
+    /// entries with values in [2^(i-1), 2^i). The last bin also counts all
+    /// larger values.
+    ///
+    using histogram = std::array<std::uint64_t, n_histogram_bins>;
+
+    /// Add an entry to a histogram
+    ///
+    /// @param h The histogram to fill
+    /// @param value The value to add to it
+    ///
+    static void fill(histogram& h, std::size_t value);
+
+    /// Get the smallest value counted by a histogram bin
+    ///
+    /// @param bin The index of the bin
+    /// @return The lower edge of the bin
+    ///
+    static std::uint64_t bin_lower_edge(std::size_t bin);
+
+    /// @name Counters
+    /// @{
+
+    /// Number of spacepoint grids built
+    ///
+    /// One per event, plus one per RoI in the region-of-interest seeding.
+    ///
+    std::uint64_t n_grids = 0u;
+    /// Number of spacepoints put into the spacepoint grids
+    std::uint64_t n_spacepoints = 0u;
+    /// Number of middle spacepoints that were considered
+    std::uint64_t n_middle_spacepoints = 0u;
+    /// Number of middle spacepoints with both bottom and top doublets
+    std::uint64_t n_middle_spacepoints_with_doublets = 0u;
+    /// Number of middle-bottom doublets
+    std::uint64_t n_mid_bot_doublets = 0u;
+    /// Number of middle-top doublets
+    std::uint64_t n_mid_top_doublets = 0u;
+    /// Number of bottom-middle-top combinations tested in the triplet finding
+    std::uint64_t n_triplet_candidates = 0u;
+    /// Number of triplets passing the triplet finding cuts
+    std::uint64_t n_triplets = 0u;
+    /// Number of triplets passing the single seed cuts of the seed filtering
+    std::uint64_t n_triplets_passing_single_seed_cuts = 0u;
+    /// Number of seeds produced
+    std::uint64_t n_seeds = 0u;
+
+    /// @}
+
+    /// @name Timing
+    ///
+    /// With the parallel seed finding the times of the doublet finding,
+    /// triplet finding and seed filtering are summed over all threads.
+    ///
+    /// @{
+
+    /// Time spent in the spacepoint binning
+    std::chrono::nanoseconds binning_time{0};
+    /// Time spent in the (middle-bottom and middle-top) doublet finding
+    std::chrono::nanoseconds doublet_finding_time{0};
+    /// Time spent in the triplet finding
+    std::chrono::nanoseconds triplet_finding_time{0};
+    /// Time spent in the seed filtering
+    std::chrono::nanoseconds seed_filtering_time{0};
+
+    /// @}
+
+    /// @name Histograms
+    /// @{
+
+    /// Number of spacepoints in the spacepoint grid bins
+    histogram bin_occupancy{};
+    /// Number of middle-bottom doublets per middle spacepoint
+    histogram mid_bot_doublets_per_middle{};
+    /// Number of middle-top doublets per middle spacepoint, for the ones
+    /// with middle-bottom doublets
+    histogram mid_top_doublets_per_middle{};
+    /// Number of triplets per middle spacepoint, for the ones with both
+    /// middle-bottom and middle-top doublets
+    histogram triplets_per_middle{};
+    /// Number of seeds per middle spacepoint, for the ones with both
+    /// middle-bottom and middle-top doublets
+    histogram seeds_per_middle{};
+
+    /// @}
+
+    /// Add statistics collected separately
+    seeding_statistics& operator+=(const seeding_statistics& rhs);
+
+    /// Write the statistics in JSON format
+    ///
+    /// @param out The stream to write to
+    ///
+    void write_json(std::ostream& out) const;
+};
+
+}  // namespace traccc
@@ -15,8 +15,13 @@
 #include "traccc/seeding/detail/spacepoint_grid.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s).
+#include <algorithm>
+#include <span>
+
 namespace traccc {
 
 inline std::pair<detray::axis2::circular<>, detray::axis2::regular<>> get_axes(
@@ -110,6 +115,54 @@ inline std::pair<detray::axis2::circular<>, detray::axis2::regular<>> get_axes(
     return {m_phi_axis, m_z_axis};
 }
 
+/// Choose non-uniform Z bin edges, based on the occupancy of uniform bins
+///
+/// Every uniform Z bin (with the ones created by @c get_axes) is split into
+/// a power-of-two number of equal sub-bins, so that the sub-bins would hold
+/// no more spacepoints than the average uniform bin, as far as
+/// @c max_splits allows it.
+///
+/// @param grid_config The spacepoint grid configuration
+/// @param counts The number of spacepoints in each uniform Z bin
+/// @param max_splits The maximum number of sub-bins per uniform bin
+/// @param mr The memory resource to use for the result
+/// @return The edges of the non-uniform Z bins
+///
+inline vecmem::vector<scalar> get_adaptive_z_edges(
+    const spacepoint_grid_config& grid_config,
+    std::span<const unsigned int> counts, unsigned int max_splits,
+    vecmem::memory_resource& mr) {
+
+    const unsigned int n_bins = static_cast<unsigned int>(counts.size());
+    const scalar z_min = grid_config.zMin;
+    const scalar width = (grid_config.zMax - grid_config.zMin) /
+                         static_cast<scalar>(n_bins);
+
+    // The average occupancy of the uniform bins.
+    unsigned long long total = 0u;
+    for (unsigned int count : counts) {
+        total += count;
+    }
+    const unsigned long long target =
+        std::max(total / std::max(n_bins, 1u), 1ull);
+
+    vecmem::vector<scalar> result(&mr);
+    result.reserve(n_bins + 1u);
+    for (unsigned int i = 0; i < n_bins; ++i) {
+        unsigned int splits = 1u;
+        while ((splits < max_splits) && (counts[i] > splits * target)) {
+            splits *= 2u;
+        }
+        for (unsigned int j = 0; j < splits; ++j) {
+            result.push_back(z_min + width * (static_cast<scalar>(i) +
+                                              static_cast<scalar>(j) /
+                                                  static_cast<scalar>(splits)));
+        }
+    }
+    result.push_back(grid_config.zMax);
+    return result;
+}
+
 template <typename T>
 inline TRACCC_HOST_DEVICE bool is_valid_sp(const seedfinder_config& config,
                                            const edm::spacepoint<T>& sp) {
@@ -0,0 +1,116 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+#include "traccc/geometry/detector.hpp"
+#include "traccc/geometry/silicon_detector_description.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/strip_module_pair.hpp"
+#include "traccc/utils/algorithm.hpp"
+#include "traccc/utils/messaging.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <functional>
+
+namespace traccc::host {
+
+/// Algorithm forming space points out of strip measurements
+///
+/// This algorithm pairs up the 1D measurements made on back-to-back (stereo)
+/// strip detector modules, and creates a spacepoint out of every pair of
+/// strips that cross each other. The module pairs are taken from a lookup
+/// table that only needs to be created once per detector, using
+/// @c find_module_pairs. The module pairs are processed in parallel.
+///
+class strip_spacepoint_formation_algorithm
+    : public algorithm<edm::spacepoint_collection::host(
+          const default_detector::host&,
+          const strip_module_pair_collection_types::const_view&,
+          const measurement_collection_types::const_view&)>,
+      public algorithm<edm::spacepoint_collection::host(
+          const telescope_detector::host&,
+          const strip_module_pair_collection_types::const_view&,
+          const measurement_collection_types::const_view&)>,
+      public messaging {
+
+    public:
+    /// Output type
+    using output_type = edm::spacepoint_collection::host;
+
+    /// Constructor for strip_spacepoint_formation
+    ///
+    /// @param config is the strip spacepoint formation configuration
+    /// @param mr is the memory resource
+    ///
+    strip_spacepoint_formation_algorithm(
+        const strip_spacepoint_formation_config& config,
+        vecmem::memory_resource& mr,
+        std::unique_ptr<const Logger> logger = getDummyLogger().clone());
+
+    /// Find the back-to-back strip module pairs of a detector
+    ///
+    /// @param det Detector object
+    /// @param dd_view The detector description
+    /// @return The lookup table of strip module pairs
+    ///
+    strip_module_pair_collection_types::host find_module_pairs(
+        const default_detector::host& det,
+        const silicon_detector_description::const_view& dd_view) const;
+
+    /// Find the back-to-back strip module pairs of a detector
+    ///
+    /// @param det Detector object
+    /// @param dd_view The detector description
+    /// @return The lookup table of strip module pairs
+    ///
+    strip_module_pair_collection_types::host find_module_pairs(
+        const telescope_detector::host& det,
+        const silicon_detector_description::const_view& dd_view) const;
+
+    /// Construct spacepoints from 1D silicon strip measurements
+    ///
+    /// @param det Detector object
+    /// @param module_pairs The strip module pairs of the detector
+    /// @param measurements A collection of measurements
+    /// @return A spacepoint container, with one spacepoint for every pair of
+    ///         crossing strips, referencing both of their measurements
+    ///
+    output_type operator()(
+        const default_detector::host& det,
+        const strip_module_pair_collection_types::const_view& module_pairs,
+        const measurement_collection_types::const_view& measurements)
+        const override;
+
+    /// Construct spacepoints from 1D silicon strip measurements
+    ///
+    /// @param det Detector object
+    /// @param module_pairs The strip module pairs of the detector
+    /// @param measurements A collection of measurements
+    /// @return A spacepoint container, with one spacepoint for every pair of
+    ///         crossing strips, referencing both of their measurements
+    ///
+    output_type operator()(
+        const telescope_detector::host& det,
+        const strip_module_pair_collection_types::const_view& module_pairs,
+        const measurement_collection_types::const_view& measurements)
+        const override;
+
+    private:
+    /// The strip spacepoint formation configuration
+    strip_spacepoint_formation_config m_config;
+    /// Memory resource to use for the output container
+    std::reference_wrapper<vecmem::memory_resource> m_mr;
+};  // class strip_spacepoint_formation_algorithm
+
+}  // namespace traccc::host
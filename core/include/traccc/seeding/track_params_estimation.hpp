@@ -36,6 +36,14 @@ class track_params_estimation
       public messaging {
 
     public:
+    /// Configuration for the track parameter estimation algorithm
+    struct config_type {
+        /// Process the seeds in parallel, using TBB
+        bool parallel = false;
+        /// Maximum number of threads to use in parallel mode (0: automatic)
+        unsigned int max_threads = 0u;
+    };
+
     /// Constructor for track_params_estimation
     ///
     /// @param mr is the memory resource
@@ -43,6 +51,14 @@ class track_params_estimation
         vecmem::memory_resource& mr,
         std::unique_ptr<const Logger> logger = getDummyLogger().clone());
 
+    /// Constructor for track_params_estimation
+    ///
+    /// @param config is the configuration of the algorithm
+    /// @param mr is the memory resource
+    track_params_estimation(
+        const config_type& config, vecmem::memory_resource& mr,
+        std::unique_ptr<const Logger> logger = getDummyLogger().clone());
+
     /// Callable operator for track_params_esitmation
     ///
     /// @param measurements All measurements of the event
@@ -53,6 +69,9 @@ class track_params_estimation
     /// value from arXiv:2112.09470v1)
     /// @return A vector of bound track parameters
     ///
+    /// With @c config_type::parallel set, batches of seeds are processed in
+    /// parallel, producing the same track parameters as the serial code.
+    ///
     output_type operator()(
         const measurement_collection_types::const_view& measurements,
         const edm::spacepoint_collection::const_view& spacepoints,
@@ -66,6 +85,29 @@ class track_params_estimation
             1.f * traccc::unit<traccc::scalar>::ns}) const override;
 
     private:
+    /// Create the track parameters for a range of seeds
+    ///
+    /// The seeds are processed in fixed size batches, with their spacepoint
+    /// positions gathered into structure-of-arrays blocks.
+    ///
+    /// @param measurements All measurements of the event
+    /// @param spacepoints All spacepoints of the event
+    /// @param seeds The reconstructed track seeds of the event
+    /// @param bfield (Temporary) Magnetic field vector
+    /// @param covariance The covariance to set for every track parameter
+    /// @param begin The index of the first seed to process
+    /// @param end The index one past the last seed to process
+    /// @param result The track parameters to fill
+    ///
+    void estimate(
+        const measurement_collection_types::const_device& measurements,
+        const edm::spacepoint_collection::const_device& spacepoints,
+        const edm::seed_collection::const_device& seeds, const vector3& bfield,
+        const bound_matrix<>& covariance, unsigned int begin, unsigned int end,
+        output_type& result) const;
+
+    /// The configuration of the algorithm
+    config_type m_config;
     /// The memory resource to use in the algorithm
     std::reference_wrapper<vecmem::memory_resource> m_mr;
 };  // class track_params_estimation
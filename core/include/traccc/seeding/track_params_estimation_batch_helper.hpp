@@ -0,0 +1,141 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Library include(s).
+#include "traccc/definitions/math.hpp"
+#include "traccc/definitions/primitives.hpp"
+
+// System include(s).
+#include <array>
+
+namespace traccc {
+
+/// Batched version of @c traccc::seed_to_bound_vector
+///
+/// Estimates the direction and the momentum of many seeds at once, reading
+/// the global positions of their spacepoints from structure-of-arrays
+/// blocks. The loop is kept free of branches and of indirect function calls,
+/// so that the compiler could vectorize it. The results agree with the ones
+/// of the scalar function up to floating point rounding.
+///
+/// Only used by the host track parameter estimation.
+///
+/// @tparam N The maximal number of seeds in a batch
+///
+template <unsigned int N>
+struct track_params_estimation_batch_helper {
+
+    /// @name Inputs
+    /// @{
+
+    /// Global X coordinates of the bottom, middle and top spacepoints
+    std::array<std::array<scalar, N>, 3> x;
+    /// Global Y coordinates of the bottom, middle and top spacepoints
+    std::array<std::array<scalar, N>, 3> y;
+    /// Global Z coordinates of the bottom, middle and top spacepoints
+    std::array<std::array<scalar, N>, 3> z;
+
+    /// @}
+
+    /// @name Outputs
+    /// @{
+
+    /// Estimated azimuthal angles of the seeds
+    std::array<scalar, N> phi;
+    /// Estimated polar angles of the seeds
+    std::array<scalar, N> theta;
+    /// Estimated q/p values of the seeds
+    std::array<scalar, N> qop;
+
+    /// @}
+
+    /// Estimate the track parameters of the first @c n seeds of the batch
+    ///
+    /// @param n The number of seeds in the batch
+    /// @param bfield The magnetic field
+    ///
+    inline void estimate(unsigned int n, const vector3& bfield);
+};
+
+template <unsigned int N>
+void track_params_estimation_batch_helper<N>::estimate(unsigned int n,
+                                                       const vector3& bfield) {
+
+    // The Z axis of the local frames is along the magnetic field, for all
+    // seeds.
+    const scalar bfield_norm = vector::norm(bfield);
+    const scalar zx = bfield[0] / bfield_norm;
+    const scalar zy = bfield[1] / bfield_norm;
+    const scalar zz = bfield[2] / bfield_norm;
+
+    for (unsigned int i = 0; i < n; ++i) {
+
+        // Positions of the middle and top spacepoints, relative to the
+        // bottom one.
+        const scalar d1x = x[1][i] - x[0][i];
+        const scalar d1y = y[1][i] - y[0][i];
+        const scalar d1z = z[1][i] - z[0][i];
+        const scalar d2x = x[2][i] - x[0][i];
+        const scalar d2y = y[2][i] - y[0][i];
+        const scalar d2z = z[2][i] - z[0][i];
+
+        // The Y axis of the local frame is perpendicular to the magnetic
+        // field and to the bottom-middle vector, and the X axis completes it.
+        scalar yx = zy * d1z - zz * d1y;
+        scalar yy = zz * d1x - zx * d1z;
+        scalar yz = zx * d1y - zy * d1x;
+        const scalar y_inv_norm =
+            1.f / math::sqrt(yx * yx + yy * yy + yz * yz);
+        yx *= y_inv_norm;
+        yy *= y_inv_norm;
+        yz *= y_inv_norm;
+        const scalar xx = yy * zz - yz * zy;
+        const scalar xy = yz * zx - yx * zz;
+        const scalar xz = yx * zy - yy * zx;
+
+        // The coordinates of the middle and top spacepoints in the local
+        // frame.
+        const scalar l1x = xx * d1x + xy * d1y + xz * d1z;
+        const scalar l1y = yx * d1x + yy * d1y + yz * d1z;
+        const scalar l2x = xx * d2x + xy * d2y + xz * d2z;
+        const scalar l2y = yx * d2x + yy * d2y + yz * d2z;
+        const scalar l2z = zx * d2x + zy * d2y + zz * d2z;
+
+        // The conformal transformation of the two points.
+        const scalar l1_perp2 = l1x * l1x + l1y * l1y;
+        const scalar l2_perp2 = l2x * l2x + l2y * l2y;
+        const scalar u1 = l1x / l1_perp2;
+        const scalar v1 = l1y / l1_perp2;
+        const scalar u2 = l2x / l2_perp2;
+        const scalar v2 = l2y / l2_perp2;
+
+        // Slope and intercept of the straight line in the u,v plane, and the
+        // (signed) radius of the circle.
+        const scalar A = (v2 - v1) / (u2 - u1);
+        const scalar B = v2 - A * u2;
+        const scalar perp_1A = math::sqrt(1.f + A * A);
+        const scalar R = -perp_1A / (2.f * B);
+        const scalar invTanTheta =
+            l2z / (2.f * R * math::asin(math::sqrt(l2_perp2) / (2.f * R)));
+
+        // The momentum direction, transformed back into the global frame.
+        const scalar tz = perp_1A * invTanTheta;
+        const scalar t_inv_norm = 1.f / math::sqrt(1.f + A * A + tz * tz);
+        const scalar dx = (xx + yx * A + zx * tz) * t_inv_norm;
+        const scalar dy = (xy + yy * A + zy * tz) * t_inv_norm;
+        const scalar dz = (xz + yz * A + zz * tz) * t_inv_norm;
+
+        phi[i] = math::atan2(dy, dx);
+        theta[i] = math::atan2(math::sqrt(dx * dx + dy * dy), dz);
+        qop[i] = 1.f / (R * bfield_norm *
+                        math::sqrt(1.f + invTanTheta * invTanTheta));
+    }
+}
+
+}  // namespace traccc
@@ -105,9 +105,8 @@ inline TRACCC_HOST_DEVICE bound_vector<> seed_to_bound_vector(
     getter::element(params, e_bound_phi, 0) = vector::phi(direction);
     getter::element(params, e_bound_theta, 0) = vector::theta(direction);
 
-    // The measured loc0 and loc1
-    assert(spB.measurement_index_2() ==
-           edm::spacepoint_collection::device::INVALID_MEASUREMENT_INDEX);
+    // The measured loc0 and loc1, from the first measurement of strip
+    // spacepoints
     const measurement& meas_for_spB =
         measurements.at(spB.measurement_index_1());
     getter::element(params, e_bound_loc0, 0) = meas_for_spB.local[0];
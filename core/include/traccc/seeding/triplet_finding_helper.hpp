@@ -29,19 +29,21 @@ struct triplet_finding_helper {
     /// lower pT cut
     /// @param curvature is curvature of triplet
     /// @param impact_parameter is impact parameter of triplet
+    /// @tparam T is a spacepoint type, providing the (const) accessors of
+    ///           @c traccc::edm::spacepoint
     ///
     /// @return boolean value for compatibility
     template <typename T>
     static inline TRACCC_HOST_DEVICE bool isCompatible(
-        const edm::spacepoint<T>& spM, const lin_circle& lb,
-        const lin_circle& lt, const seedfinder_config& config,
-        const scalar& iSinTheta2, const scalar& scatteringInRegion2,
-        scalar& curvature, scalar& impact_parameter);
+        const T& spM, const lin_circle& lb, const lin_circle& lt,
+        const seedfinder_config& config, const scalar& iSinTheta2,
+        const scalar& scatteringInRegion2, scalar& curvature,
+        scalar& impact_parameter);
 };
 
 template <typename T>
 bool TRACCC_HOST_DEVICE triplet_finding_helper::isCompatible(
-    const edm::spacepoint<T>& spM, const lin_circle& lb, const lin_circle& lt,
+    const T& spM, const lin_circle& lb, const lin_circle& lt,
     const seedfinder_config& config, const scalar& iSinTheta2,
     const scalar& scatteringInRegion2, scalar& curvature,
     scalar& impact_parameter) {
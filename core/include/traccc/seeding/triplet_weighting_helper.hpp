@@ -0,0 +1,265 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/triplet.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace traccc {
+
+/// Scratch space of the triplet weighting, re-used between doublets
+struct triplet_weighting_scratch {
+    /// Constructor
+    explicit triplet_weighting_scratch(vecmem::memory_resource& mr)
+        : sorted(&mr),
+          top_radii(&mr),
+          in_window(&mr),
+          compatible_radii(&mr) {}
+
+    /// Triplet properties used while weighting the triplets
+    struct weight_entry {
+        /// Curvature of the triplet
+        scalar curvature;
+        /// Radius of the top spacepoint of the triplet
+        scalar top_radius;
+        /// Index of the triplet
+        unsigned int index;
+    };
+    /// The triplets of one middle-bottom doublet, sorted by curvature
+    vecmem::vector<weight_entry> sorted;
+    /// Top spacepoint radii of the triplets, by triplet index
+    vecmem::vector<scalar> top_radii;
+    /// Whether the triplets are inside of the current curvature window, by
+    /// triplet index
+    vecmem::vector<char> in_window;
+    /// Top spacepoint radii of the compatible triplets found for a triplet
+    vecmem::vector<scalar> compatible_radii;
+};
+
+/// Functions setting the weights of the triplets of a middle-bottom doublet
+///
+/// The weight of every triplet is increased for every other triplet with a
+/// compatible curvature and a sufficiently different top spacepoint radius.
+/// Both functions produce exactly the same weights.
+///
+/// Only used by the host seeding.
+///
+struct triplet_weighting_helper {
+
+    /// Set the triplet weights in a double loop over all triplets
+    ///
+    /// @param[in] config The seed filtering configuration
+    /// @param[in,out] triplets The triplets to update
+    /// @param[in,out] tmp The scratch space, with @c tmp.sorted holding the
+    ///                    (not yet sorted) properties of the triplets to
+    ///                    weight
+    ///
+    static inline void weight_triplets(const seedfilter_config& config,
+                                       triplet_collection_types::host& triplets,
+                                       triplet_weighting_scratch& tmp);
+
+    /// Set the triplet weights using a curvature-sorted sliding window
+    ///
+    /// Only the triplets inside of the +-deltaInvHelixDiameter curvature
+    /// window of each triplet are considered. The window's members are kept
+    /// in a mask over the triplet indices, and are visited in index order,
+    /// so the weights are the same as the ones set by @c weight_triplets.
+    /// The triplets must be provided in increasing index order, and their
+    /// curvatures must not be NaN.
+    ///
+    /// @param[in] config The seed filtering configuration
+    /// @param[in,out] triplets The triplets to update
+    /// @param[in,out] tmp The scratch space, with @c tmp.sorted holding the
+    ///                    (not yet sorted) properties of the triplets to
+    ///                    weight
+    ///
+    static inline void weight_sorted_triplets(
+        const seedfilter_config& config,
+        triplet_collection_types::host& triplets,
+        triplet_weighting_scratch& tmp);
+
+    private:
+    /// Consider another triplet as compatible with the current one
+    ///
+    /// @param config The seed filtering configuration
+    /// @param current The triplet being weighted
+    /// @param otherTop_r The top spacepoint radius of the other triplet
+    /// @param compatible_radii The top spacepoint radii of the compatible
+    ///                         triplets found so far
+    /// @return @c true if no more compatible triplets should be considered
+    ///
+    static inline bool add_compatible(const seedfilter_config& config,
+                                      triplet& current, scalar otherTop_r,
+                                      vecmem::vector<scalar>& compatible_radii);
+};
+
+bool triplet_weighting_helper::add_compatible(
+    const seedfilter_config& config, triplet& current, scalar otherTop_r,
+    vecmem::vector<scalar>& compatible_radii) {
+
+    bool newCompSeed = true;
+    for (scalar previousDiameter : compatible_radii) {
+        // original ATLAS code uses higher min distance for 2nd found
+        // compatible seed (20mm instead of 5mm) add new compatible seed
+        // only if distance larger than rmin to all other compatible seeds
+        if (std::abs(previousDiameter - otherTop_r) < config.deltaRMin) {
+            newCompSeed = false;
+            break;
+        }
+    }
+
+    if (newCompSeed) {
+        compatible_radii.push_back(otherTop_r);
+        current.weight += config.compatSeedWeight;
+    }
+
+    return (compatible_radii.size() >= config.compatSeedLimit);
+}
+
+void triplet_weighting_helper::weight_triplets(
+    const seedfilter_config& config, triplet_collection_types::host& triplets,
+    triplet_weighting_scratch& tmp) {
+
+    for (const triplet_weighting_scratch::weight_entry& current :
+         tmp.sorted) {
+
+        triplet& current_triplet = triplets[current.index];
+
+        // if two compatible seeds with high distance in r are found,
+        // compatible seeds span 5 layers
+        // -> very good seed
+        tmp.compatible_radii.clear();
+        const scalar lowerLimitCurv =
+            current.curvature - config.deltaInvHelixDiameter;
+        const scalar upperLimitCurv =
+            current.curvature + config.deltaInvHelixDiameter;
+
+        for (const triplet_weighting_scratch::weight_entry& other :
+             tmp.sorted) {
+
+            if (current.index == other.index) {
+                continue;
+            }
+
+            // compared top SP should have at least deltaRMin distance
+            const scalar deltaR = current.top_radius - other.top_radius;
+            if (std::abs(deltaR) < config.deltaRMin) {
+                continue;
+            }
+
+            // curvature difference within limits?
+            if (other.curvature < lowerLimitCurv) {
+                continue;
+            }
+            if (other.curvature > upperLimitCurv) {
+                continue;
+            }
+
+            if (add_compatible(config, current_triplet, other.top_radius,
+                               tmp.compatible_radii)) {
+                break;
+            }
+        }
+    }
+}
+
+void triplet_weighting_helper::weight_sorted_triplets(
+    const seedfilter_config& config, triplet_collection_types::host& triplets,
+    triplet_weighting_scratch& tmp) {
+
+    const std::size_t n = tmp.sorted.size();
+    if (n == 0u) {
+        return;
+    }
+
+    // Remember the top spacepoint radii by triplet index, and set up an
+    // empty window.
+    const unsigned int first_index = tmp.sorted.front().index;
+    const std::size_t n_indices = tmp.sorted.back().index - first_index + 1u;
+    tmp.top_radii.resize(n_indices);
+    for (const triplet_weighting_scratch::weight_entry& entry : tmp.sorted) {
+        tmp.top_radii[entry.index - first_index] = entry.top_radius;
+    }
+    tmp.in_window.assign(n_indices, 0);
+
+    // Sort the triplets by curvature.
+    std::sort(tmp.sorted.begin(), tmp.sorted.end(),
+              [](const triplet_weighting_scratch::weight_entry& a,
+                 const triplet_weighting_scratch::weight_entry& b) {
+                  return a.curvature < b.curvature;
+              });
+
+    // Since the triplets are visited in increasing curvature order, the
+    // edges of their curvature windows only ever move forward.
+    std::size_t window_begin = 0u, window_end = 0u;
+    for (const triplet_weighting_scratch::weight_entry& current :
+         tmp.sorted) {
+
+        const scalar lowerLimitCurv =
+            current.curvature - config.deltaInvHelixDiameter;
+        const scalar upperLimitCurv =
+            current.curvature + config.deltaInvHelixDiameter;
+        while ((window_begin < n) &&
+               (tmp.sorted[window_begin].curvature < lowerLimitCurv)) {
+            if (window_begin < window_end) {
+                tmp.in_window[tmp.sorted[window_begin].index - first_index] =
+                    0;
+            }
+            ++window_begin;
+        }
+        window_end = std::max(window_end, window_begin);
+        while ((window_end < n) &&
+               !(tmp.sorted[window_end].curvature > upperLimitCurv)) {
+            tmp.in_window[tmp.sorted[window_end].index - first_index] = 1;
+            ++window_end;
+        }
+
+        // Find the compatible triplets in the window, in index order. Start
+        // from the window's lowest index, and stop once all members of the
+        // window were seen.
+        unsigned int lowest_index = current.index;
+        for (std::size_t i = window_begin; i < window_end; ++i) {
+            lowest_index = std::min(lowest_index, tmp.sorted[i].index);
+        }
+        triplet& current_triplet = triplets[current.index];
+        tmp.compatible_radii.clear();
+        std::size_t n_remaining = window_end - window_begin;
+        for (std::size_t i = lowest_index - first_index; n_remaining > 0u;
+             ++i) {
+            if (!tmp.in_window[i]) {
+                continue;
+            }
+            --n_remaining;
+            if (i + first_index == current.index) {
+                continue;
+            }
+            const scalar otherTop_r = tmp.top_radii[i];
+            const scalar deltaR = current.top_radius - otherTop_r;
+            if (std::abs(deltaR) < config.deltaRMin) {
+                continue;
+            }
+            if (add_compatible(config, current_triplet, otherTop_r,
+                               tmp.compatible_radii)) {
+                break;
+            }
+        }
+    }
+}
+
+}  // namespace traccc
@@ -0,0 +1,115 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <vector>
+
+namespace traccc {
+
+/// Resettable, monotonic ("arena") memory resource for scratch memory
+///
+/// Allocations are served by bumping a pointer inside of large blocks taken
+/// from an upstream memory resource. Deallocations are no-ops, the memory is
+/// only given back all at once, by calling @c reset(). After a reset the
+/// blocks are re-used, so a workload of a stable size would not need to
+/// allocate memory from upstream after its first iteration.
+///
+/// The resource is not thread safe, every thread needs to use its own
+/// instance.
+///
+class scratch_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Allocation statistics of the resource
+    struct statistics {
+        /// Number of allocations served
+        std::size_t n_allocations = 0u;
+        /// Number of bytes allocated
+        std::size_t allocated_bytes = 0u;
+        /// Number of allocations made from the upstream resource
+        std::size_t n_upstream_allocations = 0u;
+        /// Number of bytes allocated from the upstream resource
+        std::size_t upstream_bytes = 0u;
+
+        /// Add the statistics of another resource to this one
+        statistics& operator+=(const statistics& rhs);
+    };
+
+    /// Constructor
+    ///
+    /// @param upstream The memory resource to take memory blocks from
+    /// @param block_size The (minimum) size of the first memory block
+    ///
+    explicit scratch_memory_resource(vecmem::memory_resource& upstream,
+                                     std::size_t block_size = 1024u * 1024u);
+    /// Copy constructor (deleted)
+    scratch_memory_resource(const scratch_memory_resource&) = delete;
+    /// Destructor, giving all memory blocks back to the upstream resource
+    ~scratch_memory_resource() override;
+
+    /// Copy assignment operator (deleted)
+    scratch_memory_resource& operator=(const scratch_memory_resource&) =
+        delete;
+
+    /// Rewind the resource, invalidating all memory allocated from it
+    ///
+    /// If more than one memory block was needed since the last reset, the
+    /// blocks are replaced by a single one of their combined size.
+    ///
+    void reset();
+
+    /// Statistics of all allocations since the construction of the resource
+    const statistics& get_statistics() const { return m_statistics; }
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    /// Allocate memory from the current memory block
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    /// "De-allocate" memory (no-op)
+    void do_deallocate(void* ptr, std::size_t bytes,
+                       std::size_t alignment) override;
+    /// Compare the resource to another one
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// A memory block taken from the upstream resource
+    struct block {
+        /// The start of the block
+        void* ptr;
+        /// The size of the block
+        std::size_t size;
+        /// The number of bytes used from the block
+        std::size_t used;
+    };
+
+    /// Allocate a new block from the upstream resource
+    block allocate_block(std::size_t size);
+
+    /// The upstream memory resource
+    vecmem::memory_resource* m_upstream;
+    /// The memory blocks taken from the upstream resource
+    std::vector<block> m_blocks;
+    /// The index of the block that allocations are served from
+    std::size_t m_current_block = 0u;
+    /// Size of the next block to take from the upstream resource
+    std::size_t m_block_size;
+    /// Allocation statistics
+    statistics m_statistics;
+
+};  // class scratch_memory_resource
+
+}  // namespace traccc
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,12 +8,44 @@
 // Library include(s).
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 
+#include "traccc/clusterization/details/dbscan.hpp"
+#include "traccc/clusterization/details/measurement_creation.hpp"
+#include "traccc/clusterization/details/sparse_ccl.hpp"
+#include "traccc/clusterization/details/sparse_ccl_runs.hpp"
+#include "traccc/sanity/contiguous_on.hpp"
+#include "traccc/utils/projections.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/synchronized_memory_resource.hpp>
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+// System include(s).
+#include <cassert>
+#include <numeric>
+#include <vector>
+
 namespace traccc::host {
 
 clusterization_algorithm::clusterization_algorithm(
     vecmem::memory_resource& mr, std::unique_ptr<const Logger> logger)
+    : clusterization_algorithm(config_type{}, mr, std::move(logger)) {}
+
+clusterization_algorithm::clusterization_algorithm(
+    const config_type& config, vecmem::memory_resource& mr,
+    std::unique_ptr<const Logger> logger)
     : messaging(logger->clone()),
+      m_config(config),
       m_cc(mr, logger->cloneWithSuffix("CclAlg")),
+      m_cc_runs(mr, logger->cloneWithSuffix("CclRunsAlg")),
+      m_dbscan(config.dbscan_params, mr,
+               logger->cloneWithSuffix("DbscanAlg")),
       m_mc(mr, logger->cloneWithSuffix("MeasurementCreationAlg")),
       m_mr(mr) {}
 
@@ -21,28 +53,142 @@ clusterization_algorithm::output_type clusterization_algorithm::operator()(
     const edm::silicon_cell_collection::const_view& cells_view,
     const silicon_detector_description::const_view& dd_view) const {
 
-    if (m_useGowerDbscan) {
-        // 1. Extract features from cells_view (implement this utility)
-        std::vector<std::vector<double>> features = extract_features_for_gower(cells_view);
+    // Process the modules in parallel, if requested.
+    if (m_config.parallel) {
+        return parallel_clusterization(cells_view, dd_view);
+    }
+
+    // Find the clusters with the configured engine.
+    const edm::silicon_cluster_collection::host clusters = [&]() {
+        switch (m_config.mode) {
+            case ClusteringMode::CCL_RUNS:
+                return m_cc_runs(cells_view);
+            case ClusteringMode::DBSCAN_GOWER:
+                return m_dbscan(cells_view);
+            default:
+                return m_cc(cells_view);
+        }
+    }();
 
-        // 2. Set DBSCAN params
-        DBSCANGowerAlgorithm::Params params{.eps=0.3, .minPts=5};
+    // Create the measurements out of the clusters.
+    const auto clusters_data = vecmem::get_data(clusters);
+    return m_mc(cells_view, clusters_data, dd_view);
+}
+
+clusterization_algorithm::output_type
+clusterization_algorithm::parallel_clusterization(
+    const edm::silicon_cell_collection::const_view& cells_view,
+    const silicon_detector_description::const_view& dd_view) const {
 
-        // 3. Run clustering
-        auto labels = m_dbscanGower.cluster(features, params);
+    // Create device containers for the inputs.
+    const edm::silicon_cell_collection::const_device cells{cells_view};
+    const silicon_detector_description::const_device det_descr{dd_view};
 
-        // 4. Convert labels to your expected clusters_data format
-        auto clusters_data = convert_labels_to_clusters(labels, cells_view);
+    // Run some sanity checks on the cells.
+    assert(is_contiguous_on(cell_module_projection(), cells));
 
-        // 5. Continue as before
-        return m_mc(cells_view, clusters_data, dd_view);
-    } else {
-        // Default (existing) flow
-        const sparse_ccl_algorithm::output_type clusters = m_cc(cells_view);
-        const auto clusters_data = vecmem::get_data(clusters);
-        return m_mc(cells_view, clusters_data, dd_view);
+    // Find the boundaries of the modules.
+    const unsigned int n_cells = cells.size();
+    const auto& module_index = cells.module_index();
+    std::vector<unsigned int> module_begins;
+    for (unsigned int i = 0; i < n_cells; ++i) {
+        if ((i == 0u) || (module_index[i] != module_index[i - 1u])) {
+            module_begins.push_back(i);
+        }
     }
-}
+    const std::size_t n_modules = module_begins.size();
+    module_begins.push_back(n_cells);
+    TRACCC_DEBUG("Clusterizing " << n_cells << " cells on " << n_modules
+                                 << " modules in parallel");
+
+    // The arena that the parallel loops are executed in.
+    tbb::task_arena arena(m_config.max_threads > 0u
+                              ? static_cast<int>(m_config.max_threads)
+                              : tbb::task_arena::automatic);
+
+    // Cluster index of every cell, within its own module. And the number of
+    // clusters per module, stored one element "to the right", so that it
+    // could be turned into the cluster offsets of the modules in place.
+    vecmem::vector<unsigned int> labels(n_cells, &(m_mr.get()));
+    std::vector<unsigned int> cluster_offsets(n_modules + 1u, 0u);
+
+    // Find the clusters of every module.
+    arena.execute([&]() {
+        tbb::enumerable_thread_specific<details::dbscan_module_data>
+            dbscan_data;
+        tbb::enumerable_thread_specific<details::ccl_run_data> run_data;
+        tbb::parallel_for(
+            tbb::blocked_range<std::size_t>(0u, n_modules),
+            [&](const tbb::blocked_range<std::size_t>& range) {
+                vecmem::device_vector<unsigned int> labels_device{
+                    vecmem::get_data(labels)};
+                for (std::size_t m = range.begin(); m != range.end(); ++m) {
+                    const unsigned int begin = module_begins[m];
+                    const unsigned int end = module_begins[m + 1u];
+                    switch (m_config.mode) {
+                        case ClusteringMode::CCL_RUNS:
+                            cluster_offsets[m + 1u] = details::sparse_ccl_runs(
+                                cells, begin, end, run_data.local(),
+                                labels_device);
+                            break;
+                        case ClusteringMode::DBSCAN_GOWER:
+                            cluster_offsets[m + 1u] = details::dbscan_module(
+                                cells, begin, end, m_config.dbscan_params,
+                                dbscan_data.local(), labels_device, 0u);
+                            break;
+                        default:
+                            cluster_offsets[m + 1u] = details::sparse_ccl(
+                                cells, begin, end, labels_device);
+                            break;
+                    }
+                }
+            });
+    });
+
+    // Turn the cluster counts into offsets.
+    std::partial_sum(cluster_offsets.begin(), cluster_offsets.end(),
+                     cluster_offsets.begin());
+    TRACCC_DEBUG("Found " << cluster_offsets.back() << " clusters");
+
+    // Create the result object.
+    output_type result(cluster_offsets.back(), &(m_mr.get()));
+
+    // Create the measurements of every module. The clusters of the module
+    // ranges are allocated concurrently, so the memory resource needs to be
+    // synchronized for them.
+    vecmem::synchronized_memory_resource cluster_mr{m_mr.get()};
+    arena.execute([&]() {
+        tbb::parallel_for(
+            tbb::blocked_range<std::size_t>(0u, n_modules),
+            [&](const tbb::blocked_range<std::size_t>& range) {
+                measurement_collection_types::device measurements{
+                    vecmem::get_data(result)};
+
+                // Collect the clusters of this range of modules.
+                const unsigned int first_cluster =
+                    cluster_offsets[range.begin()];
+                edm::silicon_cluster_collection::host clusters{cluster_mr};
+                clusters.resize(cluster_offsets[range.end()] - first_cluster);
+                for (std::size_t m = range.begin(); m != range.end(); ++m) {
+                    const unsigned int offset =
+                        cluster_offsets[m] - first_cluster;
+                    for (unsigned int i = module_begins[m];
+                         i < module_begins[m + 1u]; ++i) {
+                        clusters.cell_indices()[offset + labels[i]].push_back(
+                            i);
+                    }
+                }
+
+                // Turn them into measurements.
+                for (unsigned int i = 0; i < clusters.size(); ++i) {
+                    details::fill_measurement(measurements, first_cluster + i,
+                                              clusters.at(i), cells,
+                                              det_descr);
+                }
+            });
+    });
+
+    return result;
 }
 
 }  // namespace traccc::host
@@ -0,0 +1,67 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/clusterization/dbscan_algorithm.hpp"
+
+#include "traccc/clusterization/details/dbscan.hpp"
+#include "traccc/sanity/contiguous_on.hpp"
+#include "traccc/utils/projections.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <stdexcept>
+
+namespace traccc::host {
+
+dbscan_algorithm::dbscan_algorithm(const dbscan_config& config,
+                                   vecmem::memory_resource& mr,
+                                   std::unique_ptr<const Logger> logger)
+    : messaging(std::move(logger)), m_config(config), m_mr(mr) {
+
+    if ((m_config.channel0_range <= 0.f) || (m_config.channel1_range <= 0.f)) {
+        throw std::invalid_argument(
+            "DBSCAN channel ranges must be positive numbers");
+    }
+}
+
+dbscan_algorithm::output_type dbscan_algorithm::operator()(
+    const edm::silicon_cell_collection::const_view& cells_view) const {
+
+    // Construct the device view of the cells.
+    const edm::silicon_cell_collection::const_device cells{cells_view};
+
+    // Run some sanity checks on it.
+    assert(is_contiguous_on(cell_module_projection(), cells));
+
+    // Run DBSCAN to fill the cluster indices.
+    vecmem::vector<unsigned int> cluster_indices{cells.size(), &(m_mr.get())};
+    vecmem::device_vector<unsigned int> cluster_indices_device{
+        vecmem::get_data(cluster_indices)};
+    const unsigned int num_clusters =
+        details::dbscan(cells, m_config, cluster_indices_device);
+    TRACCC_DEBUG("Found " << num_clusters << " clusters in " << cells.size()
+                          << " cells");
+
+    // Create the result container.
+    output_type clusters{m_mr.get()};
+    clusters.resize(num_clusters);
+
+    // Add cells to their clusters.
+    for (unsigned int cell_idx = 0; cell_idx < cluster_indices.size();
+         ++cell_idx) {
+        clusters.cell_indices()[cluster_indices[cell_idx]].push_back(cell_idx);
+    }
+
+    // Return the clusters.
+    return clusters;
+}
+
+}  // namespace traccc::host
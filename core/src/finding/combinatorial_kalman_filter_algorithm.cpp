@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2024 CERN for the benefit of the ACTS project
+ * (c) 2024-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,8 @@
 // Local include(s).
 #include "traccc/finding/combinatorial_kalman_filter_algorithm.hpp"
 
+#include "combinatorial_kalman_filter_workspace_pool.hpp"
+
 // System include(s).
 #include <stdexcept>
 
@@ -16,7 +18,10 @@ namespace traccc::host {
 combinatorial_kalman_filter_algorithm::combinatorial_kalman_filter_algorithm(
     const config_type& config, vecmem::memory_resource& mr,
     std::unique_ptr<const Logger> logger)
-    : messaging(std::move(logger)), m_config{config}, m_mr{mr} {
+    : messaging(std::move(logger)),
+      m_config{config},
+      m_mr{mr},
+      m_workspaces{std::make_unique<workspace_pool>(mr)} {
 
     // Check the configuration.
     if (m_config.min_track_candidates_per_track == 0) {
@@ -26,4 +31,14 @@ combinatorial_kalman_filter_algorithm::combinatorial_kalman_filter_algorithm(
     }
 }
 
+combinatorial_kalman_filter_algorithm::combinatorial_kalman_filter_algorithm(
+    combinatorial_kalman_filter_algorithm&&) noexcept = default;
+
+combinatorial_kalman_filter_algorithm::
+    ~combinatorial_kalman_filter_algorithm() = default;
+
+combinatorial_kalman_filter_algorithm&
+combinatorial_kalman_filter_algorithm::operator=(
+    combinatorial_kalman_filter_algorithm&&) noexcept = default;
+
 }  // namespace traccc::host
@@ -9,6 +9,8 @@
 #include "traccc/finding/combinatorial_kalman_filter_algorithm.hpp"
 #include "traccc/finding/details/combinatorial_kalman_filter.hpp"
 
+#include "combinatorial_kalman_filter_workspace_pool.hpp"
+
 namespace traccc::host {
 
 combinatorial_kalman_filter_algorithm::output_type
@@ -19,9 +21,13 @@ combinatorial_kalman_filter_algorithm::operator()(
     const measurement_collection_types::const_view& measurements,
     const bound_track_parameters_collection_types::const_view& seeds) const {
 
+    // Take a workspace for the event from the pool.
+    workspace_pool::lease ws{*m_workspaces};
+
     // Perform the track finding using the templated implementation.
     return details::combinatorial_kalman_filter(det, field, measurements, seeds,
-                                                m_config, m_mr.get(), logger());
+                                                m_config, ws.get(), m_mr.get(),
+                                                logger());
 }
 
 }  // namespace traccc::host
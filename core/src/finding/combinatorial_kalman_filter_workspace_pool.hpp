@@ -0,0 +1,98 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/finding/combinatorial_kalman_filter_algorithm.hpp"
+#include "traccc/finding/details/combinatorial_kalman_filter_workspace.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace traccc::host {
+
+/// Pool of the workspaces of the track finding algorithm
+///
+/// Every event processed by the algorithm takes a workspace from the pool
+/// for the duration of its processing. So a workspace is only created for
+/// every concurrently processed event, and is re-used for the subsequent
+/// ones.
+///
+struct combinatorial_kalman_filter_algorithm::workspace_pool {
+
+    /// The workspace type
+    using workspace_type =
+        details::combinatorial_kalman_filter_workspace<default_algebra>;
+
+    /// Constructor
+    explicit workspace_pool(vecmem::memory_resource& mr) : m_mr{mr} {}
+
+    /// Workspace taken from the pool for the lifetime of the object
+    class lease {
+        public:
+        /// Constructor
+        explicit lease(workspace_pool& owner)
+            : m_owner(owner), m_ws(owner.acquire()) {}
+        /// Copy constructor (deleted)
+        lease(const lease&) = delete;
+        /// Destructor
+        ~lease() { m_owner.release(m_ws); }
+
+        /// Copy assignment operator (deleted)
+        lease& operator=(const lease&) = delete;
+
+        /// The leased workspace
+        workspace_type& get() { return m_ws; }
+
+        private:
+        /// The pool owning the workspace
+        workspace_pool& m_owner;
+        /// The leased workspace
+        workspace_type& m_ws;
+    };
+
+    /// Take a workspace from the pool
+    ///
+    /// @return A workspace that no other thread uses
+    ///
+    workspace_type& acquire() {
+        std::lock_guard lock{m_mutex};
+        if (m_free.empty()) {
+            m_workspaces.push_back(std::make_unique<workspace_type>(m_mr));
+            return *(m_workspaces.back());
+        }
+        workspace_type* result = m_free.back();
+        m_free.pop_back();
+        return *result;
+    }
+
+    /// Give a workspace back to the pool
+    ///
+    /// @param ws The workspace to give back
+    ///
+    void release(workspace_type& ws) {
+        std::lock_guard lock{m_mutex};
+        m_free.push_back(&ws);
+    }
+
+    /// The memory resource of the workspaces
+    vecmem::memory_resource& m_mr;
+    /// All workspaces created so far
+    std::vector<std::unique_ptr<workspace_type>> m_workspaces;
+    /// The workspaces not used by any thread at the moment
+    std::vector<workspace_type*> m_free;
+    /// Mutex protecting the pool
+    std::mutex m_mutex;
+};
+
+}  // namespace traccc::host
@@ -9,20 +9,33 @@
 
 // Local include(s).
 #include "traccc/seeding/detail/doublet.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/spacepoint_type.hpp"
-#include "traccc/seeding/doublet_finding_helper.hpp"
+#include "traccc/seeding/doublet_finding_batch_helper.hpp"
 #include "traccc/utils/messaging.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s).
-#include <functional>
-#include <utility>
+#include <cstddef>
+#include <memory>
 
 namespace traccc::host::details {
 
+/// Scratch space of the doublet finding, re-used between middle spacepoints
+struct doublet_finding_scratch {
+    /// Constructor
+    explicit doublet_finding_scratch(vecmem::memory_resource& mr)
+        : compatible(&mr), candidates(&mr) {}
+
+    /// Compatibility flags of the spacepoints of one bin
+    vecmem::vector<unsigned char> compatible;
+    /// Flat indices of the compatible spacepoints of one bin
+    vecmem::vector<unsigned int> candidates;
+};
+
 /// Doublet finding to search the combinations of two compatible spacepoints
 /// @tparam otherSpType is whether it is for middle-bottom or middle-top doublet
 template <traccc::details::spacepoint_type otherSpType>
@@ -37,83 +50,97 @@ struct doublet_finding : public messaging {
     /// @param config is the configuration parameters
     ///
     doublet_finding(
-        const seedfinder_config& config, vecmem::memory_resource& mr,
+        const seedfinder_config& config,
         std::unique_ptr<const Logger> logger = getDummyLogger().clone())
-        : messaging(std::move(logger)), m_config{config}, m_mr{mr} {}
+        : messaging(std::move(logger)), m_config{config} {}
 
     /// Callable operator for doublet finding per middle spacepoint
     ///
-    /// @param spacepoints The spacepoint container
-    /// @param sp_grid The spacepoint grid
-    /// @param middle_sp The middle spacepoint to find doublets for
-    /// @return A pair of vectors of doublets and transformed coordinates
+    /// The output collections are cleared before being filled, so that they
+    /// could be re-used (without new allocations) between middle spacepoints.
     ///
-    std::pair<doublet_collection_types::host, lin_circle_collection_types::host>
-    operator()(const edm::spacepoint_collection::const_device& spacepoints,
-               const traccc::details::spacepoint_grid_types::host& sp_grid,
-               const sp_location& middle_location) const {
+    /// @param[in] sp_grid The spacepoint grid
+    /// @param[in] middle_location The middle spacepoint to find doublets for
+    /// @param[out] doublets The doublets found
+    /// @param[out] lin_circles The transformed coordinates of the doublets
+    /// @param[in,out] tmp Scratch space to use
+    ///
+    void operator()(const traccc::details::flat_spacepoint_grid& sp_grid,
+                    const sp_location& middle_location,
+                    doublet_collection_types::host& doublets,
+                    lin_circle_collection_types::host& lin_circles,
+                    doublet_finding_scratch& tmp) const {
 
-        // Create the result object.
-        auto result =
-            std::make_pair(doublet_collection_types::host{&(m_mr.get())},
-                           lin_circle_collection_types::host{&(m_mr.get())});
+        // Reset the output.
+        doublets.clear();
+        lin_circles.clear();
 
         // Access the middle spacepoint.
-        const edm::spacepoint_collection::const_device::const_proxy_type
-            middle_sp = spacepoints.at(
-                sp_grid.bin(middle_location.bin_idx)[middle_location.sp_idx]);
+        const unsigned int middle_index = sp_grid.flat_index(middle_location);
+        const traccc::details::binned_spacepoint middle_sp =
+            sp_grid.at(middle_index);
 
         // Get the Phi/Z bins in which to look for the other spacepoint of the
         // doublet.
         const detray::dindex_sequence phi_bins =
             sp_grid.axis_p0().zone(middle_sp.phi(), m_config.neighbor_scope);
-        const detray::dindex_sequence z_bins =
-            sp_grid.axis_p1().zone(middle_sp.z(), m_config.neighbor_scope);
+        const darray<unsigned int, 2> z_bins = sp_grid.z_neighbors(
+            middle_location.bin_idx / sp_grid.axis_p0().bins());
 
         // Iterate over neighbor bins.
         for (detray::dindex phi_bin : phi_bins) {
-            for (detray::dindex z_bin : z_bins) {
+            for (unsigned int z_bin = z_bins[0]; z_bin < z_bins[1]; ++z_bin) {
 
                 // Get the global index for this bin.
-                const detray::dindex bin_idx =
-                    phi_bin + z_bin * sp_grid.axis_p0().bins();
-
-                // Get the indices of the spacepoints in this bin.
-                traccc::details::spacepoint_grid_types::host::
-                    serialized_storage::const_reference sp_indices =
-                        sp_grid.bin(phi_bin, z_bin);
-                for (unsigned int i = 0; unsigned int sp_index : sp_indices) {
-
-                    // Access the other spacepoint.
-                    const edm::spacepoint_collection::const_device::
-                        const_proxy_type other_sp = spacepoints.at(sp_index);
-
-                    // Check if the spacepoints are compatible.
-                    if (doublet_finding_helper::isCompatible<otherSpType>(
-                            middle_sp, other_sp, m_config)) {
-
-                        // If so, create a doublet for them.
-                        result.first.push_back(
-                            {middle_location,
-                             {static_cast<unsigned int>(bin_idx), i}});
-                        result.second.push_back(
-                            doublet_finding_helper::transform_coordinates<
-                                otherSpType>(middle_sp, other_sp));
-                    }
-                    ++i;
+                const unsigned int bin_idx = static_cast<unsigned int>(
+                    phi_bin + z_bin * sp_grid.axis_p0().bins());
+
+                // The spacepoints of this bin are stored contiguously in the
+                // grid.
+                const unsigned int bin_begin = sp_grid.bin_begin(bin_idx);
+                const unsigned int bin_end = sp_grid.bin_end(bin_idx);
+                const unsigned int bin_size = bin_end - bin_begin;
+                if (bin_size == 0u) {
+                    continue;
+                }
+
+                // Check which of them are compatible with the middle
+                // spacepoint, all in one go.
+                tmp.compatible.resize(bin_size);
+                doublet_finding_batch_helper::isCompatible<otherSpType>(
+                    sp_grid, middle_index, bin_begin, bin_end, m_config,
+                    tmp.compatible.data());
+
+                // Collect the compatible ones, without branching.
+                tmp.candidates.resize(bin_size);
+                unsigned int n_candidates = 0u;
+                for (unsigned int i = 0; i < bin_size; ++i) {
+                    tmp.candidates[n_candidates] = bin_begin + i;
+                    n_candidates += tmp.compatible[i];
+                }
+                if (n_candidates == 0u) {
+                    continue;
                 }
+
+                // Create doublets for them.
+                const std::size_t first_doublet = doublets.size();
+                for (unsigned int i = 0; i < n_candidates; ++i) {
+                    doublets.push_back(
+                        {middle_location,
+                         {bin_idx, tmp.candidates[i] - bin_begin}});
+                }
+                lin_circles.resize(first_doublet + n_candidates);
+                doublet_finding_batch_helper::transform_coordinates<
+                    otherSpType>(sp_grid, middle_index, tmp.candidates.data(),
+                                 n_candidates,
+                                 lin_circles.data() + first_doublet);
             }
         }
-
-        // Return the result.
-        return result;
     }
 
     private:
     /// The doublet finding configuration parameters
     seedfinder_config m_config;
-    /// The memory resource
-    std::reference_wrapper<vecmem::memory_resource> m_mr;
 };
 
 }  // namespace traccc::host::details
@@ -0,0 +1,199 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <numeric>
+
+namespace traccc::details {
+
+flat_spacepoint_grid::flat_spacepoint_grid(
+    const axis_p0_type& axis_p0, const axis_p1_type& axis_p1,
+    const darray<unsigned int, 2>& neighbor_scope, vecmem::memory_resource& mr)
+    : m_axis_p0(axis_p0),
+      m_axis_p1(axis_p1),
+      m_z_edges(&mr),
+      m_z_neighbors(&mr),
+      m_bin_offsets(axis_p0.bins() * axis_p1.bins() + 1u, 0u, &mr),
+      m_sp_indices(&mr),
+      m_x(&mr),
+      m_y(&mr),
+      m_z(&mr),
+      m_radius(&mr),
+      m_phi(&mr),
+      m_z_variance(&mr),
+      m_radius_variance(&mr) {
+
+    // The neighbours of the uniform bins are the ones within the configured
+    // scope.
+    const unsigned int n_z_bins = z_bins();
+    m_z_neighbors.resize(2u * n_z_bins);
+    for (unsigned int i = 0; i < n_z_bins; ++i) {
+        m_z_neighbors[2u * i] =
+            i - std::min(i, static_cast<unsigned int>(neighbor_scope[0]));
+        m_z_neighbors[2u * i + 1u] =
+            std::min(i + static_cast<unsigned int>(neighbor_scope[1]) + 1u,
+                     n_z_bins);
+    }
+}
+
+flat_spacepoint_grid::flat_spacepoint_grid(
+    const axis_p0_type& axis_p0, const axis_p1_type& axis_p1,
+    std::span<const scalar> z_edges,
+    const darray<unsigned int, 2>& neighbor_scope, vecmem::memory_resource& mr)
+    : m_axis_p0(axis_p0),
+      m_axis_p1(axis_p1),
+      m_z_edges(z_edges.begin(), z_edges.end(), &mr),
+      m_z_neighbors(&mr),
+      m_bin_offsets(axis_p0.bins() * (z_edges.size() - 1u) + 1u, 0u, &mr),
+      m_sp_indices(&mr),
+      m_x(&mr),
+      m_y(&mr),
+      m_z(&mr),
+      m_radius(&mr),
+      m_phi(&mr),
+      m_z_variance(&mr),
+      m_radius_variance(&mr) {
+
+    assert(z_edges.size() >= 2u);
+    assert(std::is_sorted(z_edges.begin(), z_edges.end()));
+
+    // The neighbours of every bin are the bins overlapping with the range
+    // that the uniform bins would reach around it.
+    const scalar reach = (z_edges.back() - z_edges.front()) /
+                         static_cast<scalar>(axis_p1.bins());
+    const unsigned int n_z_bins = z_bins();
+    m_z_neighbors.resize(2u * n_z_bins);
+    for (unsigned int i = 0; i < n_z_bins; ++i) {
+        m_z_neighbors[2u * i] = z_bin(
+            m_z_edges[i] - static_cast<scalar>(neighbor_scope[0]) * reach);
+        m_z_neighbors[2u * i + 1u] =
+            z_bin(m_z_edges[i + 1u] +
+                  static_cast<scalar>(neighbor_scope[1]) * reach) +
+            1u;
+    }
+}
+
+flat_spacepoint_grid::flat_spacepoint_grid(const flat_spacepoint_grid& parent,
+                                           vecmem::memory_resource& mr)
+    : m_axis_p0(parent.m_axis_p0),
+      m_axis_p1(parent.m_axis_p1),
+      m_z_edges(parent.m_z_edges, &mr),
+      m_z_neighbors(parent.m_z_neighbors, &mr),
+      m_bin_offsets(parent.m_bin_offsets.size(), 0u, &mr),
+      m_sp_indices(&mr),
+      m_x(&mr),
+      m_y(&mr),
+      m_z(&mr),
+      m_radius(&mr),
+      m_phi(&mr),
+      m_z_variance(&mr),
+      m_radius_variance(&mr) {}
+
+flat_spacepoint_grid flat_spacepoint_grid::empty_copy(
+    vecmem::memory_resource& mr) const {
+
+    return flat_spacepoint_grid{*this, mr};
+}
+
+void flat_spacepoint_grid::fill(
+    const edm::spacepoint_collection::const_device& spacepoints,
+    const vecmem::vector<unsigned int>& sp_bins) {
+
+    assert(sp_bins.size() == spacepoints.size());
+
+    // Count the spacepoints in each bin. The counts are stored shifted by one
+    // element, so that an inclusive scan would turn them into offsets.
+    std::fill(m_bin_offsets.begin(), m_bin_offsets.end(), 0u);
+    for (unsigned int bin : sp_bins) {
+        if (bin != invalid_bin) {
+            assert(bin < nbins());
+            ++m_bin_offsets[bin + 1u];
+        }
+    }
+    std::inclusive_scan(m_bin_offsets.begin(), m_bin_offsets.end(),
+                        m_bin_offsets.begin());
+
+    // Allocate the flat arrays.
+    resize(m_bin_offsets.back());
+
+    // Scatter the spacepoints into their bins, using a running "fill
+    // position" for every bin.
+    vecmem::vector<unsigned int> positions(
+        m_bin_offsets.begin(), m_bin_offsets.end() - 1,
+        m_bin_offsets.get_allocator().resource());
+    for (unsigned int i = 0; i < spacepoints.size(); ++i) {
+
+        const unsigned int bin = sp_bins[i];
+        if (bin == invalid_bin) {
+            continue;
+        }
+        set(positions[bin]++, spacepoints, i);
+    }
+}
+
+void flat_spacepoint_grid::fill(
+    const edm::spacepoint_collection::const_device& spacepoints,
+    std::span<const unsigned int> sp_indices,
+    std::span<const unsigned int> sp_bins) {
+
+    assert(sp_indices.size() == sp_bins.size());
+
+    // Count the spacepoints in each bin, and calculate the bin offsets.
+    std::fill(m_bin_offsets.begin(), m_bin_offsets.end(), 0u);
+    for (unsigned int bin : sp_bins) {
+        assert(bin < nbins());
+        ++m_bin_offsets[bin + 1u];
+    }
+    std::inclusive_scan(m_bin_offsets.begin(), m_bin_offsets.end(),
+                        m_bin_offsets.begin());
+
+    // Allocate the flat arrays.
+    resize(m_bin_offsets.back());
+
+    // Scatter the selected spacepoints into their bins.
+    vecmem::vector<unsigned int> positions(
+        m_bin_offsets.begin(), m_bin_offsets.end() - 1,
+        m_bin_offsets.get_allocator().resource());
+    for (std::size_t i = 0; i < sp_indices.size(); ++i) {
+        set(positions[sp_bins[i]]++, spacepoints, sp_indices[i]);
+    }
+}
+
+void flat_spacepoint_grid::resize(unsigned int size) {
+
+    m_sp_indices.resize(size);
+    m_x.resize(size);
+    m_y.resize(size);
+    m_z.resize(size);
+    m_radius.resize(size);
+    m_phi.resize(size);
+    m_z_variance.resize(size);
+    m_radius_variance.resize(size);
+}
+
+void flat_spacepoint_grid::set(
+    unsigned int index,
+    const edm::spacepoint_collection::const_device& spacepoints,
+    unsigned int sp_index) {
+
+    const edm::spacepoint_collection::const_device::const_proxy_type sp =
+        spacepoints.at(sp_index);
+    m_sp_indices[index] = sp_index;
+    m_x[index] = sp.x();
+    m_y[index] = sp.y();
+    m_z[index] = sp.z();
+    m_radius[index] = sp.radius();
+    m_phi[index] = sp.phi();
+    m_z_variance[index] = sp.z_variance();
+    m_radius_variance[index] = sp.radius_variance();
+}
+
+}  // namespace traccc::details
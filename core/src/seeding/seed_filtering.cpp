@@ -17,41 +17,25 @@
 namespace traccc::host::details {
 
 seed_filtering::seed_filtering(const seedfilter_config& config,
-                               vecmem::memory_resource& mr,
                                std::unique_ptr<const Logger> logger)
-    : messaging(std::move(logger)), m_filter_config(config), m_mr{mr} {}
+    : messaging(std::move(logger)), m_filter_config(config) {}
 
 void seed_filtering::operator()(
     const edm::spacepoint_collection::const_device& spacepoints,
-    const traccc::details::spacepoint_grid_types::host& sp_grid,
+    const traccc::details::flat_spacepoint_grid& sp_grid,
     triplet_collection_types::host& triplets,
-    edm::seed_collection::host& seeds) const {
+    edm::seed_collection::host& seeds, seed_filtering_scratch& tmp) const {
 
     // Select the triplets passing the "single seed cuts".
-    std::vector<std::reference_wrapper<const triplet>>
-        triplets_passing_single_seed_cuts;
+    vecmem::vector<std::reference_wrapper<const triplet>>&
+        triplets_passing_single_seed_cuts = tmp.passing_single_seed_cuts;
+    triplets_passing_single_seed_cuts.clear();
     triplets_passing_single_seed_cuts.reserve(triplets.size());
     for (triplet& triplet : triplets) {
-        // bottom
-        const sp_location& spB_location = triplet.sp1;
-        const unsigned int spB_idx =
-            sp_grid.bin(spB_location.bin_idx)[spB_location.sp_idx];
-        const edm::spacepoint_collection::const_device::const_proxy_type spB =
-            spacepoints.at(spB_idx);
-
-        // middle
-        const sp_location& spM_location = triplet.sp2;
-        const unsigned int spM_idx =
-            sp_grid.bin(spM_location.bin_idx)[spM_location.sp_idx];
-        const edm::spacepoint_collection::const_device::const_proxy_type spM =
-            spacepoints.at(spM_idx);
-
-        // top
-        const sp_location& spT_location = triplet.sp3;
-        const unsigned int spT_idx =
-            sp_grid.bin(spT_location.bin_idx)[spT_location.sp_idx];
-        const edm::spacepoint_collection::const_device::const_proxy_type spT =
-            spacepoints.at(spT_idx);
+        // Access the spacepoints of the triplet.
+        const traccc::details::binned_spacepoint spB = sp_grid.at(triplet.sp1);
+        const traccc::details::binned_spacepoint spM = sp_grid.at(triplet.sp2);
+        const traccc::details::binned_spacepoint spT = sp_grid.at(triplet.sp3);
 
         // Updat the triplet weight in-situ.
         seed_selecting_helper::seed_weight(m_filter_config, spM, spB, spT,
@@ -68,15 +52,14 @@ void seed_filtering::operator()(
     }
 
     // sort seeds based on their weights
-    const traccc::details::spacepoint_grid_types::const_data sp_grid_data =
-        detray::get_data(sp_grid, m_mr.get());
     std::sort(triplets_passing_single_seed_cuts.begin(),
               triplets_passing_single_seed_cuts.end(),
-              traccc::details::triplet_sorter{spacepoints, sp_grid_data});
+              traccc::details::triplet_sorter{spacepoints, sp_grid});
 
     // Select the best ones.
-    std::vector<std::reference_wrapper<const triplet>>
-        triplets_passing_final_cuts;
+    vecmem::vector<std::reference_wrapper<const triplet>>&
+        triplets_passing_final_cuts = tmp.passing_final_cuts;
+    triplets_passing_final_cuts.clear();
     triplets_passing_final_cuts.reserve(
         triplets_passing_single_seed_cuts.size());
 
@@ -92,7 +75,7 @@ void seed_filtering::operator()(
                      m_filter_config.max_triplets_per_spM);
         for (std::size_t i = 1; i < itLength; ++i) {
             if (seed_selecting_helper::cut_per_middle_sp(
-                    m_filter_config, spacepoints, sp_grid_data,
+                    m_filter_config, spacepoints, sp_grid,
                     triplets_passing_single_seed_cuts[i])) {
                 triplets_passing_final_cuts.push_back(
                     triplets_passing_single_seed_cuts[i]);
@@ -106,9 +89,9 @@ void seed_filtering::operator()(
         if (i++ >= m_filter_config.maxSeedsPerSpM) {
             break;
         }
-        seeds.push_back({sp_grid.bin(triplet.sp1.bin_idx)[triplet.sp1.sp_idx],
-                         sp_grid.bin(triplet.sp2.bin_idx)[triplet.sp2.sp_idx],
-                         sp_grid.bin(triplet.sp3.bin_idx)[triplet.sp3.sp_idx]});
+        seeds.push_back({sp_grid.sp_index(triplet.sp1),
+                         sp_grid.sp_index(triplet.sp2),
+                         sp_grid.sp_index(triplet.sp3)});
     }
 }
 
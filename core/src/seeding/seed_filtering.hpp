@@ -10,12 +10,13 @@
 // Library include(s).
 #include "traccc/edm/seed_collection.hpp"
 #include "traccc/edm/spacepoint_collection.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
-#include "traccc/seeding/detail/spacepoint_grid.hpp"
 #include "traccc/seeding/detail/triplet.hpp"
 #include "traccc/utils/messaging.hpp"
 
 // VecMem include(s).
+#include <vecmem/containers/vector.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s).
@@ -23,13 +24,26 @@
 
 namespace traccc::host::details {
 
+/// Scratch space of the seed filtering, re-used between middle spacepoints
+struct seed_filtering_scratch {
+    /// Constructor
+    explicit seed_filtering_scratch(vecmem::memory_resource& mr)
+        : passing_single_seed_cuts(&mr), passing_final_cuts(&mr) {}
+
+    /// Triplets passing the "single seed cuts"
+    vecmem::vector<std::reference_wrapper<const triplet>>
+        passing_single_seed_cuts;
+    /// Triplets passing the final cuts
+    vecmem::vector<std::reference_wrapper<const triplet>> passing_final_cuts;
+};
+
 /// Seed filtering to filter out the bad triplets
 class seed_filtering : public messaging {
 
     public:
     /// Constructor with the seed filter configuration
     seed_filtering(
-        const seedfilter_config& config, vecmem::memory_resource& mr,
+        const seedfilter_config& config,
         std::unique_ptr<const Logger> logger = getDummyLogger().clone());
 
     /// Callable operator for the seed filtering
@@ -39,17 +53,17 @@ class seed_filtering : public messaging {
     /// @param[in,out] triplets is the vector of triplets per middle spacepoint
     /// @param[out] seeds are the vector of seeds where the new compatible seeds
     ///             are added
+    /// @param[in,out] tmp Scratch space to use
     ///
     void operator()(const edm::spacepoint_collection::const_device& spacepoints,
-                    const traccc::details::spacepoint_grid_types::host& sp_grid,
+                    const traccc::details::flat_spacepoint_grid& sp_grid,
                     triplet_collection_types::host& triplets,
-                    edm::seed_collection::host& seeds) const;
+                    edm::seed_collection::host& seeds,
+                    seed_filtering_scratch& tmp) const;
 
     private:
     /// Seed filter configuration
     seedfilter_config m_filter_config;
-    /// The memory resource to use
-    std::reference_wrapper<vecmem::memory_resource> m_mr;
 
 };  // class seed_filtering
 
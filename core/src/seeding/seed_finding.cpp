@@ -12,23 +12,276 @@
 #include "seed_filtering.hpp"
 #include "triplet_finding.hpp"
 
+// Project include(s).
+#include "traccc/utils/scratch_memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/synchronized_memory_resource.hpp>
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace traccc::host::details {
+namespace {
+
+/// Number of middle spacepoints processed by one task in parallel mode
+constexpr unsigned int middle_sp_chunk_size = 64u;
+
+}  // namespace
 
 struct seed_finding::impl {
     /// Constructor
     impl(const seedfinder_config& finder_config,
          const seedfilter_config& filter_config, vecmem::memory_resource& mr,
          std::unique_ptr<const Logger> logger)
-        : m_midBot_finding(finder_config, mr,
-                           logger->cloneWithSuffix("MidBotAlg")),
-          m_midTop_finding(finder_config, mr,
-                           logger->cloneWithSuffix("MidTopAlg")),
-          m_triplet_finding(finder_config, filter_config, mr,
+        : m_sync_mr(mr),
+          m_finder_config(finder_config),
+          m_midBot_finding(finder_config, logger->cloneWithSuffix("MidBotAlg")),
+          m_midTop_finding(finder_config, logger->cloneWithSuffix("MidTopAlg")),
+          m_triplet_finding(finder_config, filter_config,
                             logger->cloneWithSuffix("TripletAlg")),
-          m_seed_filtering(filter_config, mr,
-                           logger->cloneWithSuffix("FilterAlg")),
+          m_seed_filtering(filter_config, logger->cloneWithSuffix("FilterAlg")),
           m_mr{mr} {}
 
+    /// Take a scratch memory resource from the pool, rewinding it
+    ///
+    /// @return A scratch memory resource that no other thread uses
+    ///
+    scratch_memory_resource& acquire_scratch_mr() {
+        std::lock_guard lock{m_scratch_mrs_mutex};
+        scratch_memory_resource* result = nullptr;
+        if (m_free_scratch_mrs.empty()) {
+            m_scratch_mrs.push_back(
+                std::make_unique<scratch_memory_resource>(m_sync_mr));
+            result = m_scratch_mrs.back().get();
+        } else {
+            result = m_free_scratch_mrs.back();
+            m_free_scratch_mrs.pop_back();
+        }
+        result->reset();
+        return *result;
+    }
+
+    /// Give a scratch memory resource back to the pool
+    ///
+    /// @param mr The memory resource to give back
+    ///
+    void release_scratch_mr(scratch_memory_resource& mr) {
+        std::lock_guard lock{m_scratch_mrs_mutex};
+        m_free_scratch_mrs.push_back(&mr);
+    }
+
+    /// Scratch memory resource taken from the pool for the lifetime of the
+    /// object
+    class scratch_mr_lease {
+        public:
+        /// Constructor
+        explicit scratch_mr_lease(impl& owner)
+            : m_owner(owner), m_mr(owner.acquire_scratch_mr()) {}
+        /// Copy constructor (deleted)
+        scratch_mr_lease(const scratch_mr_lease&) = delete;
+        /// Destructor
+        ~scratch_mr_lease() { m_owner.release_scratch_mr(m_mr); }
+
+        /// Copy assignment operator (deleted)
+        scratch_mr_lease& operator=(const scratch_mr_lease&) = delete;
+
+        /// The leased memory resource
+        scratch_memory_resource& mr() { return m_mr; }
+
+        private:
+        /// The pool owning the memory resource
+        impl& m_owner;
+        /// The leased memory resource
+        scratch_memory_resource& m_mr;
+    };
+
+    /// Scratch space used while processing the middle spacepoints
+    ///
+    /// The collections are re-used for all middle spacepoints processed by
+    /// the same thread, so that they would only need to allocate memory while
+    /// they grow. All of their memory comes from a scratch memory resource,
+    /// which is rewound for every event.
+    ///
+    struct scratch {
+        /// Constructor
+        explicit scratch(impl& owner)
+            : lease(owner),
+              mid_bot_doublets(&lease.mr()),
+              mid_bot_lcs(&lease.mr()),
+              mid_top_doublets(&lease.mr()),
+              mid_top_lcs(&lease.mr()),
+              triplets(&lease.mr()),
+              doublet_tmp(lease.mr()),
+              triplet_tmp(lease.mr()),
+              filter_tmp(lease.mr()) {}
+
+        /// The memory resource of the scratch space
+        scratch_mr_lease lease;
+        /// Middle-bottom doublets
+        doublet_collection_types::host mid_bot_doublets;
+        /// Transformed coordinates of the middle-bottom doublets
+        lin_circle_collection_types::host mid_bot_lcs;
+        /// Middle-top doublets
+        doublet_collection_types::host mid_top_doublets;
+        /// Transformed coordinates of the middle-top doublets
+        lin_circle_collection_types::host mid_top_lcs;
+        /// Triplets
+        triplet_collection_types::host triplets;
+        /// Scratch space of the doublet finding
+        doublet_finding_scratch doublet_tmp;
+        /// Scratch space of the triplet finding
+        triplet_finding_scratch triplet_tmp;
+        /// Scratch space of the seed filtering
+        seed_filtering_scratch filter_tmp;
+        /// Statistics collected while processing the middle spacepoints
+        seeding_statistics stats;
+    };
+
+    /// Find the seeds for a single middle spacepoint
+    ///
+    /// @tparam collect_statistics Whether to fill @c scratch::stats
+    ///
+    /// @param[in] spacepoints All spacepoints in the event
+    /// @param[in] sp_grid The spacepoint grid
+    /// @param[in] spM_location The location of the middle spacepoint
+    /// @param[in,out] tmp The scratch space to use
+    /// @param[out] seeds The collection to append the seeds to
+    ///
+    template <bool collect_statistics>
+    void find_seeds(const edm::spacepoint_collection::const_device& spacepoints,
+                    const traccc::details::flat_spacepoint_grid& sp_grid,
+                    const sp_location& spM_location, scratch& tmp,
+                    edm::seed_collection::host& seeds) const {
+
+        // Helper for timing the individual steps.
+        using clock = std::chrono::steady_clock;
+        [[maybe_unused]] clock::time_point start;
+        [[maybe_unused]] const auto lap =
+            [&start](std::chrono::nanoseconds& time) {
+                const clock::time_point now = clock::now();
+                time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    now - start);
+                start = now;
+            };
+        if constexpr (collect_statistics) {
+            start = clock::now();
+        }
+
+        // middule-bottom doublet search
+        m_midBot_finding(sp_grid, spM_location, tmp.mid_bot_doublets,
+                         tmp.mid_bot_lcs, tmp.doublet_tmp);
+
+        if constexpr (collect_statistics) {
+            ++tmp.stats.n_middle_spacepoints;
+            tmp.stats.n_mid_bot_doublets += tmp.mid_bot_doublets.size();
+            seeding_statistics::fill(tmp.stats.mid_bot_doublets_per_middle,
+                                     tmp.mid_bot_doublets.size());
+        }
+
+        if (tmp.mid_bot_doublets.empty()) {
+            if constexpr (collect_statistics) {
+                lap(tmp.stats.doublet_finding_time);
+            }
+            return;
+        }
+
+        // middule-top doublet search
+        m_midTop_finding(sp_grid, spM_location, tmp.mid_top_doublets,
+                         tmp.mid_top_lcs, tmp.doublet_tmp);
+
+        if constexpr (collect_statistics) {
+            lap(tmp.stats.doublet_finding_time);
+            tmp.stats.n_mid_top_doublets += tmp.mid_top_doublets.size();
+            seeding_statistics::fill(tmp.stats.mid_top_doublets_per_middle,
+                                     tmp.mid_top_doublets.size());
+        }
+
+        if (tmp.mid_top_doublets.empty()) {
+            return;
+        }
+
+        // triplet search from the combinations of two doublets which
+        // share middle spacepoint
+        tmp.triplets.clear();
+        for (unsigned int k = 0; k < tmp.mid_bot_doublets.size(); ++k) {
+            m_triplet_finding(sp_grid, tmp.mid_bot_doublets[k],
+                              tmp.mid_bot_lcs[k], tmp.mid_top_doublets,
+                              tmp.mid_top_lcs, tmp.triplets,
+                              tmp.triplet_tmp);
+        }
+
+        [[maybe_unused]] const std::size_t n_seeds_before = seeds.size();
+        if constexpr (collect_statistics) {
+            lap(tmp.stats.triplet_finding_time);
+            ++tmp.stats.n_middle_spacepoints_with_doublets;
+            tmp.stats.n_triplet_candidates +=
+                static_cast<std::uint64_t>(tmp.mid_bot_doublets.size()) *
+                tmp.mid_top_doublets.size();
+            tmp.stats.n_triplets += tmp.triplets.size();
+            seeding_statistics::fill(tmp.stats.triplets_per_middle,
+                                     tmp.triplets.size());
+        }
+
+        // seed filtering
+        m_seed_filtering(spacepoints, sp_grid, tmp.triplets, seeds,
+                         tmp.filter_tmp);
+
+        if constexpr (collect_statistics) {
+            lap(tmp.stats.seed_filtering_time);
+            tmp.stats.n_triplets_passing_single_seed_cuts +=
+                tmp.filter_tmp.passing_single_seed_cuts.size();
+            tmp.stats.n_seeds += seeds.size() - n_seeds_before;
+            seeding_statistics::fill(tmp.stats.seeds_per_middle,
+                                     seeds.size() - n_seeds_before);
+        }
+    }
+
+    /// Find the seeds for a single middle spacepoint
+    ///
+    /// @param[in] spacepoints All spacepoints in the event
+    /// @param[in] sp_grid The spacepoint grid
+    /// @param[in] spM_location The location of the middle spacepoint
+    /// @param[in,out] tmp The scratch space to use
+    /// @param[out] seeds The collection to append the seeds to
+    ///
+    void find_seeds(const edm::spacepoint_collection::const_device& spacepoints,
+                    const traccc::details::flat_spacepoint_grid& sp_grid,
+                    const sp_location& spM_location, scratch& tmp,
+                    edm::seed_collection::host& seeds) const {
+
+        if (m_finder_config.collect_statistics) {
+            find_seeds<true>(spacepoints, sp_grid, spM_location, tmp, seeds);
+        } else {
+            find_seeds<false>(spacepoints, sp_grid, spM_location, tmp, seeds);
+        }
+    }
+
+    /// Add statistics to the ones collected so far
+    ///
+    /// @param stats The statistics to add
+    ///
+    void record_statistics(const seeding_statistics& stats) {
+        std::lock_guard lock{m_statistics_mutex};
+        m_statistics += stats;
+    }
+
+    /// Thread-safe view of the memory resource, used for all allocations
+    /// that may happen concurrently in parallel mode
+    vecmem::synchronized_memory_resource m_sync_mr;
+    /// Seed finding configuration
+    seedfinder_config m_finder_config;
     /// Algorithm performing the mid bottom doublet finding
     doublet_finding<traccc::details::spacepoint_type::bottom> m_midBot_finding;
     /// Algorithm performing the mid top doublet finding
@@ -37,8 +290,20 @@ struct seed_finding::impl {
     triplet_finding m_triplet_finding;
     /// Algorithm performing the seed selection
     seed_filtering m_seed_filtering;
-    /// The memory resource to use
+    /// The memory resource to use for the results
     vecmem::memory_resource& m_mr;
+
+    /// Scratch memory resources, one for every concurrently running thread
+    std::vector<std::unique_ptr<scratch_memory_resource>> m_scratch_mrs;
+    /// Scratch memory resources not used by any thread at the moment
+    std::vector<scratch_memory_resource*> m_free_scratch_mrs;
+    /// Mutex protecting the scratch memory resource pool
+    std::mutex m_scratch_mrs_mutex;
+
+    /// Statistics collected so far
+    seeding_statistics m_statistics;
+    /// Mutex protecting the statistics
+    std::mutex m_statistics_mutex;
 };
 
 seed_finding::seed_finding(const seedfinder_config& finder_config,
@@ -55,9 +320,36 @@ seed_finding::~seed_finding() = default;
 
 seed_finding& seed_finding::operator=(seed_finding&&) noexcept = default;
 
+scratch_memory_resource::statistics seed_finding::scratch_statistics() const {
+
+    std::lock_guard lock{m_impl->m_scratch_mrs_mutex};
+    scratch_memory_resource::statistics result;
+    for (const std::unique_ptr<scratch_memory_resource>& mr :
+         m_impl->m_scratch_mrs) {
+        result += mr->get_statistics();
+    }
+    return result;
+}
+
+seeding_statistics seed_finding::statistics() const {
+
+    std::lock_guard lock{m_impl->m_statistics_mutex};
+    return m_impl->m_statistics;
+}
+
+void seed_finding::record_statistics(const seeding_statistics& stats) const {
+
+    m_impl->record_statistics(stats);
+}
+
 edm::seed_collection::host seed_finding::operator()(
     const edm::spacepoint_collection::const_view& sp_view,
-    const traccc::details::spacepoint_grid_types::host& sp_grid) const {
+    const traccc::details::flat_spacepoint_grid& sp_grid) const {
+
+    // Process the middle spacepoints in parallel, if requested.
+    if (m_impl->m_finder_config.parallel) {
+        return parallel_seed_finding(sp_view, sp_grid);
+    }
 
     // Create the result collection.
     edm::seed_collection::host seeds{m_impl->m_mr};
@@ -65,57 +357,106 @@ edm::seed_collection::host seed_finding::operator()(
     // Create a device container for the spacepoints.
     const edm::spacepoint_collection::const_device spacepoints{sp_view};
 
+    // Scratch space for all middle spacepoints.
+    impl::scratch tmp{*m_impl};
+
     // Iterate over the spacepoint grid's bins.
     for (unsigned int i = 0; i < sp_grid.nbins(); ++i) {
 
         // Consider all spacepoints in this bin as "middle" spacepoints in the
         // seed.
-        const auto& middle_indices = sp_grid.bin(i);
+        const unsigned int n_middle = sp_grid.bin_end(i) - sp_grid.bin_begin(i);
 
         // Evaluate these middle spacepoints one-by-one.
-        for (unsigned int j = 0; j < middle_indices.size(); ++j) {
-
-            // Internal identifier for this middle spacepoint.
-            sp_location spM_location({i, j});
-
-            // middule-bottom doublet search
-            const auto mid_bot =
-                m_impl->m_midBot_finding(spacepoints, sp_grid, spM_location);
-
-            if (mid_bot.first.empty()) {
-                continue;
-            }
-
-            // middule-top doublet search
-            const auto mid_top =
-                m_impl->m_midTop_finding(spacepoints, sp_grid, spM_location);
+        for (unsigned int j = 0; j < n_middle; ++j) {
+            m_impl->find_seeds(spacepoints, sp_grid, {i, j}, tmp, seeds);
+        }
+    }
 
-            if (mid_top.first.empty()) {
-                continue;
-            }
+    // Record the statistics of the event, if requested.
+    if (m_impl->m_finder_config.collect_statistics) {
+        m_impl->record_statistics(tmp.stats);
+    }
 
-            triplet_collection_types::host triplets{&m_impl->m_mr};
+    return seeds;
+}
 
-            // triplet search from the combinations of two doublets which
-            // share middle spacepoint
-            for (unsigned int k = 0; k < mid_bot.first.size(); ++k) {
+edm::seed_collection::host seed_finding::parallel_seed_finding(
+    const edm::spacepoint_collection::const_view& sp_view,
+    const traccc::details::flat_spacepoint_grid& sp_grid) const {
 
-                const doublet& mid_bot_doublet = mid_bot.first[k];
-                const lin_circle& mid_bot_lc = mid_bot.second[k];
+    // Create a device container for the spacepoints.
+    const edm::spacepoint_collection::const_device spacepoints{sp_view};
 
-                const triplet_collection_types::host triplets_for_mid_bot =
-                    m_impl->m_triplet_finding(spacepoints, sp_grid,
-                                              mid_bot_doublet, mid_bot_lc,
-                                              mid_top.first, mid_top.second);
+    // Split the middle spacepoints, in their bin order, into fixed size
+    // chunks. The seeds of every chunk are collected separately.
+    const unsigned int n_middle = sp_grid.size();
+    const unsigned int n_chunks =
+        (n_middle + middle_sp_chunk_size - 1u) / middle_sp_chunk_size;
+    std::vector<edm::seed_collection::host> chunk_seeds;
+    chunk_seeds.reserve(n_chunks);
+    for (unsigned int i = 0; i < n_chunks; ++i) {
+        chunk_seeds.emplace_back(m_impl->m_sync_mr);
+    }
+    TRACCC_DEBUG("Finding seeds for " << n_middle << " middle spacepoints in "
+                                      << n_chunks << " chunks");
 
-                triplets.insert(triplets.end(), triplets_for_mid_bot.begin(),
-                                triplets_for_mid_bot.end());
+    // Process the chunks in parallel.
+    tbb::task_arena arena(m_impl->m_finder_config.max_threads > 0u
+                              ? static_cast<int>(
+                                    m_impl->m_finder_config.max_threads)
+                              : tbb::task_arena::automatic);
+    arena.execute([&]() {
+        tbb::enumerable_thread_specific<impl::scratch> scratch(
+            [&]() { return impl::scratch{*m_impl}; });
+        tbb::parallel_for(
+            tbb::blocked_range<unsigned int>(0u, n_chunks),
+            [&](const tbb::blocked_range<unsigned int>& range) {
+                impl::scratch& tmp = scratch.local();
+                for (unsigned int c = range.begin(); c != range.end(); ++c) {
+                    const unsigned int begin = c * middle_sp_chunk_size;
+                    const unsigned int end =
+                        std::min(begin + middle_sp_chunk_size, n_middle);
+                    sp_location spM_location = sp_grid.location(begin);
+                    for (unsigned int k = begin; k < end; ++k) {
+                        while (k >= sp_grid.bin_end(spM_location.bin_idx)) {
+                            ++spM_location.bin_idx;
+                        }
+                        spM_location.sp_idx =
+                            k - sp_grid.bin_begin(spM_location.bin_idx);
+                        m_impl->find_seeds(spacepoints, sp_grid, spM_location,
+                                           tmp, chunk_seeds[c]);
+                    }
+                }
+            });
+        // Record the statistics of the event, if requested.
+        if (m_impl->m_finder_config.collect_statistics) {
+            for (const impl::scratch& tmp : scratch) {
+                m_impl->record_statistics(tmp.stats);
             }
-
-            // seed filtering
-            m_impl->m_seed_filtering(spacepoints, sp_grid, triplets, seeds);
         }
+    });
+
+    // Merge the seeds of the chunks, in the order of the chunks. Which is the
+    // same order in which the serial code produces them.
+    std::vector<unsigned int> chunk_offsets(n_chunks + 1u, 0u);
+    for (unsigned int c = 0; c < n_chunks; ++c) {
+        chunk_offsets[c + 1u] =
+            chunk_offsets[c] +
+            static_cast<unsigned int>(chunk_seeds[c].size());
+    }
+    edm::seed_collection::host seeds{m_impl->m_mr};
+    seeds.resize(chunk_offsets.back());
+    for (unsigned int c = 0; c < n_chunks; ++c) {
+        const edm::seed_collection::host& chunk = chunk_seeds[c];
+        std::copy(chunk.bottom_index().begin(), chunk.bottom_index().end(),
+                  seeds.bottom_index().begin() + chunk_offsets[c]);
+        std::copy(chunk.middle_index().begin(), chunk.middle_index().end(),
+                  seeds.middle_index().begin() + chunk_offsets[c]);
+        std::copy(chunk.top_index().begin(), chunk.top_index().end(),
+                  seeds.top_index().begin() + chunk_offsets[c]);
     }
+    TRACCC_DEBUG("Found " << seeds.size() << " seeds");
 
     return seeds;
 }
@@ -8,6 +8,10 @@
 // Library include(s).
 #include "traccc/seeding/seeding_algorithm.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <chrono>
+
 namespace traccc::host {
 
 seeding_algorithm::seeding_algorithm(const seedfinder_config& finder_config,
@@ -19,12 +23,95 @@ seeding_algorithm::seeding_algorithm(const seedfinder_config& finder_config,
       m_binning(finder_config, grid_config, mr,
                 logger->cloneWithSuffix("BinningAlg")),
       m_finding(finder_config, filter_config, mr,
-                logger->cloneWithSuffix("SeedFindingAlg")) {}
+                logger->cloneWithSuffix("SeedFindingAlg")),
+      m_mr(mr),
+      m_collect_statistics(finder_config.collect_statistics) {}
+
+template <typename binning_t>
+traccc::details::flat_spacepoint_grid seeding_algorithm::bin(
+    const binning_t& bin) const {
+
+    if (!m_collect_statistics) {
+        return bin();
+    }
+
+    // Time the binning, and record the occupancy of the resulting grid.
+    const auto start = std::chrono::steady_clock::now();
+    traccc::details::flat_spacepoint_grid result = bin();
+    seeding_statistics stats;
+    stats.binning_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    stats.n_grids = 1u;
+    stats.n_spacepoints = result.size();
+    for (unsigned int i = 0; i < result.nbins(); ++i) {
+        seeding_statistics::fill(stats.bin_occupancy,
+                                 result.bin_end(i) - result.bin_begin(i));
+    }
+    m_finding.record_statistics(stats);
+    return result;
+}
 
 seeding_algorithm::output_type seeding_algorithm::operator()(
     const edm::spacepoint_collection::const_view& spacepoints) const {
 
-    return m_finding(spacepoints, m_binning(spacepoints));
+    return m_finding(spacepoints,
+                     bin([&]() { return m_binning(spacepoints); }));
+}
+
+seeding_algorithm::roi_output_type seeding_algorithm::operator()(
+    const edm::spacepoint_collection::const_view& spacepoints,
+    const seeding_roi_collection_types::const_view& rois_view) const {
+
+    // Set up a device container on top of the RoIs.
+    const seeding_roi_collection_types::const_device rois{rois_view};
+
+    // Create the result object.
+    roi_output_type result{edm::seed_collection::host{m_mr.get()},
+                           vecmem::vector<unsigned int>{&(m_mr.get())}};
+    result.roi_offsets.reserve(rois.size() + 1u);
+    result.roi_offsets.push_back(0u);
+
+    // Bin all spacepoints that are inside of any of the RoIs.
+    const traccc::details::flat_spacepoint_grid roi_grid =
+        bin([&]() { return m_binning(spacepoints, rois_view); });
+    TRACCC_DEBUG("Binned " << roi_grid.size() << " spacepoints in "
+                           << rois.size() << " RoIs");
+
+    // Find the seeds in each RoI separately.
+    for (const seeding_roi& roi : rois) {
+        const edm::seed_collection::host roi_seeds = m_finding(
+            spacepoints,
+            bin([&]() { return m_binning(spacepoints, roi_grid, roi); }));
+        const unsigned int offset = result.seeds.size();
+        result.seeds.resize(offset + roi_seeds.size());
+        std::copy(roi_seeds.bottom_index().begin(),
+                  roi_seeds.bottom_index().end(),
+                  result.seeds.bottom_index().begin() + offset);
+        std::copy(roi_seeds.middle_index().begin(),
+                  roi_seeds.middle_index().end(),
+                  result.seeds.middle_index().begin() + offset);
+        std::copy(roi_seeds.top_index().begin(), roi_seeds.top_index().end(),
+                  result.seeds.top_index().begin() + offset);
+        result.roi_offsets.push_back(result.seeds.size());
+    }
+
+    return result;
+}
+
+void seeding_algorithm::set_z_bin_edges(std::span<const scalar> z_edges) {
+
+    m_binning.set_z_bin_edges(z_edges);
+}
+
+scratch_memory_resource::statistics seeding_algorithm::scratch_statistics()
+    const {
+
+    return m_finding.scratch_statistics();
+}
+
+seeding_statistics seeding_algorithm::statistics() const {
+
+    return m_finding.statistics();
 }
 
 }  // namespace traccc::host
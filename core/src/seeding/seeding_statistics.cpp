@@ -0,0 +1,127 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/seeding/seeding_statistics.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <bit>
+#include <ostream>
+#include <string_view>
+
+namespace traccc {
+namespace {
+
+/// Add one histogram to another
+void add(seeding_statistics::histogram& lhs,
+         const seeding_statistics::histogram& rhs) {
+
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        lhs[i] += rhs[i];
+    }
+}
+
+/// Write a histogram as a JSON array
+void write(std::ostream& out, std::string_view name,
+           const seeding_statistics::histogram& h) {
+
+    out << "    \"" << name << "\": [";
+    for (std::size_t i = 0; i < h.size(); ++i) {
+        out << (i == 0u ? "" : ", ") << h[i];
+    }
+    out << "]";
+}
+
+}  // namespace
+
+void seeding_statistics::fill(histogram& h, std::size_t value) {
+
+    ++h[std::min(static_cast<std::size_t>(std::bit_width(value)),
+                 h.size() - 1u)];
+}
+
+std::uint64_t seeding_statistics::bin_lower_edge(std::size_t bin) {
+
+    return (bin == 0u) ? 0u : (std::uint64_t{1u} << (bin - 1u));
+}
+
+seeding_statistics& seeding_statistics::operator+=(
+    const seeding_statistics& rhs) {
+
+    n_grids += rhs.n_grids;
+    n_spacepoints += rhs.n_spacepoints;
+    n_middle_spacepoints += rhs.n_middle_spacepoints;
+    n_middle_spacepoints_with_doublets +=
+        rhs.n_middle_spacepoints_with_doublets;
+    n_mid_bot_doublets += rhs.n_mid_bot_doublets;
+    n_mid_top_doublets += rhs.n_mid_top_doublets;
+    n_triplet_candidates += rhs.n_triplet_candidates;
+    n_triplets += rhs.n_triplets;
+    n_triplets_passing_single_seed_cuts +=
+        rhs.n_triplets_passing_single_seed_cuts;
+    n_seeds += rhs.n_seeds;
+
+    binning_time += rhs.binning_time;
+    doublet_finding_time += rhs.doublet_finding_time;
+    triplet_finding_time += rhs.triplet_finding_time;
+    seed_filtering_time += rhs.seed_filtering_time;
+
+    add(bin_occupancy, rhs.bin_occupancy);
+    add(mid_bot_doublets_per_middle, rhs.mid_bot_doublets_per_middle);
+    add(mid_top_doublets_per_middle, rhs.mid_top_doublets_per_middle);
+    add(triplets_per_middle, rhs.triplets_per_middle);
+    add(seeds_per_middle, rhs.seeds_per_middle);
+
+    return *this;
+}
+
+void seeding_statistics::write_json(std::ostream& out) const {
+
+    out << "{\n";
+    out << "  \"counters\": {\n"
+        << "    \"grids\": " << n_grids << ",\n"
+        << "    \"spacepoints\": " << n_spacepoints << ",\n"
+        << "    \"middle_spacepoints\": " << n_middle_spacepoints << ",\n"
+        << "    \"middle_spacepoints_with_doublets\": "
+        << n_middle_spacepoints_with_doublets << ",\n"
+        << "    \"mid_bot_doublets\": " << n_mid_bot_doublets << ",\n"
+        << "    \"mid_top_doublets\": " << n_mid_top_doublets << ",\n"
+        << "    \"triplet_candidates\": " << n_triplet_candidates << ",\n"
+        << "    \"triplets\": " << n_triplets << ",\n"
+        << "    \"triplets_passing_single_seed_cuts\": "
+        << n_triplets_passing_single_seed_cuts << ",\n"
+        << "    \"seeds\": " << n_seeds << "\n"
+        << "  },\n";
+    out << "  \"timing_ns\": {\n"
+        << "    \"binning\": " << binning_time.count() << ",\n"
+        << "    \"doublet_finding\": " << doublet_finding_time.count()
+        << ",\n"
+        << "    \"triplet_finding\": " << triplet_finding_time.count()
+        << ",\n"
+        << "    \"seed_filtering\": " << seed_filtering_time.count() << "\n"
+        << "  },\n";
+    out << "  \"histograms\": {\n";
+    out << "    \"bin_lower_edges\": [";
+    for (std::size_t i = 0; i < n_histogram_bins; ++i) {
+        out << (i == 0u ? "" : ", ") << bin_lower_edge(i);
+    }
+    out << "],\n";
+    write(out, "bin_occupancy", bin_occupancy);
+    out << ",\n";
+    write(out, "mid_bot_doublets_per_middle", mid_bot_doublets_per_middle);
+    out << ",\n";
+    write(out, "mid_top_doublets_per_middle", mid_top_doublets_per_middle);
+    out << ",\n";
+    write(out, "triplets_per_middle", triplets_per_middle);
+    out << ",\n";
+    write(out, "seeds_per_middle", seeds_per_middle);
+    out << "\n  }\n";
+    out << "}\n";
+}
+
+}  // namespace traccc
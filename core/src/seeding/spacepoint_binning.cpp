@@ -8,10 +8,11 @@
 // Local include(s).
 #include "traccc/seeding/detail/spacepoint_binning.hpp"
 
+#include "traccc/definitions/math.hpp"
 #include "traccc/seeding/spacepoint_binning_helper.hpp"
 
-// Detray include(s).
-#include <detray/definitions/indexing.hpp>
+// System include(s).
+#include <algorithm>
 
 namespace traccc::host::details {
 
@@ -22,33 +23,194 @@ spacepoint_binning::spacepoint_binning(
       m_config(config),
       m_grid_config(grid_config),
       m_axes(get_axes(grid_config, mr)),
+      m_z_edges(&mr),
       m_mr(mr) {}
 
-traccc::details::spacepoint_grid_types::host spacepoint_binning::operator()(
-    const edm::spacepoint_collection::const_view& sp_view) const {
+void spacepoint_binning::set_z_bin_edges(std::span<const scalar> z_edges) {
+
+    m_z_edges.assign(z_edges.begin(), z_edges.end());
+}
+
+traccc::details::flat_spacepoint_grid spacepoint_binning::make_grid(
+    const edm::spacepoint_collection::const_device& spacepoints,
+    const vecmem::vector<unsigned int>& sp_bins) const {
+
+    // Use fixed or uniform bins, if requested.
+    if (!m_z_edges.empty()) {
+        return {m_axes.first, m_axes.second, m_z_edges,
+                m_config.neighbor_scope, m_mr.get()};
+    }
+    if (!m_config.adaptive_z_binning) {
+        return {m_axes.first, m_axes.second, m_config.neighbor_scope,
+                m_mr.get()};
+    }
+
+    // Histogram the Z coordinates of the spacepoints in the uniform bins.
+    const auto& z_axis = m_axes.second;
+    const unsigned int n_z_bins = static_cast<unsigned int>(z_axis.bins());
+    vecmem::vector<unsigned int> counts(n_z_bins, 0u, &(m_mr.get()));
+    for (unsigned int i = 0; i < spacepoints.size(); ++i) {
+        if (sp_bins[i] != traccc::details::flat_spacepoint_grid::invalid_bin) {
+            ++counts[std::min(
+                static_cast<unsigned int>(z_axis.bin(spacepoints.at(i).z())),
+                n_z_bins - 1u)];
+        }
+    }
+
+    // Split the densely populated bins.
+    const vecmem::vector<scalar> z_edges = get_adaptive_z_edges(
+        m_grid_config, counts, m_config.max_z_bin_splits, m_mr.get());
+    TRACCC_VERBOSE("Using " << z_edges.size() - 1u << " Z bins instead of "
+                            << n_z_bins);
+    return {m_axes.first, m_axes.second, z_edges, m_config.neighbor_scope,
+            m_mr.get()};
+}
+
+template <typename selector_t>
+traccc::details::flat_spacepoint_grid spacepoint_binning::bin(
+    const edm::spacepoint_collection::const_view& sp_view,
+    selector_t&& selector) const {
 
     // Set up a device container on top of the input.
     const edm::spacepoint_collection::const_device spacepoints{sp_view};
 
-    // Create the result object.
-    traccc::details::spacepoint_grid_types::host result{
-        m_axes.first, m_axes.second, m_mr.get()};
-    const auto& phi_axis = result.axis_p0();
-    const auto& z_axis = result.axis_p1();
-
-    // Arrange the spacepoints into the bins of the 2D grid.
+    // Select the spacepoints to bin.
+    vecmem::vector<unsigned int> sp_bins(
+        spacepoints.size(), traccc::details::flat_spacepoint_grid::invalid_bin,
+        &(m_mr.get()));
     for (unsigned int i = 0; i < spacepoints.size(); ++i) {
 
         // Get a proxy for this spacepoint.
         const edm::spacepoint_collection::const_device::const_proxy_type sp =
             spacepoints.at(i);
 
-        if (is_valid_sp(m_config, sp)) {
-            const detray::dindex bin_index =
-                phi_axis.bin(sp.phi()) + phi_axis.bins() * z_axis.bin(sp.z());
-            result.bin(bin_index).push_back(i);
+        if (is_valid_sp(m_config, sp) && selector(sp)) {
+            sp_bins[i] = 0u;
+        }
+    }
+
+    // Create the result object.
+    traccc::details::flat_spacepoint_grid result =
+        make_grid(spacepoints, sp_bins);
+
+    // Find the bin of every selected spacepoint in the 2D grid.
+    for (unsigned int i = 0; i < spacepoints.size(); ++i) {
+        if (sp_bins[i] != traccc::details::flat_spacepoint_grid::invalid_bin) {
+            const edm::spacepoint_collection::const_device::const_proxy_type
+                sp = spacepoints.at(i);
+            sp_bins[i] = result.bin_index(sp.phi(), sp.z());
+        }
+    }
+
+    // Arrange the spacepoints into the bins.
+    result.fill(spacepoints, sp_bins);
+    return result;
+}
+
+traccc::details::flat_spacepoint_grid spacepoint_binning::operator()(
+    const edm::spacepoint_collection::const_view& sp_view) const {
+
+    return bin(sp_view, [](const auto&) { return true; });
+}
+
+traccc::details::flat_spacepoint_grid spacepoint_binning::operator()(
+    const edm::spacepoint_collection::const_view& sp_view,
+    const seeding_roi_collection_types::const_view& rois_view) const {
+
+    // Set up a device container on top of the RoIs.
+    const seeding_roi_collection_types::const_device rois{rois_view};
+
+    // Bin the spacepoints that are inside of any of the RoIs.
+    return bin(sp_view, [&rois](const auto& sp) {
+        const scalar r = sp.radius();
+        const scalar z = sp.z();
+        const scalar phi = sp.phi();
+        for (const seeding_roi& roi : rois) {
+            if (is_inside(roi, r, z, phi)) {
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+traccc::details::flat_spacepoint_grid spacepoint_binning::operator()(
+    const edm::spacepoint_collection::const_view& sp_view,
+    const traccc::details::flat_spacepoint_grid& sp_grid,
+    const seeding_roi& roi) const {
+
+    // Set up a device container on top of the input.
+    const edm::spacepoint_collection::const_device spacepoints{sp_view};
+
+    const auto& phi_axis = sp_grid.axis_p0();
+    const unsigned int n_phi_bins = static_cast<unsigned int>(phi_axis.bins());
+    const unsigned int n_z_bins = sp_grid.z_bins();
+
+    // The Z range covered by the RoI, inside of the seeding region.
+    const scalar r_max = m_config.rMax;
+    const scalar z_low =
+        roi.z_min + std::min(scalar{0.f}, r_max * math::sinh(roi.eta_min));
+    const scalar z_high =
+        roi.z_max + std::max(scalar{0.f}, r_max * math::sinh(roi.eta_max));
+    const unsigned int z_bin_low = std::min(
+        sp_grid.z_bin(
+            std::clamp(z_low, scalar{m_config.zMin}, scalar{m_config.zMax})),
+        n_z_bins - 1u);
+    const unsigned int z_bin_high = std::min(
+        sp_grid.z_bin(
+            std::clamp(z_high, scalar{m_config.zMin}, scalar{m_config.zMax})),
+        n_z_bins - 1u);
+
+    // The phi bins covered by the RoI. Walking around the circular axis from
+    // the bin of the lower edge to the bin of the upper one. If an RoI
+    // crossing the +-pi boundary has both of its edges in the same bin, it
+    // covers (almost) the full circle.
+    vecmem::vector<unsigned int> phi_bins(&(m_mr.get()));
+    const unsigned int phi_bin_low =
+        std::min(static_cast<unsigned int>(phi_axis.bin(roi.phi_min)),
+                 n_phi_bins - 1u);
+    const unsigned int phi_bin_high =
+        std::min(static_cast<unsigned int>(phi_axis.bin(roi.phi_max)),
+                 n_phi_bins - 1u);
+    if (((roi.phi_min <= roi.phi_max) &&
+         (roi.phi_max - roi.phi_min >= m_config.phiMax - m_config.phiMin)) ||
+        ((roi.phi_min > roi.phi_max) && (phi_bin_low == phi_bin_high))) {
+        for (unsigned int i = 0; i < n_phi_bins; ++i) {
+            phi_bins.push_back(i);
+        }
+    } else {
+        for (unsigned int i = phi_bin_low;; i = (i + 1u) % n_phi_bins) {
+            phi_bins.push_back(i);
+            if (i == phi_bin_high) {
+                break;
+            }
+        }
+    }
+
+    // Collect the spacepoints inside of the RoI, from the overlapping bins.
+    vecmem::vector<unsigned int> sp_indices(&(m_mr.get()));
+    vecmem::vector<unsigned int> sp_bins(&(m_mr.get()));
+    for (unsigned int z_bin = z_bin_low; z_bin <= z_bin_high; ++z_bin) {
+        for (unsigned int phi_bin : phi_bins) {
+            const unsigned int bin = phi_bin + z_bin * n_phi_bins;
+            for (unsigned int i = sp_grid.bin_begin(bin);
+                 i < sp_grid.bin_end(bin); ++i) {
+                if (is_inside(roi, sp_grid.radius()[i], sp_grid.z()[i],
+                              sp_grid.phi()[i])) {
+                    sp_indices.push_back(sp_grid.sp_index(
+                        {bin, i - sp_grid.bin_begin(bin)}));
+                    sp_bins.push_back(bin);
+                }
+            }
         }
     }
+    TRACCC_VERBOSE("Selected " << sp_indices.size()
+                               << " spacepoints for the RoI");
+
+    // Arrange them into a new grid.
+    traccc::details::flat_spacepoint_grid result =
+        sp_grid.empty_copy(m_mr.get());
+    result.fill(spacepoints, sp_indices, sp_bins);
     return result;
 }
 
@@ -0,0 +1,350 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/definitions/math.hpp"
+#include "traccc/definitions/primitives.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+#include "traccc/geometry/silicon_detector_description.hpp"
+#include "traccc/seeding/detail/seeding_config.hpp"
+#include "traccc/seeding/detail/spacepoint_formation.hpp"
+#include "traccc/seeding/detail/strip_module_pair.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+#include <vecmem/memory/synchronized_memory_resource.hpp>
+
+// Detray include(s).
+#include <detray/geometry/tracking_surface.hpp>
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace traccc::host::details {
+
+/// Number of module pairs processed by one task
+constexpr unsigned int strip_module_pair_chunk_size = 32u;
+
+/// Common implementation for the strip module pair finding functions
+///
+/// Strip modules are paired with the closest other strip module that is
+/// parallel to them, and has strips that are at an angle to their own. Only
+/// mutually closest modules are paired up. The strips of a module are taken
+/// to run along the local axis with the larger pitch, with their lengths
+/// given by that pitch.
+///
+/// @tparam detector_t The detector type to use
+///
+/// @param det      The detector object
+/// @param dd_view  The detector description
+/// @param config   The strip spacepoint formation configuration
+/// @param mr       The memory resource to create the output with
+/// @return The strip module pairs of the detector
+///
+template <typename detector_t>
+strip_module_pair_collection_types::host make_strip_module_pairs(
+    const detector_t& det,
+    const silicon_detector_description::const_view& dd_view,
+    const strip_spacepoint_formation_config& config,
+    vecmem::memory_resource& mr) {
+
+    // Create a device object for the detector description.
+    const silicon_detector_description::const_device dd{dd_view};
+
+    // Properties of a strip module.
+    struct strip_module {
+        /// Surface of the module
+        detray::geometry::barcode surface;
+        /// Global position of the module's centre
+        point3 centre;
+        /// Normal vector of the module
+        vector3 normal;
+        /// Direction of the module's strips
+        vector3 strip_direction;
+        /// Half length of the module's strips
+        scalar half_length;
+        /// Local axis that the module's strips run along
+        unsigned int strip_axis;
+    };
+
+    // Collect the strip modules.
+    std::vector<strip_module> modules;
+    for (unsigned int i = 0; i < dd.size(); ++i) {
+        if (dd.dimensions().at(i) != 1) {
+            continue;
+        }
+        const detray::tracking_surface sf{det, dd.geometry_id().at(i)};
+        const point3 centre = sf.local_to_global({}, point2{0.f, 0.f}, {});
+        const vector3 u =
+            sf.local_to_global({}, point2{1.f, 0.f}, {}) - centre;
+        const vector3 v =
+            sf.local_to_global({}, point2{0.f, 1.f}, {}) - centre;
+        const scalar pitch_x = dd.pitch_x().at(i);
+        const scalar pitch_y = dd.pitch_y().at(i);
+        const bool along_y = (pitch_y >= pitch_x);
+        modules.push_back({dd.geometry_id().at(i), centre,
+                           vector::normalize(vector::cross(u, v)),
+                           vector::normalize(along_y ? v : u),
+                           0.5f * (along_y ? pitch_y : pitch_x),
+                           along_y ? 1u : 0u});
+    }
+
+    // Sort the modules by Z, to be able to only look at nearby modules.
+    std::stable_sort(modules.begin(), modules.end(),
+                     [](const strip_module& a, const strip_module& b) {
+                         return a.centre[2] < b.centre[2];
+                     });
+
+    // Find the closest partner of every module.
+    const scalar min_normal_cos = math::cos(config.max_normal_angle);
+    const scalar max_strip_cos = math::cos(config.min_stereo_angle);
+    const unsigned int n_modules = static_cast<unsigned int>(modules.size());
+    static constexpr unsigned int no_partner =
+        std::numeric_limits<unsigned int>::max();
+    std::vector<unsigned int> partner(n_modules, no_partner);
+    std::vector<scalar> partner_distance(n_modules,
+                                         config.max_module_distance);
+    for (unsigned int i = 0; i < n_modules; ++i) {
+        const strip_module& mi = modules[i];
+        for (unsigned int j = i + 1; j < n_modules; ++j) {
+            const strip_module& mj = modules[j];
+            if (mj.centre[2] - mi.centre[2] > config.max_module_distance) {
+                break;
+            }
+            const scalar distance = vector::norm(mj.centre - mi.centre);
+            if ((distance > config.max_module_distance) ||
+                (math::fabs(vector::dot(mi.normal, mj.normal)) <
+                 min_normal_cos) ||
+                (math::fabs(vector::dot(mi.strip_direction,
+                                        mj.strip_direction)) >
+                 max_strip_cos)) {
+                continue;
+            }
+            if (distance < partner_distance[i]) {
+                partner[i] = j;
+                partner_distance[i] = distance;
+            }
+            if (distance < partner_distance[j]) {
+                partner[j] = i;
+                partner_distance[j] = distance;
+            }
+        }
+    }
+
+    // Create the pairs out of the mutually closest modules.
+    strip_module_pair_collection_types::host result{&mr};
+    for (unsigned int i = 0; i < n_modules; ++i) {
+        const unsigned int j = partner[i];
+        if ((j == no_partner) || (j < i) || (partner[j] != i)) {
+            continue;
+        }
+        result.push_back({modules[i].surface, modules[j].surface,
+                          modules[i].half_length, modules[j].half_length,
+                          modules[i].strip_axis, modules[j].strip_axis});
+    }
+    return result;
+}
+
+/// Form the spacepoints of a single strip module pair
+///
+/// Measurements that do not measure the position across the strips of their
+/// module are ignored.
+///
+/// @tparam detector_t The detector type to use
+///
+/// @param[in] det          The detector object
+/// @param[in] pair         The module pair to form spacepoints for
+/// @param[in] measurements All measurements of the event
+/// @param[in] first        Indices of the measurements on the first module
+/// @param[in] second       Indices of the measurements on the second module
+/// @param[in] config       The strip spacepoint formation configuration
+/// @param[in,out] second_strips Scratch space for the strips of the second
+///                              module
+/// @param[in,out] second_indices Scratch space for the measurement indices
+///                               of the strips of the second module
+/// @param[out] spacepoints The collection to append the spacepoints to
+///
+template <typename detector_t>
+void strip_module_pair_spacepoint_formation(
+    const detector_t& det, const strip_module_pair& pair,
+    const measurement_collection_types::const_device& measurements,
+    std::span<const unsigned int> first, std::span<const unsigned int> second,
+    const strip_spacepoint_formation_config& config,
+    std::vector<darray<point3, 2>>& second_strips,
+    std::vector<unsigned int>& second_indices,
+    edm::spacepoint_collection::host& spacepoints) {
+
+    // Calculate the strip end points on the second module only once.
+    second_strips.clear();
+    second_indices.clear();
+    for (unsigned int meas_index : second) {
+        const measurement& meas = measurements.at(meas_index);
+        if (meas.subs.get_indices()[0] == pair.second_strip_axis) {
+            continue;
+        }
+        second_strips.push_back(traccc::details::strip_end_points(
+            det, meas, pair.second_strip_axis, pair.second_half_length));
+        second_indices.push_back(meas_index);
+    }
+
+    // Try to form a spacepoint out of every combination of strips.
+    for (unsigned int meas_index_1 : first) {
+        const measurement& meas = measurements.at(meas_index_1);
+        if (meas.subs.get_indices()[0] == pair.first_strip_axis) {
+            continue;
+        }
+        const darray<point3, 2> first_strip =
+            traccc::details::strip_end_points(
+                det, meas, pair.first_strip_axis, pair.first_half_length);
+        for (std::size_t i = 0; i < second_strips.size(); ++i) {
+            point3 crossing;
+            if (traccc::details::strip_crossing_point(
+                    first_strip, second_strips[i],
+                    config.strip_length_tolerance, crossing)) {
+                spacepoints.push_back({meas_index_1, second_indices[i],
+                                       crossing, 0.f, 0.f});
+            }
+        }
+    }
+}
+
+/// Common implementation for the strip spacepoint formation algorithm's
+/// execute functions
+///
+/// @tparam detector_t The detector type to use
+///
+/// @param det               The detector object
+/// @param pairs_view        The strip module pairs of the detector
+/// @param measurements_view The view of the measurements to process
+/// @param config            The strip spacepoint formation configuration
+/// @param mr                The memory resource to create the output with
+/// @return A container of the created spacepoints
+///
+template <typename detector_t>
+edm::spacepoint_collection::host strip_spacepoint_formation(
+    const detector_t& det,
+    const strip_module_pair_collection_types::const_view& pairs_view,
+    const measurement_collection_types::const_view& measurements_view,
+    const strip_spacepoint_formation_config& config,
+    vecmem::memory_resource& mr) {
+
+    // Create device containers for the inputs.
+    const strip_module_pair_collection_types::const_device pairs{pairs_view};
+    const measurement_collection_types::const_device measurements{
+        measurements_view};
+
+    // Collect the strip measurements, ordered by their surfaces.
+    std::vector<unsigned int> meas_indices;
+    meas_indices.reserve(measurements.size());
+    for (unsigned int i = 0; i < measurements.size(); ++i) {
+        if (traccc::details::is_valid_strip_measurement(measurements.at(i))) {
+            meas_indices.push_back(i);
+        }
+    }
+    std::stable_sort(meas_indices.begin(), meas_indices.end(),
+                     [&](unsigned int a, unsigned int b) {
+                         return measurements.at(a).surface_link <
+                                measurements.at(b).surface_link;
+                     });
+
+    // Helper function finding the measurements of one surface.
+    auto surface_measurements = [&](const detray::geometry::barcode& surface) {
+        const auto begin = std::lower_bound(
+            meas_indices.begin(), meas_indices.end(), surface,
+            [&](unsigned int meas_index, const detray::geometry::barcode& sf) {
+                return measurements.at(meas_index).surface_link < sf;
+            });
+        const auto end = std::upper_bound(
+            begin, meas_indices.end(), surface,
+            [&](const detray::geometry::barcode& sf, unsigned int meas_index) {
+                return sf < measurements.at(meas_index).surface_link;
+            });
+        return std::span<const unsigned int>{begin, end};
+    };
+
+    // Process the module pairs, in fixed size chunks, in parallel. The chunks
+    // allocate their spacepoints concurrently.
+    vecmem::synchronized_memory_resource chunk_mr{mr};
+    const unsigned int n_pairs = pairs.size();
+    const unsigned int n_chunks =
+        (n_pairs + strip_module_pair_chunk_size - 1u) /
+        strip_module_pair_chunk_size;
+    std::vector<edm::spacepoint_collection::host> chunk_spacepoints;
+    chunk_spacepoints.reserve(n_chunks);
+    for (unsigned int i = 0; i < n_chunks; ++i) {
+        chunk_spacepoints.emplace_back(chunk_mr);
+    }
+    tbb::task_arena arena(config.max_threads > 0u
+                              ? static_cast<int>(config.max_threads)
+                              : tbb::task_arena::automatic);
+    arena.execute([&]() {
+        tbb::parallel_for(
+            tbb::blocked_range<unsigned int>(0u, n_chunks),
+            [&](const tbb::blocked_range<unsigned int>& range) {
+                std::vector<darray<point3, 2>> second_strips;
+                std::vector<unsigned int> second_indices;
+                for (unsigned int c = range.begin(); c != range.end(); ++c) {
+                    edm::spacepoint_collection::host& spacepoints =
+                        chunk_spacepoints[c];
+                    const unsigned int begin = c * strip_module_pair_chunk_size;
+                    const unsigned int end = std::min(
+                        begin + strip_module_pair_chunk_size, n_pairs);
+                    for (unsigned int p = begin; p < end; ++p) {
+                        const strip_module_pair& pair = pairs.at(p);
+                        strip_module_pair_spacepoint_formation(
+                            det, pair, measurements,
+                            surface_measurements(pair.first_surface),
+                            surface_measurements(pair.second_surface), config,
+                            second_strips, second_indices, spacepoints);
+                    }
+                }
+            });
+    });
+
+    // Merge the spacepoints of the chunks, in the order of the module pairs.
+    std::vector<unsigned int> chunk_offsets(n_chunks + 1u, 0u);
+    for (unsigned int c = 0; c < n_chunks; ++c) {
+        chunk_offsets[c + 1u] =
+            chunk_offsets[c] +
+            static_cast<unsigned int>(chunk_spacepoints[c].size());
+    }
+    edm::spacepoint_collection::host result{mr};
+    result.resize(chunk_offsets.back());
+    for (unsigned int c = 0; c < n_chunks; ++c) {
+        const edm::spacepoint_collection::host& chunk = chunk_spacepoints[c];
+        std::copy(chunk.measurement_index_1().begin(),
+                  chunk.measurement_index_1().end(),
+                  result.measurement_index_1().begin() + chunk_offsets[c]);
+        std::copy(chunk.measurement_index_2().begin(),
+                  chunk.measurement_index_2().end(),
+                  result.measurement_index_2().begin() + chunk_offsets[c]);
+        std::copy(chunk.global().begin(), chunk.global().end(),
+                  result.global().begin() + chunk_offsets[c]);
+        std::copy(chunk.z_variance().begin(), chunk.z_variance().end(),
+                  result.z_variance().begin() + chunk_offsets[c]);
+        std::copy(chunk.radius_variance().begin(),
+                  chunk.radius_variance().end(),
+                  result.radius_variance().begin() + chunk_offsets[c]);
+    }
+
+    // Return the created container.
+    return result;
+}
+
+}  // namespace traccc::host::details
@@ -0,0 +1,18 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/seeding/strip_spacepoint_formation_algorithm.hpp"
+
+namespace traccc::host {
+
+strip_spacepoint_formation_algorithm::strip_spacepoint_formation_algorithm(
+    const strip_spacepoint_formation_config& config,
+    vecmem::memory_resource& mr, std::unique_ptr<const Logger> logger)
+    : messaging(std::move(logger)), m_config(config), m_mr(mr) {}
+
+}  // namespace traccc::host
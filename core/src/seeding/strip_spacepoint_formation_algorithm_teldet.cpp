@@ -0,0 +1,32 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "strip_spacepoint_formation.hpp"
+#include "traccc/seeding/strip_spacepoint_formation_algorithm.hpp"
+
+namespace traccc::host {
+
+strip_module_pair_collection_types::host
+strip_spacepoint_formation_algorithm::find_module_pairs(
+    const telescope_detector::host& det,
+    const silicon_detector_description::const_view& dd_view) const {
+
+    return details::make_strip_module_pairs(det, dd_view, m_config, m_mr);
+}
+
+strip_spacepoint_formation_algorithm::output_type
+strip_spacepoint_formation_algorithm::operator()(
+    const telescope_detector::host& det,
+    const strip_module_pair_collection_types::const_view& module_pairs,
+    const measurement_collection_types::const_view& measurements) const {
+
+    return details::strip_spacepoint_formation(det, module_pairs, measurements,
+                                               m_config, m_mr);
+}
+
+}  // namespace traccc::host
@@ -8,16 +8,32 @@
 // Library include(s).
 #include "traccc/seeding/track_params_estimation.hpp"
 
-#include "traccc/seeding/track_params_estimation_helper.hpp"
+#include "traccc/seeding/track_params_estimation_batch_helper.hpp"
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 // System include(s).
-#include <cassert>
+#include <algorithm>
 
 namespace traccc::host {
+namespace {
+
+/// Number of seeds processed together in one batch
+constexpr unsigned int seed_batch_size = 256u;
+
+}  // namespace
 
 track_params_estimation::track_params_estimation(
     vecmem::memory_resource& mr, std::unique_ptr<const Logger> logger)
-    : messaging(std::move(logger)), m_mr(mr) {}
+    : track_params_estimation(config_type{}, mr, std::move(logger)) {}
+
+track_params_estimation::track_params_estimation(
+    const config_type& config, vecmem::memory_resource& mr,
+    std::unique_ptr<const Logger> logger)
+    : messaging(std::move(logger)), m_config(config), m_mr(mr) {}
 
 track_params_estimation::output_type track_params_estimation::operator()(
     const measurement_collection_types::const_view& measurements_view,
@@ -31,52 +47,106 @@ track_params_estimation::output_type track_params_estimation::operator()(
     const edm::spacepoint_collection::const_device spacepoints(
         spacepoints_view);
     const edm::seed_collection::const_device seeds(seeds_view);
-    const edm::seed_collection::const_device::size_type num_seeds =
-        seeds.size();
+    const unsigned int num_seeds = seeds.size();
     output_type result(num_seeds, &m_mr.get());
 
-    // Create a track parameters for each seed.
-    for (edm::seed_collection::const_device::size_type i = 0; i < num_seeds;
-         ++i) {
-
-        TRACCC_VERBOSE("Creating track parameters for seed " << i + 1 << " / "
-                                                             << num_seeds);
-        TRACCC_VERBOSE("  - bottom spacepoint: "
-                       << spacepoints.at(seeds.at(i).bottom_index()).global()
-                       << ", radius: "
-                       << spacepoints.at(seeds.at(i).bottom_index()).radius());
-        TRACCC_VERBOSE("  - middle spacepoint: "
-                       << spacepoints.at(seeds.at(i).middle_index()).global()
-                       << ", radius: "
-                       << spacepoints.at(seeds.at(i).middle_index()).radius());
-        TRACCC_VERBOSE("  - top spacepoint: "
-                       << spacepoints.at(seeds.at(i).top_index()).global()
-                       << ", radius: "
-                       << spacepoints.at(seeds.at(i).top_index()).radius());
-
-        // Calculate the track parameter vector.
-        bound_track_parameters<>& track_params = result[i];
-        track_params.set_vector(
-            seed_to_bound_vector(measurements, spacepoints, seeds[i], bfield));
-
-        // Set Covariance
-        for (std::size_t j = 0; j < e_bound_size; ++j) {
-            getter::element(track_params.covariance(), j, j) =
-                stddev[j] * stddev[j];
-        }
+    // The covariance is the same for all track parameters.
+    bound_matrix<> covariance = matrix::zero<bound_matrix<>>();
+    for (std::size_t j = 0; j < e_bound_size; ++j) {
+        getter::element(covariance, j, j) = stddev[j] * stddev[j];
+    }
 
-        // Get geometry ID for bottom spacepoint
-        const edm::spacepoint_collection::const_device::const_proxy_type spB =
-            spacepoints.at(seeds[i].bottom_index());
-        assert(spB.measurement_index_2() ==
-               edm::spacepoint_collection::host::INVALID_MEASUREMENT_INDEX);
-        track_params.set_surface_link(
-            measurements.at(spB.measurement_index_1()).surface_link);
-        TRACCC_VERBOSE("  - bound track parameters: " << track_params);
+    // Create the track parameters in the requested way.
+    if (m_config.parallel) {
+        const unsigned int n_batches =
+            (num_seeds + seed_batch_size - 1u) / seed_batch_size;
+        TRACCC_DEBUG("Estimating the track parameters of "
+                     << num_seeds << " seeds in " << n_batches
+                     << " batches");
+        tbb::task_arena arena(m_config.max_threads > 0u
+                                  ? static_cast<int>(m_config.max_threads)
+                                  : tbb::task_arena::automatic);
+        arena.execute([&]() {
+            tbb::parallel_for(
+                tbb::blocked_range<unsigned int>(0u, n_batches),
+                [&](const tbb::blocked_range<unsigned int>& range) {
+                    estimate(measurements, spacepoints, seeds, bfield,
+                             covariance, range.begin() * seed_batch_size,
+                             std::min(range.end() * seed_batch_size,
+                                      num_seeds),
+                             result);
+                });
+        });
+    } else {
+        estimate(measurements, spacepoints, seeds, bfield, covariance, 0u,
+                 num_seeds, result);
     }
 
     // Return the result.
     return result;
 }
 
+void track_params_estimation::estimate(
+    const measurement_collection_types::const_device& measurements,
+    const edm::spacepoint_collection::const_device& spacepoints,
+    const edm::seed_collection::const_device& seeds, const vector3& bfield,
+    const bound_matrix<>& covariance, unsigned int begin, unsigned int end,
+    output_type& result) const {
+
+    track_params_estimation_batch_helper<seed_batch_size> batch;
+    for (unsigned int batch_begin = begin; batch_begin < end;
+         batch_begin += seed_batch_size) {
+
+        const unsigned int n =
+            std::min(end - batch_begin, seed_batch_size);
+
+        // Gather the positions of the spacepoints of the seeds.
+        for (unsigned int i = 0; i < n; ++i) {
+            const edm::seed_collection::const_device::const_proxy_type seed =
+                seeds.at(batch_begin + i);
+            const darray<unsigned int, 3> sp_indices{
+                seed.bottom_index(), seed.middle_index(), seed.top_index()};
+            for (unsigned int k = 0; k < 3u; ++k) {
+                const point3& global = spacepoints.at(sp_indices[k]).global();
+                batch.x[k][i] = global[0];
+                batch.y[k][i] = global[1];
+                batch.z[k][i] = global[2];
+            }
+        }
+
+        // Estimate the direction and the momentum of the seeds.
+        batch.estimate(n, bfield);
+
+        // Fill the track parameters.
+        for (unsigned int i = 0; i < n; ++i) {
+
+            const unsigned int seed_index = batch_begin + i;
+            TRACCC_VERBOSE("Creating track parameters for seed "
+                           << seed_index + 1 << " / " << seeds.size());
+
+            // The measured loc0 and loc1 come from the (first) measurement
+            // of the bottom spacepoint. For strip spacepoints this places the
+            // parameters on the surface of the first strip, at the centre of
+            // the strip along its length.
+            const edm::spacepoint_collection::const_device::const_proxy_type
+                spB = spacepoints.at(seeds.at(seed_index).bottom_index());
+            const measurement& meas_for_spB =
+                measurements.at(spB.measurement_index_1());
+
+            bound_vector<> params = matrix::zero<bound_vector<>>();
+            getter::element(params, e_bound_loc0, 0) = meas_for_spB.local[0];
+            getter::element(params, e_bound_loc1, 0) = meas_for_spB.local[1];
+            getter::element(params, e_bound_phi, 0) = batch.phi[i];
+            getter::element(params, e_bound_theta, 0) = batch.theta[i];
+            getter::element(params, e_bound_qoverp, 0) = batch.qop[i];
+
+            bound_track_parameters<>& track_params = result[seed_index];
+            track_params.set_vector(params);
+            track_params.set_covariance(covariance);
+            track_params.set_surface_link(meas_for_spB.surface_link);
+            TRACCC_VERBOSE("  - bound track parameters: " << track_params);
+        }
+    }
+}
+
 }  // namespace traccc::host
@@ -8,23 +8,27 @@
 #pragma once
 
 // Local include(s).
-#include "traccc/edm/spacepoint_collection.hpp"
 #include "traccc/seeding/detail/doublet.hpp"
+#include "traccc/seeding/detail/flat_spacepoint_grid.hpp"
 #include "traccc/seeding/detail/lin_circle.hpp"
 #include "traccc/seeding/detail/seeding_config.hpp"
 #include "traccc/seeding/detail/triplet.hpp"
 #include "traccc/seeding/triplet_finding_helper.hpp"
+#include "traccc/seeding/triplet_weighting_helper.hpp"
 #include "traccc/utils/messaging.hpp"
 
-// VecMem include(s).
-#include <vecmem/memory/memory_resource.hpp>
-
 // System include(s).
+#include <algorithm>
 #include <cassert>
-#include <functional>
+#include <cmath>
+#include <cstddef>
+#include <memory>
 
 namespace traccc::host::details {
 
+/// Scratch space of the triplet finding, re-used between doublets
+using triplet_finding_scratch = triplet_weighting_scratch;
+
 /// Triplet finding to search the compatible combintations of two doublets which
 /// share same middle spacepoint
 struct triplet_finding : public messaging {
@@ -33,44 +37,42 @@ struct triplet_finding : public messaging {
     ///
     /// @param finder_config Seed finding configuration parameters
     /// @param filter_config Seed filtering configuration parameters
-    /// @param mr The memory resource to use
     ///
     triplet_finding(
         const seedfinder_config& finding_config,
-        const seedfilter_config& filter_config, vecmem::memory_resource& mr,
+        const seedfilter_config& filter_config,
         std::unique_ptr<const Logger> logger = getDummyLogger().clone())
         : messaging(std::move(logger)),
           m_finding_config{finding_config},
-          m_filter_config{filter_config},
-          m_mr{mr} {}
+          m_filter_config{filter_config} {}
 
     /// Callable operator for triplet finding per middle-bottom doublet
     ///
-    /// @param spacepoints All the spacepoints in the event
-    /// @param sp_grid The spacepoint grid to use
-    /// @param mid_bot_doublet is the current middle-bottom doublets
-    /// @param mid_bot_lc is transformed coordinate of @c mid_bot_doublet
-    /// @param mid_top_doublets is the vector of middle-top doublets which share
-    ///                         same middle spacepoint with current
-    ///                         middle-bottom doublet
-    /// @param mid_top_lcs is transformed coordinates of
-    ///                    @c doublets_mid_top
+    /// @param[in] sp_grid The spacepoint grid to use
+    /// @param[in] mid_bot_doublet is the current middle-bottom doublets
+    /// @param[in] mid_bot_lc is transformed coordinate of @c mid_bot_doublet
+    /// @param[in] mid_top_doublets is the vector of middle-top doublets which
+    ///                             share same middle spacepoint with current
+    ///                             middle-bottom doublet
+    /// @param[in] mid_top_lcs is transformed coordinates of
+    ///                        @c doublets_mid_top
+    /// @param[in,out] triplets The collection to append the found triplets to
+    /// @param[in,out] tmp Scratch space to use
     ///
-    /// @return a vector of triplets
-    triplet_collection_types::host operator()(
-        const edm::spacepoint_collection::const_device& spacepoints,
-        const traccc::details::spacepoint_grid_types::host& sp_grid,
-        const doublet& mid_bot_doublet, const lin_circle& mid_bot_lc,
-        const doublet_collection_types::host& mid_top_doublets,
-        const lin_circle_collection_types::host& mid_top_lcs) const {
+    void operator()(const traccc::details::flat_spacepoint_grid& sp_grid,
+                    const doublet& mid_bot_doublet,
+                    const lin_circle& mid_bot_lc,
+                    const doublet_collection_types::host& mid_top_doublets,
+                    const lin_circle_collection_types::host& mid_top_lcs,
+                    triplet_collection_types::host& triplets,
+                    triplet_finding_scratch& tmp) const {
 
-        // Create the output.
-        triplet_collection_types::host result{&(m_mr.get())};
+        // The triplets of this middle-bottom doublet start here.
+        const std::size_t first_triplet = triplets.size();
 
         // Access the middle spacepoint that all the doublets share.
-        const edm::spacepoint_collection::const_device::const_proxy_type spM =
-            spacepoints.at(sp_grid.bin(
-                mid_bot_doublet.sp1.bin_idx)[mid_bot_doublet.sp1.sp_idx]);
+        const traccc::details::binned_spacepoint spM =
+            sp_grid.at(mid_bot_doublet.sp1);
 
         // Calculate quantities that help deciding if two doublets are
         // compatible.
@@ -95,7 +97,7 @@ struct triplet_finding : public messaging {
                 continue;
             }
 
-            result.push_back(
+            triplets.push_back(
                 {mid_bot_doublet.sp2,  // bottom
                  mid_bot_doublet.sp1,  // middle
                  mid_top_doublet.sp2,  // top
@@ -104,94 +106,68 @@ struct triplet_finding : public messaging {
                  mid_bot_lc.Zo()});
         }
 
-        // Set the triplet weights in a super complicated double loop over the
-        // triplets found in the previous step.
-        for (std::size_t i = 0; i < result.size(); ++i) {
-
-            triplet& current_triplet = result[i];
-            const sp_location& current_spT_idx = current_triplet.sp3;
-            const edm::spacepoint_collection::const_device::const_proxy_type
-                current_spT = spacepoints.at(sp_grid.bin(
-                    current_spT_idx.bin_idx)[current_spT_idx.sp_idx]);
-            const scalar currentTop_r = current_spT.radius();
-
-            // if two compatible seeds with high distance in r are found,
-            // compatible seeds span 5 layers
-            // -> very good seed
-            std::vector<scalar> compatibleSeedR;
-            scalar lowerLimitCurv = current_triplet.curvature -
-                                    m_filter_config.deltaInvHelixDiameter;
-            scalar upperLimitCurv = current_triplet.curvature +
-                                    m_filter_config.deltaInvHelixDiameter;
-
-            for (std::size_t j = 0; j < result.size(); ++j) {
-
-                if (i == j) {
-                    continue;
-                }
-
-                const triplet& other_triplet = result[j];
-                const sp_location& other_spT_idx = other_triplet.sp3;
-                const edm::spacepoint_collection::const_device::const_proxy_type
-                    other_spT = spacepoints.at(sp_grid.bin(
-                        other_spT_idx.bin_idx)[other_spT_idx.sp_idx]);
-
-                // compared top SP should have at least deltaRMin distance
-                const scalar otherTop_r = other_spT.radius();
-                const scalar deltaR = currentTop_r - otherTop_r;
-                if (std::abs(deltaR) < m_filter_config.deltaRMin) {
-                    continue;
-                }
-
-                // curvature difference within limits?
-                // TODO: how much slower than sorting all vectors by curvature
-                // and breaking out of loop? i.e. is vector size large (e.g. in
-                // jets?)
-                if (other_triplet.curvature < lowerLimitCurv) {
-                    continue;
-                }
-                if (other_triplet.curvature > upperLimitCurv) {
-                    continue;
-                }
-
-                bool newCompSeed = true;
-                for (scalar previousDiameter : compatibleSeedR) {
-                    // original ATLAS code uses higher min distance for 2nd
-                    // found compatible seed (20mm instead of 5mm) add new
-                    // compatible seed only if distance larger than rmin to all
-                    // other compatible seeds
-                    if (std::abs(previousDiameter - otherTop_r) <
-                        m_filter_config.deltaRMin) {
-                        newCompSeed = false;
-                        break;
-                    }
-                }
-
-                if (newCompSeed) {
-                    compatibleSeedR.push_back(otherTop_r);
-                    current_triplet.weight += m_filter_config.compatSeedWeight;
-                }
-
-                if (compatibleSeedR.size() >= m_filter_config.compatSeedLimit) {
-                    break;
-                }
-            }
+        // Set the triplet weights, based on the other triplets found for
+        // the same middle-bottom doublet.
+        tmp.sorted.clear();
+        bool has_nan = false;
+        scalar min_curvature = 0.f, max_curvature = 0.f;
+        for (std::size_t i = first_triplet; i < triplets.size(); ++i) {
+            const triplet& t = triplets[i];
+            has_nan |= std::isnan(t.curvature);
+            min_curvature = (i == first_triplet)
+                                ? t.curvature
+                                : std::min(min_curvature, t.curvature);
+            max_curvature = (i == first_triplet)
+                                ? t.curvature
+                                : std::max(max_curvature, t.curvature);
+            tmp.sorted.push_back({t.curvature, sp_grid.at(t.sp3).radius(),
+                                  static_cast<unsigned int>(i)});
+        }
+        if ((tmp.sorted.size() < sorted_weighting_min_triplets) ||
+            !(max_curvature - min_curvature >
+              sorted_weighting_min_curvature_range *
+                  m_filter_config.deltaInvHelixDiameter) ||
+            has_nan) {
+            triplet_weighting_helper::weight_triplets(m_filter_config,
+                                                      triplets, tmp);
+        } else {
+            triplet_weighting_helper::weight_sorted_triplets(m_filter_config,
+                                                             triplets, tmp);
         }
-
-        // Return the reconstructed triplets.
-        return result;
     }
 
     private:
+    /// @name Choice between the two triplet weighting methods
+    ///
+    /// The curvature sorted weighting pays for sorting the triplets, and
+    /// only wins if the +-deltaInvHelixDiameter windows hold few of them.
+    /// Otherwise the double loop finds @c compatSeedLimit compatible
+    /// triplets quickly, and stops early. Measured single threaded, on
+    /// synthetic doublets with uniformly distributed curvatures and with the
+    /// default configuration, the sorted weighting was, for 16-128 triplets
+    /// with a curvature range of:
+    ///  - 133 deltaInvHelixDiameter: 4-8x faster;
+    ///  - 32 deltaInvHelixDiameter: 1.4-3.4x faster;
+    ///  - 16 deltaInvHelixDiameter: about as fast;
+    ///  - 7 deltaInvHelixDiameter: 1.6-2x slower.
+    /// With less than 16 triplets both methods take less than 0.5 us.
+    ///
+    /// @{
+
+    /// Minimum number of triplets for the curvature sorted weighting
+    static constexpr std::size_t sorted_weighting_min_triplets = 16u;
+    /// Minimum curvature range of the triplets for the curvature sorted
+    /// weighting, in units of @c seedfilter_config::deltaInvHelixDiameter
+    static constexpr scalar sorted_weighting_min_curvature_range = 32.f;
+
+    /// @}
+
     /// @name Triplet Finding Configuration
     /// @{
     seedfinder_config m_finding_config;
     seedfilter_config m_filter_config;
     /// @}
 
-    /// Memory resource to use
-    std::reference_wrapper<vecmem::memory_resource> m_mr;
-
 };  // struct triplet_finding
 
 }  // namespace traccc::host::details
@@ -0,0 +1,109 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/utils/scratch_memory_resource.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <memory>
+
+namespace traccc {
+
+scratch_memory_resource::statistics&
+scratch_memory_resource::statistics::operator+=(const statistics& rhs) {
+
+    n_allocations += rhs.n_allocations;
+    allocated_bytes += rhs.allocated_bytes;
+    n_upstream_allocations += rhs.n_upstream_allocations;
+    upstream_bytes += rhs.upstream_bytes;
+    return *this;
+}
+
+scratch_memory_resource::scratch_memory_resource(
+    vecmem::memory_resource& upstream, std::size_t block_size)
+    : m_upstream(&upstream),
+      m_block_size(std::max(block_size, std::size_t{1u})) {}
+
+scratch_memory_resource::~scratch_memory_resource() {
+
+    for (const block& b : m_blocks) {
+        m_upstream->deallocate(b.ptr, b.size, alignof(std::max_align_t));
+    }
+}
+
+void scratch_memory_resource::reset() {
+
+    // Merge the blocks into a single one, if more than one was needed.
+    if (m_blocks.size() > 1u) {
+        std::size_t total_size = 0u;
+        for (const block& b : m_blocks) {
+            total_size += b.size;
+            m_upstream->deallocate(b.ptr, b.size, alignof(std::max_align_t));
+        }
+        m_blocks.clear();
+        m_blocks.push_back(allocate_block(total_size));
+    }
+
+    // Rewind all blocks.
+    for (block& b : m_blocks) {
+        b.used = 0u;
+    }
+    m_current_block = 0u;
+}
+
+void* scratch_memory_resource::do_allocate(std::size_t bytes,
+                                           std::size_t alignment) {
+
+    ++m_statistics.n_allocations;
+    m_statistics.allocated_bytes += bytes;
+
+    // Try to serve the allocation from the current block, or from one of the
+    // blocks after it.
+    for (; m_current_block < m_blocks.size(); ++m_current_block) {
+        block& b = m_blocks[m_current_block];
+        void* ptr = static_cast<char*>(b.ptr) + b.used;
+        std::size_t space = b.size - b.used;
+        if (std::align(alignment, bytes, ptr, space) != nullptr) {
+            b.used = b.size - space + bytes;
+            return ptr;
+        }
+    }
+
+    // If that didn't work, take a new block from upstream.
+    m_blocks.push_back(
+        allocate_block(std::max(m_block_size, bytes + alignment)));
+    m_block_size = 2u * m_blocks.back().size;
+    m_current_block = m_blocks.size() - 1u;
+    block& b = m_blocks.back();
+    void* ptr = b.ptr;
+    std::size_t space = b.size;
+    [[maybe_unused]] void* result = std::align(alignment, bytes, ptr, space);
+    assert(result != nullptr);
+    b.used = b.size - space + bytes;
+    return ptr;
+}
+
+void scratch_memory_resource::do_deallocate(void*, std::size_t, std::size_t) {
+}
+
+bool scratch_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+scratch_memory_resource::block scratch_memory_resource::allocate_block(
+    std::size_t size) {
+
+    ++m_statistics.n_upstream_allocations;
+    m_statistics.upstream_bytes += size;
+    return {m_upstream->allocate(size, alignof(std::max_align_t)), size, 0u};
+}
+
+}  // namespace traccc
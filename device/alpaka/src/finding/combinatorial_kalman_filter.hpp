@@ -14,6 +14,7 @@
 
 // Project include(s).
 #include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
 #include "traccc/edm/track_candidate_collection.hpp"
 #include "traccc/finding/actors/ckf_aborter.hpp"
 #include "traccc/finding/actors/interaction_register.hpp"
@@ -21,9 +22,9 @@
 #include "traccc/finding/details/combinatorial_kalman_filter_types.hpp"
 #include "traccc/finding/device/apply_interaction.hpp"
 #include "traccc/finding/device/build_tracks.hpp"
+#include "traccc/finding/device/fill_measurement_index.hpp"
 #include "traccc/finding/device/fill_sort_keys.hpp"
 #include "traccc/finding/device/find_tracks.hpp"
-#include "traccc/finding/device/make_barcode_sequence.hpp"
 #include "traccc/finding/device/propagate_to_next_surface.hpp"
 #include "traccc/finding/finding_config.hpp"
 #include "traccc/utils/logging.hpp"
@@ -38,23 +39,24 @@
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/scan.h>
 #include <thrust/sort.h>
-#include <thrust/unique.h>
+#include <thrust/transform_reduce.h>
 
 namespace traccc::alpaka::details {
 namespace kernels {
 
-/// Alpaka kernel functor for @c traccc::device::make_barcode_sequence
-struct make_barcode_sequence {
+/// Alpaka kernel functor for @c traccc::device::fill_measurement_index
+struct fill_measurement_index {
     template <typename TAcc>
     ALPAKA_FN_ACC void operator()(
         TAcc const& acc,
-        const device::make_barcode_sequence_payload payload) const {
+        const device::fill_measurement_index_payload payload) const {
 
         const device::global_index_t globalThreadIdx =
             ::alpaka::getIdx<::alpaka::Grid, ::alpaka::Threads>(acc)[0];
-        device::make_barcode_sequence(globalThreadIdx, payload);
+        device::fill_measurement_index(globalThreadIdx, payload);
     }
 };
 
@@ -202,46 +204,30 @@ combinatorial_kalman_filter(
     const measurement_collection_types::const_view::size_type n_measurements =
         copy.get_size(measurements);
 
-    // Get copy of barcode uniques
-    measurement_collection_types::buffer uniques_buffer{n_measurements,
-                                                        mr.main};
-    copy.setup(uniques_buffer)->wait();
-    measurement_collection_types::device uniques(uniques_buffer);
-
-    measurement_collection_types::device::iterator uniques_end =
-        thrust::unique_copy(thrustExecPolicy, measurements.ptr(),
-                            measurements.ptr() + n_measurements,
-                            uniques.begin(), measurement_equal_comp());
-    const unsigned int n_modules =
-        static_cast<unsigned int>(uniques_end - uniques.begin());
-
-    // Get upper bounds of unique elements
-    vecmem::data::vector_buffer<unsigned int> upper_bounds_buffer{n_modules,
-                                                                  mr.main};
-    copy.setup(upper_bounds_buffer)->wait();
-    vecmem::device_vector<unsigned int> upper_bounds(upper_bounds_buffer);
-
-    thrust::upper_bound(thrustExecPolicy, measurements.ptr(),
-                        measurements.ptr() + n_measurements, uniques.begin(),
-                        uniques.begin() + n_modules, upper_bounds.begin(),
-                        measurement_sort_comp());
+    // Size the measurement index to cover the surfaces of all measurements
+    const unsigned int n_index = thrust::transform_reduce(
+        thrustExecPolicy, measurements.ptr(),
+        measurements.ptr() + n_measurements, measurement_index_size(), 0u,
+        thrust::maximum<unsigned int>());
+
+    // Create the measurement index, with empty ranges for all surfaces
+    measurement_range_collection_types::buffer measurement_ranges_buffer{
+        n_index, mr.main};
+    copy.setup(measurement_ranges_buffer)->wait();
+    copy.memset(measurement_ranges_buffer, 0)->wait();
 
     /*****************************************************************
-     * Kernel1: Create barcode sequence
+     * Kernel1: Fill the measurement index
      *****************************************************************/
 
-    vecmem::data::vector_buffer<detray::geometry::barcode> barcodes_buffer{
-        n_modules, mr.main};
-    copy.setup(barcodes_buffer)->wait();
-
-    {
+    if (n_measurements > 0u) {
         Idx blocksPerGrid =
-            (barcodes_buffer.size() + threadsPerBlock - 1) / threadsPerBlock;
+            (n_measurements + threadsPerBlock - 1) / threadsPerBlock;
         auto workDiv = makeWorkDiv<Acc>(blocksPerGrid, threadsPerBlock);
 
-        ::alpaka::exec<Acc>(queue, workDiv, kernels::make_barcode_sequence{},
-                            device::make_barcode_sequence_payload{
-                                uniques_buffer, barcodes_buffer});
+        ::alpaka::exec<Acc>(queue, workDiv, kernels::fill_measurement_index{},
+                            device::fill_measurement_index_payload{
+                                measurements, measurement_ranges_buffer});
         ::alpaka::wait(queue);
     }
 
@@ -364,8 +350,7 @@ combinatorial_kalman_filter(
                 .in_params_view = in_params_buffer,
                 .in_params_liveness_view = param_liveness_buffer,
                 .n_in_params = n_in_params,
-                .barcodes_view = barcodes_buffer,
-                .upper_bounds_view = upper_bounds_buffer,
+                .measurement_ranges_view = measurement_ranges_buffer,
                 .links_view = links_buffer,
                 .prev_links_idx =
                     (step == 0 ? 0 : step_to_link_idx_map[step - 1]),
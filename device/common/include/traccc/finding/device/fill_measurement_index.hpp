@@ -0,0 +1,46 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023-2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/device/global_index.hpp"
+
+// Project include(s).
+#include "traccc/definitions/qualifiers.hpp"
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
+
+namespace traccc::device {
+
+/// (Event Data) Payload for the @c traccc::device::fill_measurement_index
+/// function
+struct fill_measurement_index_payload {
+    /**
+     * @brief View object to the vector of measurements, sorted by surface
+     */
+    measurement_collection_types::const_view measurements_view;
+
+    /**
+     * @brief View object to the output measurement index, filled with empty
+     * ranges beforehand
+     */
+    measurement_range_collection_types::view measurement_ranges_view;
+};
+
+/// Function filling the measurement index for one measurement
+///
+/// @param[in] globalIndex   The index of the current thread
+/// @param[inout] payload      The function call payload
+///
+TRACCC_HOST_DEVICE inline void fill_measurement_index(
+    global_index_t globalIndex, const fill_measurement_index_payload& payload);
+
+}  // namespace traccc::device
+
+// Include the implementation.
+#include "./impl/fill_measurement_index.ipp"
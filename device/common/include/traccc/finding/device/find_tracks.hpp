@@ -15,6 +15,7 @@
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/definitions/qualifiers.hpp"
 #include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
 #include "traccc/edm/track_parameters.hpp"
 #include "traccc/finding/candidate_link.hpp"
 #include "traccc/finding/finding_config.hpp"
@@ -60,15 +61,10 @@ struct find_tracks_payload {
     unsigned int n_in_params;
 
     /**
-     * @brief View object to the vector of barcodes for each measurement
+     * @brief View object to the measurement index, with the range of the
+     * measurements of each surface
      */
-    vecmem::data::vector_view<const detray::geometry::barcode> barcodes_view;
-
-    /**
-     * @brief View object to the vector of upper bounds of measurement indices
-     * per surface
-     */
-    vecmem::data::vector_view<const unsigned int> upper_bounds_view;
+    measurement_range_collection_types::const_view measurement_ranges_view;
 
     /**
      * @brief View object to the link vector
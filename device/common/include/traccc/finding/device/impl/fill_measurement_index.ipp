@@ -0,0 +1,29 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023-2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::device {
+
+TRACCC_HOST_DEVICE inline void fill_measurement_index(
+    const global_index_t globalIndex,
+    const fill_measurement_index_payload& payload) {
+
+    const measurement_collection_types::const_device measurements(
+        payload.measurements_view);
+    measurement_range_collection_types::device measurement_ranges(
+        payload.measurement_ranges_view);
+
+    if (globalIndex >= measurements.size()) {
+        return;
+    }
+
+    traccc::fill_measurement_index(globalIndex, measurements,
+                                   measurement_ranges);
+}
+
+}  // namespace traccc::device
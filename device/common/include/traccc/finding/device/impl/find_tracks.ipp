@@ -28,10 +28,6 @@
 // Detray include(s)
 #include <detray/geometry/tracking_surface.hpp>
 
-// Thrust include(s).
-#include <thrust/binary_search.h>
-#include <thrust/execution_policy.h>
-
 namespace traccc::device {
 
 namespace details {
@@ -88,10 +84,8 @@ TRACCC_HOST_DEVICE inline void find_tracks(
     vecmem::device_vector<candidate_link> tmp_links(payload.tmp_links_view);
     bound_track_parameters_collection_types::device tmp_params(
         payload.tmp_params_view);
-    vecmem::device_vector<const detray::geometry::barcode> barcodes(
-        payload.barcodes_view);
-    vecmem::device_vector<const unsigned int> upper_bounds(
-        payload.upper_bounds_view);
+    const measurement_range_collection_types::const_device measurement_ranges(
+        payload.measurement_ranges_view);
     vecmem::device_vector<unsigned int> tips(payload.tips_view);
     vecmem::device_vector<unsigned int> tip_lengths(payload.tip_lengths_view);
     vecmem::device_vector<unsigned int> n_tracks_per_seed(
@@ -126,34 +120,16 @@ TRACCC_HOST_DEVICE inline void find_tracks(
     if (in_param_id < payload.n_in_params &&
         in_params_liveness.at(in_param_id) > 0u) {
         /*
-         * Get the barcode of this thread's parameters, then find the first
-         * measurement that matches it.
+         * Get the barcode of this thread's parameters, then look up the range
+         * of the measurements on its surface in the (outside this kernel)
+         * computed measurement index. Surfaces without measurements have an
+         * empty range.
          */
-        const auto bcd = in_params.at(in_param_id).surface_link();
-        const auto lo = thrust::lower_bound(thrust::seq, barcodes.begin(),
-                                            barcodes.end(), bcd);
+        const measurement_range range = get_measurement_range(
+            measurement_ranges, in_params.at(in_param_id).surface_link());
 
-        /*
-         * If we cannot find any corresponding measurements, set the number of
-         * measurements to zero.
-         */
-        if (lo == barcodes.end()) {
-            init_meas = 0;
-        }
-        /*
-         * If measurements are found, use the previously (outside this kernel)
-         * computed upper bound array to compute the range of measurements for
-         * this thread.
-         */
-        else {
-            const vecmem::device_vector<const unsigned int>::size_type bcd_id =
-                static_cast<
-                    vecmem::device_vector<const unsigned int>::size_type>(
-                    std::distance(barcodes.begin(), lo));
-
-            init_meas = lo == barcodes.begin() ? 0u : upper_bounds[bcd_id - 1];
-            num_meas = upper_bounds[bcd_id] - init_meas;
-        }
+        init_meas = range.first;
+        num_meas = range.second - range.first;
     }
 
     /*
@@ -15,13 +15,14 @@
 #include "../utils/utils.hpp"
 #include "./kernels/apply_interaction.hpp"
 #include "./kernels/build_tracks.cuh"
+#include "./kernels/fill_measurement_index.cuh"
 #include "./kernels/fill_sort_keys.cuh"
 #include "./kernels/find_tracks.cuh"
-#include "./kernels/make_barcode_sequence.cuh"
 #include "./kernels/propagate_to_next_surface.hpp"
 
 // Project include(s).
 #include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
 #include "traccc/edm/track_candidate_collection.hpp"
 #include "traccc/finding/candidate_link.hpp"
 #include "traccc/finding/details/combinatorial_kalman_filter_types.hpp"
@@ -38,9 +39,10 @@
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
+#include <thrust/functional.h>
 #include <thrust/scan.h>
 #include <thrust/sort.h>
-#include <thrust/unique.h>
+#include <thrust/transform_reduce.h>
 
 namespace traccc::cuda::details {
 
@@ -101,48 +103,30 @@ combinatorial_kalman_filter(
     const measurement_collection_types::const_view::size_type n_measurements =
         copy.get_size(measurements);
 
-    // Get copy of barcode uniques
-    measurement_collection_types::buffer uniques_buffer{n_measurements,
-                                                        mr.main};
-    copy.setup(uniques_buffer)->ignore();
-    measurement_collection_types::device uniques(uniques_buffer);
-
-    measurement_collection_types::device::iterator uniques_end =
-        thrust::unique_copy(thrust_policy, measurements.ptr(),
-                            measurements.ptr() + n_measurements,
-                            uniques.begin(), measurement_equal_comp());
-    str.synchronize();
-    const unsigned int n_modules =
-        static_cast<unsigned int>(uniques_end - uniques.begin());
-
-    // Get upper bounds of unique elements
-    vecmem::data::vector_buffer<unsigned int> upper_bounds_buffer{n_modules,
-                                                                  mr.main};
-    copy.setup(upper_bounds_buffer)->ignore();
-    vecmem::device_vector<unsigned int> upper_bounds(upper_bounds_buffer);
-
-    thrust::upper_bound(thrust_policy, measurements.ptr(),
-                        measurements.ptr() + n_measurements, uniques.begin(),
-                        uniques.begin() + n_modules, upper_bounds.begin(),
-                        measurement_sort_comp());
+    // Size the measurement index to cover the surfaces of all measurements
+    const unsigned int n_index = thrust::transform_reduce(
+        thrust_policy, measurements.ptr(), measurements.ptr() + n_measurements,
+        measurement_index_size(), 0u, thrust::maximum<unsigned int>());
+
+    // Create the measurement index, with empty ranges for all surfaces
+    measurement_range_collection_types::buffer measurement_ranges_buffer{
+        n_index, mr.main};
+    copy.setup(measurement_ranges_buffer)->ignore();
+    copy.memset(measurement_ranges_buffer, 0)->ignore();
 
     /*****************************************************************
-     * Kernel1: Create barcode sequence
+     * Kernel1: Fill the measurement index
      *****************************************************************/
 
-    vecmem::data::vector_buffer<detray::geometry::barcode> barcodes_buffer{
-        n_modules, mr.main};
-    copy.setup(barcodes_buffer)->ignore();
-
-    {
+    if (n_measurements > 0u) {
         const unsigned int nThreads = warp_size * 2;
         const unsigned int nBlocks =
-            (barcodes_buffer.size() + nThreads - 1) / nThreads;
+            (n_measurements + nThreads - 1) / nThreads;
 
-        kernels::make_barcode_sequence<<<nBlocks, nThreads, 0, stream>>>(
-            device::make_barcode_sequence_payload{
-                .uniques_view = uniques_buffer,
-                .barcodes_view = barcodes_buffer});
+        kernels::fill_measurement_index<<<nBlocks, nThreads, 0, stream>>>(
+            device::fill_measurement_index_payload{
+                .measurements_view = measurements,
+                .measurement_ranges_view = measurement_ranges_buffer});
 
         TRACCC_CUDA_ERROR_CHECK(cudaGetLastError());
     }
@@ -269,8 +253,7 @@ combinatorial_kalman_filter(
                 .in_params_view = in_params_buffer,
                 .in_params_liveness_view = param_liveness_buffer,
                 .n_in_params = n_in_params,
-                .barcodes_view = barcodes_buffer,
-                .upper_bounds_view = upper_bounds_buffer,
+                .measurement_ranges_view = measurement_ranges_buffer,
                 .links_view = links_buffer,
                 .prev_links_idx =
                     (step == 0 ? 0 : step_to_link_idx_map[step - 1]),
@@ -7,17 +7,17 @@
 
 // Local include(s).
 #include "../../utils/global_index.hpp"
-#include "make_barcode_sequence.cuh"
+#include "fill_measurement_index.cuh"
 
 // Project include(s).
-#include "traccc/finding/device/make_barcode_sequence.hpp"
+#include "traccc/finding/device/fill_measurement_index.hpp"
 
 namespace traccc::cuda::kernels {
 
-__global__ void make_barcode_sequence(
-    device::make_barcode_sequence_payload payload) {
+__global__ void fill_measurement_index(
+    device::fill_measurement_index_payload payload) {
 
-    device::make_barcode_sequence(details::global_index1(), payload);
+    device::fill_measurement_index(details::global_index1(), payload);
 }
 
 }  // namespace traccc::cuda::kernels
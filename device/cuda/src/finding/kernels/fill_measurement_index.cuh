@@ -8,11 +8,11 @@
 #pragma once
 
 // Project include(s).
-#include "traccc/finding/device/make_barcode_sequence.hpp"
+#include "traccc/finding/device/fill_measurement_index.hpp"
 
 namespace traccc::cuda::kernels {
 
-__global__ void make_barcode_sequence(
-    device::make_barcode_sequence_payload payload);
+__global__ void fill_measurement_index(
+    device::fill_measurement_index_payload payload);
 
 }
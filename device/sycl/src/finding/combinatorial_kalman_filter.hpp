@@ -17,6 +17,7 @@
 
 // Project include(s).
 #include "traccc/edm/measurement.hpp"
+#include "traccc/edm/measurement_index.hpp"
 #include "traccc/edm/track_candidate_collection.hpp"
 #include "traccc/finding/actors/ckf_aborter.hpp"
 #include "traccc/finding/actors/interaction_register.hpp"
@@ -24,9 +25,9 @@
 #include "traccc/finding/details/combinatorial_kalman_filter_types.hpp"
 #include "traccc/finding/device/apply_interaction.hpp"
 #include "traccc/finding/device/build_tracks.hpp"
+#include "traccc/finding/device/fill_measurement_index.hpp"
 #include "traccc/finding/device/fill_sort_keys.hpp"
 #include "traccc/finding/device/find_tracks.hpp"
-#include "traccc/finding/device/make_barcode_sequence.hpp"
 #include "traccc/finding/device/propagate_to_next_surface.hpp"
 #include "traccc/finding/finding_config.hpp"
 #include "traccc/utils/memory_resource.hpp"
@@ -42,7 +43,7 @@
 
 namespace traccc::sycl::details {
 namespace kernels {
-struct make_barcode_sequence {};
+struct fill_measurement_index {};
 template <typename T>
 struct apply_interaction {};
 template <typename T>
@@ -103,49 +104,31 @@ combinatorial_kalman_filter(
     const measurement_collection_types::const_view::size_type n_measurements =
         copy.get_size(measurements);
 
-    // Get copy of barcode uniques
-    measurement_collection_types::buffer uniques_buffer{n_measurements,
-                                                        mr.main};
-    copy.setup(uniques_buffer)->wait();
-    measurement_collection_types::device uniques(uniques_buffer);
-
-    measurement_collection_types::device::iterator uniques_end =
-        oneapi::dpl::unique_copy(policy, measurements.ptr(),
-                                 measurements.ptr() + n_measurements,
-                                 uniques.begin(), measurement_equal_comp());
-    const unsigned int n_modules =
-        static_cast<unsigned int>(uniques_end - uniques.begin());
-
-    // Get upper bounds of unique elements
-    vecmem::data::vector_buffer<unsigned int> upper_bounds_buffer{n_modules,
-                                                                  mr.main};
-    copy.setup(upper_bounds_buffer)->wait();
-    vecmem::device_vector<unsigned int> upper_bounds(upper_bounds_buffer);
-
-    oneapi::dpl::upper_bound(policy, measurements.ptr(),
-                             measurements.ptr() + n_measurements,
-                             uniques.begin(), uniques.begin() + n_modules,
-                             upper_bounds.begin(), measurement_sort_comp());
-    queue.wait_and_throw();
+    // Size the measurement index to cover the surfaces of all measurements
+    const unsigned int n_index = oneapi::dpl::transform_reduce(
+        policy, measurements.ptr(), measurements.ptr() + n_measurements, 0u,
+        ::sycl::maximum<unsigned int>(), measurement_index_size());
+
+    // Create the measurement index, with empty ranges for all surfaces
+    measurement_range_collection_types::buffer measurement_ranges_buffer{
+        n_index, mr.main};
+    copy.setup(measurement_ranges_buffer)->wait();
+    copy.memset(measurement_ranges_buffer, 0)->wait();
 
     /*****************************************************************
-     * Kernel1: Create barcode sequence
+     * Kernel1: Fill the measurement index
      *****************************************************************/
 
-    vecmem::data::vector_buffer<detray::geometry::barcode> barcodes_buffer{
-        n_modules, mr.main};
-    copy.setup(barcodes_buffer)->wait();
-
     queue
         .submit([&](::sycl::handler& h) {
-            h.parallel_for<kernels::make_barcode_sequence>(
-                calculate1DimNdRange(n_modules, 64),
-                [uniques_view = vecmem::get_data(uniques_buffer),
-                 barcodes_view = vecmem::get_data(barcodes_buffer)](
+            h.parallel_for<kernels::fill_measurement_index>(
+                calculate1DimNdRange(n_measurements, 64),
+                [measurements, measurement_ranges_view = vecmem::get_data(
+                                   measurement_ranges_buffer)](
                     ::sycl::nd_item<1> item) {
-                    device::make_barcode_sequence(
+                    device::fill_measurement_index(
                         details::global_index(item),
-                        {uniques_view, barcodes_view});
+                        {measurements, measurement_ranges_view});
                 });
         })
         .wait_and_throw();
@@ -283,8 +266,8 @@ combinatorial_kalman_filter(
                          param_liveness =
                              vecmem::get_data(param_liveness_buffer),
                          n_in_params,
-                         barcodes = vecmem::get_data(barcodes_buffer),
-                         upper_bounds = vecmem::get_data(upper_bounds_buffer),
+                         measurement_ranges =
+                             vecmem::get_data(measurement_ranges_buffer),
                          links_view = vecmem::get_data(links_buffer),
                          prev_links_idx =
                              step == 0 ? 0 : step_to_link_idx_map[step - 1],
@@ -310,9 +293,9 @@ combinatorial_kalman_filter(
                             device::find_tracks<detector_t>(
                                 thread_id, barrier, config,
                                 {det, measurements, in_params, param_liveness,
-                                 n_in_params, barcodes, upper_bounds,
-                                 links_view, prev_links_idx, curr_links_idx,
-                                 step, updated_params, updated_liveness, tips,
+                                 n_in_params, measurement_ranges, links_view,
+                                 prev_links_idx, curr_links_idx, step,
+                                 updated_params, updated_liveness, tips,
                                  tip_lengths, n_tracks_per_seed, tmp_params,
                                  tmp_links},
                                 {shared_num_out_params[0], shared_out_offset[0],
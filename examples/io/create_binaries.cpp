@@ -6,10 +6,13 @@
  */
 
 // Project include(s).
+#include "traccc/io/event_archive.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_detector_description.hpp"
 #include "traccc/io/read_measurements.hpp"
+#include "traccc/io/read_particles.hpp"
 #include "traccc/io/read_spacepoints.hpp"
+#include "traccc/io/utils.hpp"
 #include "traccc/io/write.hpp"
 #include "traccc/options/detector.hpp"
 #include "traccc/options/input_data.hpp"
@@ -21,6 +24,8 @@
 
 // System include(s).
 #include <cstdlib>
+#include <filesystem>
+#include <memory>
 
 int create_binaries(const traccc::opts::detector& detector_opts,
                     const traccc::opts::input_data& input_opts,
@@ -37,6 +42,26 @@ int create_binaries(const traccc::opts::detector& detector_opts,
         (detector_opts.use_detray_detector ? traccc::data_format::json
                                            : traccc::data_format::csv));
 
+    // The flavour of the binary format to write. Plain binary files are
+    // written unless one of the other binary formats is requested explicitly.
+    const traccc::data_format output_format =
+        ((output_opts.format == traccc::data_format::compressed_binary) ||
+         (output_opts.format == traccc::data_format::mmap) ||
+         (output_opts.format == traccc::data_format::archive))
+            ? output_opts.format
+            : traccc::data_format::binary;
+
+    // All events go into a single file with the archive format.
+    std::unique_ptr<traccc::io::event_archive_writer> archive;
+    if (output_format == traccc::data_format::archive) {
+        archive = std::make_unique<traccc::io::event_archive_writer>(
+            traccc::io::get_absolute_path(
+                (std::filesystem::path(output_opts.directory) /
+                 std::filesystem::path(
+                     traccc::io::event_archive_filename))
+                    .native()));
+    }
+
     // Loop over events
     for (std::size_t event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
@@ -47,8 +72,12 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                                logger->clone(), &det_descr, input_opts.format);
 
         // Write binary file
-        traccc::io::write(event, output_opts.directory,
-                          traccc::data_format::binary, vecmem::get_data(cells));
+        if (archive) {
+            archive->write(event, vecmem::get_data(cells));
+        } else {
+            traccc::io::write(event, output_opts.directory, output_format,
+                              vecmem::get_data(cells));
+        }
 
         // Read the measurements and hits from the relevant event file
         traccc::measurement_collection_types::host measurements{&host_mr};
@@ -58,9 +87,31 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                                      input_opts.format);
 
         // Write binary file(s)
-        traccc::io::write(
-            event, output_opts.directory, traccc::data_format::binary,
-            vecmem::get_data(spacepoints), vecmem::get_data(measurements));
+        if (archive) {
+            archive->write(event, vecmem::get_data(spacepoints),
+                           vecmem::get_data(measurements));
+        } else {
+            traccc::io::write(event, output_opts.directory, output_format,
+                              vecmem::get_data(spacepoints),
+                              vecmem::get_data(measurements));
+        }
+
+        // Add the truth particles to the archive, if they are available.
+        if (archive && (input_opts.format == traccc::data_format::csv) &&
+            std::filesystem::exists(traccc::io::get_absolute_path(
+                (std::filesystem::path(input_opts.directory) /
+                 std::filesystem::path(traccc::io::get_event_filename(
+                     event, "-particles_initial.csv")))
+                    .native()))) {
+            traccc::particle_collection_types::host particles{&host_mr};
+            traccc::io::read_particles(particles, event, input_opts.directory);
+            archive->write(event, vecmem::get_data(particles));
+        }
+    }
+
+    // Write the archive's index.
+    if (archive) {
+        archive->close();
     }
 
     return EXIT_SUCCESS;
@@ -25,6 +25,12 @@ class clusterization
     /// Constructor
     clusterization();
 
+    /// Read/process the command line options
+    ///
+    /// @param vm The command line options to interpret/read
+    ///
+    void read(const boost::program_options::variables_map& vm) override;
+
     /// Configuration conversion
     operator clustering_config() const override;
     operator host::clusterization_algorithm::config_type() const override;
@@ -34,6 +40,8 @@ class clusterization
     private:
     /// Internal configuration object
     clustering_config m_config;
+    /// Internal configuration object for the host algorithm
+    host::clusterization_algorithm::config_type m_host_config;
 };  // class clusterization
 
 }  // namespace traccc::opts
@@ -21,6 +21,8 @@ class performance : public interface {
 
     /// Whether to run performance checks
     bool run = false;
+    /// Whether to cache the decoded truth information in binary files
+    bool truth_cache = false;
 
     /// @}
 
@@ -0,0 +1,36 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/options/details/interface.hpp"
+
+// System include(s).
+#include <string>
+
+namespace traccc::opts {
+
+/// Command line options used to configure the host seeding statistics
+class seeding_statistics : public interface {
+
+    public:
+    /// @name Options
+    /// @{
+
+    /// File to write the host seeding statistics into (in JSON format)
+    std::string file;
+
+    /// @}
+
+    /// Constructor
+    seeding_statistics();
+
+    std::unique_ptr<configuration_printable> as_printable() const override;
+};  // struct seeding_statistics
+
+}  // namespace traccc::opts
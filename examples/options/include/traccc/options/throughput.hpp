@@ -34,6 +34,13 @@ class throughput : public interface {
     /// Set the random event processing seed
     unsigned int random_seed = 0;
 
+    /// Read the input events during the processing, instead of up front
+    bool stream_input = false;
+    /// The number of events that may be read ahead while streaming the input
+    std::size_t input_buffers = 16;
+    /// The number of threads reading the input while streaming it
+    std::size_t input_readers = 2;
+
     /// Output log file
     std::string log_file;
 
@@ -11,8 +11,19 @@
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 #include "traccc/examples/utils/printable.hpp"
 
+// System include(s).
+#include <format>
+#include <stdexcept>
+#include <string>
+
 namespace traccc::opts {
 
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+/// Name of the clustering mode option
+static const char *clustering_mode_option = "clustering-mode";
+
 clusterization::clusterization() : interface("Clusterization Options") {
 
     m_desc.add_options()(
@@ -35,6 +46,52 @@ clusterization::clusterization() : interface("Clusterization Options") {
         boost::program_options::value(&m_config.backup_size_multiplier)
             ->default_value(m_config.backup_size_multiplier),
         "The size multiplier of the backup scratch space");
+    m_desc.add_options()(clustering_mode_option,
+                         po::value<std::string>()->default_value("ccl"),
+                         "Clustering engine of the host algorithm (ccl, "
+                         "ccl-runs or dbscan)");
+    m_desc.add_options()(
+        "dbscan-epsilon",
+        po::value(&m_host_config.dbscan_params.epsilon)
+            ->default_value(m_host_config.dbscan_params.epsilon),
+        "Maximum Gower distance between neighbouring cells in DBSCAN");
+    m_desc.add_options()(
+        "dbscan-min-pts",
+        po::value(&m_host_config.dbscan_params.min_pts)
+            ->default_value(m_host_config.dbscan_params.min_pts),
+        "Minimum number of neighbours of a DBSCAN core cell");
+    m_desc.add_options()(
+        "clustering-parallel",
+        po::value(&m_host_config.parallel)
+            ->default_value(m_host_config.parallel),
+        "Process the detector modules in parallel in the host clusterization");
+    m_desc.add_options()(
+        "clustering-threads",
+        po::value(&m_host_config.max_threads)
+            ->default_value(m_host_config.max_threads),
+        "Maximum number of threads for the parallel host clusterization (0: "
+        "automatic)");
+}
+
+void clusterization::read(const po::variables_map &vm) {
+
+    // Decode the clustering mode.
+    if (vm.count(clustering_mode_option)) {
+        const std::string mode_string =
+            vm[clustering_mode_option].as<std::string>();
+        if (mode_string == "ccl") {
+            m_host_config.mode =
+                host::clusterization_algorithm::ClusteringMode::CCL;
+        } else if (mode_string == "ccl-runs") {
+            m_host_config.mode =
+                host::clusterization_algorithm::ClusteringMode::CCL_RUNS;
+        } else if (mode_string == "dbscan") {
+            m_host_config.mode =
+                host::clusterization_algorithm::ClusteringMode::DBSCAN_GOWER;
+        } else {
+            throw std::invalid_argument("Unknown clustering mode");
+        }
+    }
 }
 
 clusterization::operator clustering_config() const {
@@ -42,7 +99,7 @@ clusterization::operator clustering_config() const {
 }
 
 clusterization::operator host::clusterization_algorithm::config_type() const {
-    return {};
+    return m_host_config;
 }
 
 std::unique_ptr<configuration_printable> clusterization::as_printable() const {
@@ -59,6 +116,25 @@ std::unique_ptr<configuration_printable> clusterization::as_printable() const {
     cat->add_child(std::make_unique<configuration_kv_pair>(
         "Scratch space multiplier",
         std::to_string(m_config.backup_size_multiplier)));
+    std::string mode_string = "ccl";
+    if (m_host_config.mode ==
+        host::clusterization_algorithm::ClusteringMode::CCL_RUNS) {
+        mode_string = "ccl-runs";
+    } else if (m_host_config.mode == host::clusterization_algorithm::
+                                         ClusteringMode::DBSCAN_GOWER) {
+        mode_string = "dbscan";
+    }
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Host clustering mode", mode_string));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "DBSCAN epsilon", std::to_string(m_host_config.dbscan_params.epsilon)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "DBSCAN min points",
+        std::to_string(m_host_config.dbscan_params.min_pts)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Parallel host clustering", std::format("{}", m_host_config.parallel)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Host clustering threads", std::to_string(m_host_config.max_threads)));
 
     return cat;
 }
@@ -54,6 +54,12 @@ void input_data::read(const po::variables_map &vm) {
             format = data_format::csv;
         } else if (input_format_string == "binary") {
             format = data_format::binary;
+        } else if (input_format_string == "compressed-binary") {
+            format = data_format::compressed_binary;
+        } else if (input_format_string == "mmap") {
+            format = data_format::mmap;
+        } else if (input_format_string == "archive") {
+            format = data_format::archive;
         } else if (input_format_string == "json") {
             format = data_format::json;
         } else {
@@ -20,6 +20,9 @@ performance::performance() : interface("Performance Measurement Options") {
     m_desc.add_options()("check-performance",
                          boost::program_options::bool_switch(&run),
                          "Run performance checks");
+    m_desc.add_options()(
+        "truth-cache", boost::program_options::bool_switch(&truth_cache),
+        "Cache the decoded truth information next to the CSV files");
 }
 
 std::unique_ptr<configuration_printable> performance::as_printable() const {
@@ -27,6 +30,8 @@ std::unique_ptr<configuration_printable> performance::as_printable() const {
 
     cat->add_child(std::make_unique<configuration_kv_pair>(
         "Run performance checks", std::format("{}", run)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Cache truth information", std::format("{}", truth_cache)));
 
     return cat;
 }
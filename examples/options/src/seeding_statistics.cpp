@@ -0,0 +1,34 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/options/seeding_statistics.hpp"
+
+#include "traccc/examples/utils/printable.hpp"
+
+namespace traccc::opts {
+
+seeding_statistics::seeding_statistics()
+    : interface("Seeding Statistics Options") {
+
+    m_desc.add_options()(
+        "seeding-statistics-file",
+        boost::program_options::value(&file)->default_value(file),
+        "JSON file to write host seeding statistics into (empty: do not "
+        "collect statistics)");
+}
+
+std::unique_ptr<configuration_printable> seeding_statistics::as_printable()
+    const {
+    auto cat = std::make_unique<configuration_category>(m_description);
+
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Host seeding statistics file", file.empty() ? "none" : file));
+
+    return cat;
+}
+}  // namespace traccc::opts
@@ -35,6 +35,18 @@ throughput::throughput() : interface("Throughput Measurement Options") {
     m_desc.add_options()("random-seed",
                          po::value(&random_seed)->default_value(random_seed),
                          "Seed for event randomization (0 to use time)");
+    m_desc.add_options()(
+        "stream-input",
+        po::bool_switch(&stream_input)->default_value(stream_input),
+        "Read the input events during the processing");
+    m_desc.add_options()(
+        "input-buffers",
+        po::value(&input_buffers)->default_value(input_buffers),
+        "Number of events to read ahead when streaming the input");
+    m_desc.add_options()(
+        "input-readers",
+        po::value(&input_readers)->default_value(input_readers),
+        "Number of threads reading the input when streaming it");
     m_desc.add_options()(
         "log-file", po::value(&log_file),
         "File where result logs will be printed (in append mode).");
@@ -55,6 +67,14 @@ std::unique_ptr<configuration_printable> throughput::as_printable() const {
     cat->add_child(std::make_unique<configuration_kv_pair>(
         "Random seed",
         random_seed == 0 ? "time-based" : std::to_string(random_seed)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Stream input", std::format("{}", stream_input)));
+    if (stream_input) {
+        cat->add_child(std::make_unique<configuration_kv_pair>(
+            "Input buffers", std::to_string(input_buffers)));
+        cat->add_child(std::make_unique<configuration_kv_pair>(
+            "Input readers", std::to_string(input_readers)));
+    }
 
     return cat;
 }
@@ -12,6 +12,7 @@
 #include "traccc/utils/particle.hpp"
 
 // System include(s).
+#include <format>
 #include <sstream>
 
 namespace traccc::opts {
@@ -71,6 +72,21 @@ track_finding::track_finding() : interface("Track Finding Options") {
         "min-transverse-momentum [GeV]",
         po::value(&m_config.min_p_mag)->default_value(m_config.min_p_mag),
         "Minimum transverse track momentum");
+    m_desc.add_options()(
+        "finding-parallel",
+        po::value(&m_config.parallel)->default_value(m_config.parallel),
+        "Process the track candidates in parallel in the host track finding");
+    m_desc.add_options()(
+        "finding-threads",
+        po::value(&m_config.max_threads)->default_value(m_config.max_threads),
+        "Maximum number of threads for the parallel host track finding (0: "
+        "automatic)");
+    m_desc.add_options()(
+        "finding-measurement-window",
+        po::value(&m_config.use_measurement_window)
+            ->default_value(m_config.use_measurement_window),
+        "Only evaluate the measurements in a window around the predicted "
+        "position in the host track finding");
 }
 
 void track_finding::read(const po::variables_map &vm) {
@@ -128,6 +144,13 @@ std::unique_ptr<configuration_printable> track_finding::as_printable() const {
             "Minimum total track momentum",
             std::to_string(m_config.min_p_mag)));
     }
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Parallel host track finding", std::format("{}", m_config.parallel)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Host track finding threads", std::to_string(m_config.max_threads)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Host track finding measurement window",
+        std::format("{}", m_config.use_measurement_window)));
 
     return cat;
 }
@@ -10,12 +10,46 @@
 
 #include "traccc/examples/utils/printable.hpp"
 
+// System include(s).
+#include <format>
+#include <string>
+
 namespace traccc::opts {
 
-track_seeding::track_seeding() : interface("Track Seeding Options") {}
+/// Convenience namespace shorthand
+namespace po = boost::program_options;
+
+track_seeding::track_seeding() : interface("Track Seeding Options") {
+
+    m_desc.add_options()(
+        "seeding-parallel",
+        po::value(&seedfinder.parallel)->default_value(seedfinder.parallel),
+        "Process the middle spacepoints in parallel in the host seed finding");
+    m_desc.add_options()(
+        "seeding-threads",
+        po::value(&seedfinder.max_threads)
+            ->default_value(seedfinder.max_threads),
+        "Maximum number of threads for the parallel host seed finding (0: "
+        "automatic)");
+    m_desc.add_options()(
+        "seeding-adaptive-z-binning",
+        po::value(&seedfinder.adaptive_z_binning)
+            ->default_value(seedfinder.adaptive_z_binning),
+        "Choose the Z bins of the host seeding per event, based on the "
+        "spacepoint occupancy");
+}
 
 std::unique_ptr<configuration_printable> track_seeding::as_printable() const {
     auto cat = std::make_unique<configuration_category>(m_description);
+
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Parallel host seed finding", std::format("{}", seedfinder.parallel)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Host seed finding threads", std::to_string(seedfinder.max_threads)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Adaptive host seeding Z binning",
+        std::format("{}", seedfinder.adaptive_z_binning)));
+
     return cat;
 }
 }  // namespace traccc::opts
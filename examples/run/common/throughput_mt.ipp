@@ -23,6 +23,8 @@
 #include "traccc/options/track_seeding.hpp"
 
 // I/O include(s).
+#include "traccc/io/cell_event_source.hpp"
+#include "traccc/io/map_data.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_detector.hpp"
 #include "traccc/io/read_detector_description.hpp"
@@ -35,6 +37,7 @@
 
 // VecMem include(s).
 #include <vecmem/memory/binary_page_memory_resource.hpp>
+#include <vecmem/utils/copy.hpp>
 
 // TBB include(s).
 #include <tbb/global_control.h>
@@ -52,6 +55,8 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace traccc {
@@ -103,9 +108,22 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
             detector_opts.material_file, detector_opts.grid_file);
     }
 
-    // Read in all input events into memory.
+    // Read in all input events into memory. Or in case of memory-mappable
+    // input files, just map them, and let the operating system take care of
+    // loading the data during the processing. When streaming the input, the
+    // events are only read during the processing.
     vecmem::vector<edm::silicon_cell_collection::host> input{&uncached_host_mr};
-    {
+    std::vector<io::mapped_cells> mapped_input;
+    if (throughput_opts.stream_input) {
+        // Nothing to do here.
+    } else if (input_opts.format == data_format::mmap) {
+        performance::timer t{"File mapping", times};
+        mapped_input.reserve(input_opts.events);
+        for (std::size_t i = input_opts.skip;
+             i < input_opts.skip + input_opts.events; ++i) {
+            mapped_input.push_back(io::map_cells(i, input_opts.directory));
+        }
+    } else {
         performance::timer t{"File reading", times};
         // Set up the container for the input events.
         input.reserve(input_opts.events);
@@ -193,41 +211,85 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
         std::srand(throughput_opts.random_seed);
     }
 
+    // Helper functions processing a single event, on the current thread.
+    auto process_cells = [&](const edm::silicon_cell_collection::host& cells) {
+        return algs
+            .at(static_cast<std::size_t>(
+                tbb::this_task_arena::current_thread_index()))(cells)
+            .size();
+    };
+    vecmem::copy host_copy;
+    auto process_event = [&](std::size_t event) {
+        if (mapped_input.empty()) {
+            return process_cells(input[event]);
+        }
+        edm::silicon_cell_collection::host cells{uncached_host_mr};
+        host_copy(mapped_input[event].view, cells)->ignore();
+        return process_cells(cells);
+    };
+
     // Dummy count uses output of tp algorithm to ensure the compiler
     // optimisations don't skip any step
     std::atomic_size_t rec_track_params = 0;
 
-    // Cold Run events. To discard any "initialisation issues" in the
-    // measurements.
-    {
-        // Set up a progress bar for the warm-up processing.
+    // Helper function processing a given number of events, while measuring
+    // the time it takes.
+    auto process_events = [&](std::size_t n_events, std::string_view name,
+                              std::string_view prefix) {
+        // Set up a progress bar for the processing.
         indicators::ProgressBar progress_bar{
             indicators::option::BarWidth{50},
-            indicators::option::PrefixText{"Warm-up processing "},
+            indicators::option::PrefixText{std::string{prefix}},
             indicators::option::ShowPercentage{true},
             indicators::option::ShowRemainingTime{true},
-            indicators::option::MaxProgress{throughput_opts.cold_run_events}};
+            indicators::option::MaxProgress{n_events}};
+
+        // Choose which events to process.
+        std::vector<std::size_t> schedule(n_events);
+        for (std::size_t i = 0; i < n_events; ++i) {
+            schedule[i] = (throughput_opts.deterministic_event_order
+                               ? i
+                               : static_cast<std::size_t>(std::rand())) %
+                          input_opts.events;
+        }
 
         // Measure the time of execution.
-        performance::timer t{"Warm-up processing", times};
+        performance::timer t{name, times};
+
+        // When streaming the input, set up the object reading the events in
+        // the background.
+        std::unique_ptr<io::cell_event_source> source;
+        if (throughput_opts.stream_input) {
+            io::cell_event_source::config source_cfg;
+            source_cfg.directory = input_opts.directory;
+            source_cfg.format = input_opts.format;
+            source_cfg.use_acts_geometry_id = input_opts.use_acts_geom_source;
+            source_cfg.n_buffers = throughput_opts.input_buffers;
+            source_cfg.n_readers = throughput_opts.input_readers;
+            std::vector<std::size_t> file_schedule(schedule);
+            for (std::size_t& event : file_schedule) {
+                event += input_opts.skip;
+            }
+            source = std::make_unique<io::cell_event_source>(
+                source_cfg, std::move(file_schedule), &det_descr,
+                uncached_host_mr, logger().cloneWithSuffix("EventSource"));
+        }
 
         // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event =
-                (throughput_opts.deterministic_event_order
-                     ? i
-                     : static_cast<std::size_t>(std::rand())) %
-                input_opts.events;
+        for (std::size_t event : schedule) {
 
             // Launch the processing of the event.
             arena.execute([&, event]() {
                 group.run([&, event]() {
-                    rec_track_params.fetch_add(algs.at(static_cast<std::size_t>(
-                        tbb::this_task_arena::current_thread_index()))(
-                                                       input[event])
-                                                   .size());
+                    if (source) {
+                        const auto streamed = source->next();
+                        if (streamed) {
+                            rec_track_params.fetch_add(
+                                process_cells(streamed->cells()));
+                        }
+                    } else {
+                        rec_track_params.fetch_add(process_event(event));
+                    }
                     progress_bar.tick();
                 });
             });
@@ -235,48 +297,19 @@ int throughput_mt(std::string_view description, int argc, char* argv[],
 
         // Wait for all tasks to finish.
         group.wait();
-    }
+    };
+
+    // Cold Run events. To discard any "initialisation issues" in the
+    // measurements.
+    process_events(throughput_opts.cold_run_events, "Warm-up processing",
+                   "Warm-up processing ");
 
     // Reset the dummy counter.
     rec_track_params = 0;
 
-    {
-        // Set up a progress bar for the event processing.
-        indicators::ProgressBar progress_bar{
-            indicators::option::BarWidth{50},
-            indicators::option::PrefixText{"Event processing   "},
-            indicators::option::ShowPercentage{true},
-            indicators::option::ShowRemainingTime{true},
-            indicators::option::MaxProgress{throughput_opts.processed_events}};
-
-        // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
-
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.processed_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event =
-                (throughput_opts.deterministic_event_order
-                     ? i
-                     : static_cast<std::size_t>(std::rand())) %
-                input_opts.events;
-
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(algs.at(static_cast<std::size_t>(
-                        tbb::this_task_arena::current_thread_index()))(
-                                                       input[event])
-                                                   .size());
-                    progress_bar.tick();
-                });
-            });
-        }
-
-        // Wait for all tasks to finish.
-        group.wait();
-    }
+    // Process the events that are used in the measurement.
+    process_events(throughput_opts.processed_events, "Event processing",
+                   "Event processing   ");
 
     // Delete the algorithms and host memory caches explicitly before their
     // parent object would go out of scope.
@@ -11,7 +11,8 @@
 namespace traccc {
 
 full_chain_algorithm::full_chain_algorithm(
-    vecmem::memory_resource& mr, const clustering_algorithm::config_type&,
+    vecmem::memory_resource& mr,
+    const clustering_algorithm::config_type& clustering_config,
     const seedfinder_config& finder_config,
     const spacepoint_grid_config& grid_config,
     const seedfilter_config& filter_config,
@@ -27,8 +28,13 @@ full_chain_algorithm::full_chain_algorithm(
               m_field_vec)),
       m_det_descr(det_descr),
       m_detector(detector),
-      m_clusterization(mr, logger->cloneWithSuffix("ClusteringAlg")),
+      m_strip_module_pairs(&mr),
+      m_clusterization(clustering_config, mr,
+                       logger->cloneWithSuffix("ClusteringAlg")),
       m_spacepoint_formation(mr, logger->cloneWithSuffix("SpFormationAlg")),
+      m_strip_spacepoint_formation(
+          strip_spacepoint_formation_config{}, mr,
+          logger->cloneWithSuffix("StripSpFormationAlg")),
       m_seeding(finder_config, grid_config, filter_config, mr,
                 logger->cloneWithSuffix("SeedingAlg")),
       m_track_parameter_estimation(mr,
@@ -40,7 +46,14 @@ full_chain_algorithm::full_chain_algorithm(
       m_grid_config(grid_config),
       m_filter_config(filter_config),
       m_finding_config(finding_config),
-      m_fitting_config(fitting_config) {}
+      m_fitting_config(fitting_config) {
+
+    // Find the strip module pairs of the detector, if there are any.
+    if (m_detector != nullptr) {
+        m_strip_module_pairs = m_strip_spacepoint_formation.find_module_pairs(
+            *m_detector, vecmem::get_data(m_det_descr.get()));
+    }
+}
 
 full_chain_algorithm::output_type full_chain_algorithm::operator()(
     const edm::silicon_cell_collection::host& cells) const {
@@ -60,8 +73,28 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
         // Run the seed-finding.
         const measurement_collection_types::const_view measurements_view =
             vecmem::get_data(measurements);
-        const spacepoint_formation_algorithm::output_type spacepoints =
+        spacepoint_formation_algorithm::output_type spacepoints =
             m_spacepoint_formation(*m_detector, measurements_view);
+
+        // Add the strip spacepoints to the pixel ones.
+        if (!m_strip_module_pairs.empty()) {
+            const host::strip_spacepoint_formation_algorithm::output_type
+                strip_spacepoints = m_strip_spacepoint_formation(
+                    *m_detector, vecmem::get_data(m_strip_module_pairs),
+                    measurements_view);
+            const unsigned int offset = spacepoints.size();
+            spacepoints.resize(offset + strip_spacepoints.size());
+            for (unsigned int i = 0; i < strip_spacepoints.size(); ++i) {
+                auto sp = spacepoints.at(offset + i);
+                const auto strip_sp = strip_spacepoints.at(i);
+                sp.measurement_index_1() = strip_sp.measurement_index_1();
+                sp.measurement_index_2() = strip_sp.measurement_index_2();
+                sp.global() = strip_sp.global();
+                sp.z_variance() = strip_sp.z_variance();
+                sp.radius_variance() = strip_sp.radius_variance();
+            }
+        }
+
         const edm::spacepoint_collection::const_data spacepoints_data =
             vecmem::get_data(spacepoints);
         const host::seeding_algorithm::output_type seeds =
@@ -17,6 +17,7 @@
 #include "traccc/geometry/silicon_detector_description.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/silicon_pixel_spacepoint_formation_algorithm.hpp"
+#include "traccc/seeding/strip_spacepoint_formation_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
 #include "traccc/utils/algorithm.hpp"
 #include "traccc/utils/bfield.hpp"
@@ -68,19 +69,18 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
     ///
     /// @param mr The memory resource to use for the intermediate and result
     ///           objects
-    /// @param dummy This is not used anywhere. Allows templating CPU/Device
-    /// algorithm.
+    /// @param clustering_config The configuration of the clusterization
     ///
-    full_chain_algorithm(vecmem::memory_resource& mr,
-                         const clustering_algorithm::config_type& dummy,
-                         const seedfinder_config& finder_config,
-                         const spacepoint_grid_config& grid_config,
-                         const seedfilter_config& filter_config,
-                         const finding_algorithm::config_type& finding_config,
-                         const fitting_algorithm::config_type& fitting_config,
-                         const silicon_detector_description::host& det_descr,
-                         detector_type* detector,
-                         std::unique_ptr<const traccc::Logger> logger);
+    full_chain_algorithm(
+        vecmem::memory_resource& mr,
+        const clustering_algorithm::config_type& clustering_config,
+        const seedfinder_config& finder_config,
+        const spacepoint_grid_config& grid_config,
+        const seedfilter_config& filter_config,
+        const finding_algorithm::config_type& finding_config,
+        const fitting_algorithm::config_type& fitting_config,
+        const silicon_detector_description::host& det_descr,
+        detector_type* detector, std::unique_ptr<const traccc::Logger> logger);
 
     /// Reconstruct track parameters in the entire detector
     ///
@@ -103,6 +103,8 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
         m_det_descr;
     /// Detector
     detector_type* m_detector;
+    /// Back-to-back strip module pairs of the detector
+    strip_module_pair_collection_types::host m_strip_module_pairs;
 
     /// @name Sub-algorithms used by this full-chain algorithm
     /// @{
@@ -111,6 +113,8 @@ class full_chain_algorithm : public algorithm<track_state_container_types::host(
     clustering_algorithm m_clusterization;
     /// Spacepoint formation algorithm
     spacepoint_formation_algorithm m_spacepoint_formation;
+    /// Strip spacepoint formation algorithm
+    host::strip_spacepoint_formation_algorithm m_strip_spacepoint_formation;
     /// Seeding algorithm
     host::seeding_algorithm m_seeding;
     /// Track parameter estimation algorithm
@@ -36,6 +36,7 @@
 #include "traccc/options/input_data.hpp"
 #include "traccc/options/performance.hpp"
 #include "traccc/options/program_options.hpp"
+#include "traccc/options/seeding_statistics.hpp"
 #include "traccc/options/track_finding.hpp"
 #include "traccc/options/track_fitting.hpp"
 #include "traccc/options/track_propagation.hpp"
@@ -49,6 +50,7 @@
 // System include(s).
 #include <cassert>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 
 using namespace traccc;
@@ -61,6 +63,7 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
             const traccc::opts::input_data& input_opts,
             const traccc::opts::detector& detector_opts,
             const traccc::opts::performance& performance_opts,
+            const traccc::opts::seeding_statistics& statistics_opts,
             std::unique_ptr<const traccc::Logger> ilogger) {
     TRACCC_LOCAL_LOGGER(std::move(ilogger));
 
@@ -111,10 +114,12 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
                               detector_opts.material_file,
                               detector_opts.grid_file);
 
-    // Seeding algorithm
-    traccc::host::seeding_algorithm sa(
-        seeding_opts.seedfinder, {seeding_opts.seedfinder},
-        seeding_opts.seedfilter, host_mr, logger().clone("SeedingAlg"));
+    // Seeding algorithm, collecting statistics if they were requested
+    traccc::seedfinder_config finder_config(seeding_opts.seedfinder);
+    finder_config.collect_statistics = !statistics_opts.file.empty();
+    traccc::host::seeding_algorithm sa(finder_config, {finder_config},
+                                       seeding_opts.seedfilter, host_mr,
+                                       logger().clone("SeedingAlg"));
     traccc::host::track_params_estimation tp(host_mr,
                                              logger().clone("TrackParEstAlg"));
 
@@ -221,7 +226,8 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
 
             traccc::event_data evt_data(input_opts.directory, event, host_mr,
                                         input_opts.use_acts_geom_source,
-                                        &detector, input_opts.format, false);
+                                        &detector, input_opts.format, false,
+                                        performance_opts.truth_cache);
 
             sd_performance_writer.write(
                 vecmem::get_data(seeds),
@@ -263,6 +269,18 @@ int seq_run(const traccc::opts::track_seeding& seeding_opts,
                                     << " ambiguity free tracks");
     TRACCC_INFO("- created (cpu)  " << n_fitted_tracks << " fitted tracks");
 
+    // Write the seeding statistics, if they were requested.
+    if (!statistics_opts.file.empty()) {
+        std::ofstream statistics_file(statistics_opts.file);
+        if (!statistics_file.good()) {
+            TRACCC_ERROR("Could not open seeding statistics file: "
+                         << statistics_opts.file);
+            return EXIT_FAILURE;
+        }
+        sa.statistics().write_json(statistics_file);
+        TRACCC_INFO("- wrote seeding statistics to " << statistics_opts.file);
+    }
+
     return EXIT_SUCCESS;
 }
 
@@ -281,10 +299,12 @@ int main(int argc, char* argv[]) {
     traccc::opts::track_resolution resolution_opts;
     traccc::opts::track_fitting fitting_opts;
     traccc::opts::performance performance_opts;
+    traccc::opts::seeding_statistics statistics_opts;
     traccc::opts::program_options program_opts{
         "Full Tracking Chain on the Host (without clusterization)",
         {detector_opts, input_opts, seeding_opts, finding_opts,
-         propagation_opts, resolution_opts, fitting_opts, performance_opts},
+         propagation_opts, resolution_opts, fitting_opts, performance_opts,
+         statistics_opts},
         argc,
         argv,
         logger->cloneWithSuffix("Options")};
@@ -292,5 +312,5 @@ int main(int argc, char* argv[]) {
     // Run the application.
     return seq_run(seeding_opts, finding_opts, propagation_opts,
                    resolution_opts, fitting_opts, input_opts, detector_opts,
-                   performance_opts, logger->clone());
+                   performance_opts, statistics_opts, logger->clone());
 }
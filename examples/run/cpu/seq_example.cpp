@@ -326,7 +326,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
 
             traccc::event_data evt_data(input_opts.directory, event, host_mr,
                                         input_opts.use_acts_geom_source,
-                                        &detector, input_opts.format, true);
+                                        &detector, input_opts.format, true,
+                                        performance_opts.truth_cache);
             evt_data.fill_cca_result(cells_per_event, clusters_per_event,
                                      measurements_per_event, det_descr);
 
@@ -99,16 +99,12 @@ int clustering_run(const traccc::opts::detector& detector_opts,
     uint64_t n_measurements = 0;
     uint64_t n_measurements_cuda = 0;
 
-
-  
-    //traccc::host::clusterization_algorithm ca(host_mr);
-    traccc::host::clusterization_algorithm ca(host_mr, clusterization_opts.use_gower_dbscan);
-	
+    // Algorithms
+    const traccc::host::clusterization_algorithm::config_type host_cl_cfg(
+        clusterization_opts);
+    traccc::host::clusterization_algorithm ca(host_cl_cfg, host_mr);
     traccc::cuda::clusterization_algorithm ca_cuda(mr, copy, stream,
                                                    clusterization_opts);
-    if (clusterization_opts.use_gower_dbscan) {
-    std::cout << "[INFO] Using Gower DBSCAN for clustering" << std::endl;
-    }
     traccc::cuda::measurement_sorting_algorithm ms_cuda(copy, stream);
     
     // performance writer (for cluster and measurement)
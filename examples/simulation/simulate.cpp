@@ -9,6 +9,7 @@
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/edm/track_parameters.hpp"
 #include "traccc/geometry/detector.hpp"
+#include "traccc/io/event_archive.hpp"
 #include "traccc/io/utils.hpp"
 #include "traccc/options/detector.hpp"
 #include "traccc/options/generation.hpp"
@@ -117,6 +118,14 @@ int main(int argc, char* argv[]) {
 
     boost::filesystem::create_directories(full_path);
 
+    // Write all events into a single archive, if requested
+    std::shared_ptr<traccc::io::event_archive_writer> archive;
+    if (output_opts.format == traccc::data_format::archive) {
+        archive = std::make_shared<traccc::io::event_archive_writer>(
+            full_path + "/" + std::string{io::event_archive_filename});
+        smearer_writer_cfg.archive = archive;
+    }
+
     auto sim = traccc::simulator<host_detector_type, b_field_t, generator_type,
                                  writer_type>(
         generation_opts.ptc_type, generation_opts.events, host_det, field,
@@ -126,5 +135,9 @@ int main(int argc, char* argv[]) {
 
     sim.run();
 
+    if (archive) {
+        archive->close();
+    }
+
     return 1;
 }
@@ -0,0 +1,181 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/data_format.hpp"
+
+// Project include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/geometry/silicon_detector_description.hpp"
+#include "traccc/utils/logging.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace traccc::io {
+
+/// Prefetching source of cell events
+///
+/// A pool of reader threads reads the events of a pre-defined schedule into
+/// a fixed number of recycled buffers, ahead of the consumers asking for
+/// them. Once all buffers hold events that were not consumed yet, the
+/// readers wait, so the memory usage of the object does not depend on the
+/// number of events that it serves.
+///
+/// Events are handed out in the order in which their reading finished, which
+/// is not necessarily the order of the schedule.
+///
+class cell_event_source {
+
+    public:
+    /// Configuration for the event source
+    struct config {
+        /// The directory holding the cell data files
+        std::string directory;
+        /// The format of the cell data files
+        data_format format = data_format::csv;
+        /// Whether to deduplicate the cells
+        bool deduplicate = true;
+        /// Whether to treat the geometry IDs as "Acts geometry IDs"
+        bool use_acts_geometry_id = true;
+        /// The number of event buffers, i.e. the maximum number of events
+        /// read ahead of the consumers
+        std::size_t n_buffers = 16u;
+        /// The number of reader threads
+        std::size_t n_readers = 2u;
+    };
+
+    /// Handle to an event held by the source
+    ///
+    /// The event's buffer is given back to the source for re-use when the
+    /// handle is destroyed. Handles must not outlive their source.
+    ///
+    class event {
+
+        public:
+        /// Move constructor
+        event(event&& parent) noexcept;
+        /// Destructor, releasing the event's buffer
+        ~event();
+
+        /// Copy constructor (deleted)
+        event(const event&) = delete;
+        /// Copy assignment (deleted)
+        event& operator=(const event&) = delete;
+        /// Move assignment (deleted)
+        event& operator=(event&&) = delete;
+
+        /// The index of the event
+        std::size_t index() const { return m_index; }
+        /// The cells of the event
+        const edm::silicon_cell_collection::host& cells() const;
+
+        private:
+        /// The source is allowed to create handles
+        friend class cell_event_source;
+        /// Constructor
+        event(cell_event_source& source, std::size_t buffer,
+              std::size_t index);
+
+        /// The source that the event belongs to
+        cell_event_source* m_source;
+        /// Index of the buffer holding the event
+        std::size_t m_buffer;
+        /// Index of the event
+        std::size_t m_index;
+
+    };  // class event
+
+    /// Constructor, starting the reader threads
+    ///
+    /// @param cfg      The configuration of the source
+    /// @param schedule The indices of the events to read, in order
+    /// @param dd       The detector description to point the cells at
+    /// @param mr       The memory resource to create the buffers with
+    /// @param logger   The logger to use
+    ///
+    cell_event_source(
+        const config& cfg, std::vector<std::size_t> schedule,
+        const silicon_detector_description::host* dd,
+        vecmem::memory_resource& mr,
+        std::unique_ptr<const Logger> logger = getDummyLogger().clone());
+    /// Destructor, stopping the reader threads
+    ~cell_event_source();
+
+    /// Copy constructor (deleted)
+    cell_event_source(const cell_event_source&) = delete;
+    /// Copy assignment (deleted)
+    cell_event_source& operator=(const cell_event_source&) = delete;
+
+    /// Get the next event
+    ///
+    /// The call blocks until an event becomes available. Reading errors
+    /// are re-thrown from here.
+    ///
+    /// @return The next event, or an empty optional once all events of the
+    ///         schedule were served
+    ///
+    std::optional<event> next();
+
+    private:
+    /// Function executed by the reader threads
+    void read_events();
+    /// Give an event buffer back for re-use
+    void release(std::size_t buffer);
+
+    /// The configuration of the source
+    config m_config;
+    /// The indices of the events to read
+    std::vector<std::size_t> m_schedule;
+    /// The detector description to point the cells at
+    const silicon_detector_description::host* m_dd;
+    /// The logger of the source
+    std::unique_ptr<const Logger> m_logger;
+
+    /// The event buffers
+    std::vector<edm::silicon_cell_collection::host> m_buffers;
+
+    /// Mutex protecting the state below
+    std::mutex m_mutex;
+    /// Signal for the readers
+    std::condition_variable m_free_cv;
+    /// Signal for the consumers
+    std::condition_variable m_ready_cv;
+    /// Buffers available for reading into
+    std::vector<std::size_t> m_free;
+    /// Buffers holding events, with the index of those events
+    std::deque<std::pair<std::size_t, std::size_t> > m_ready;
+    /// Position of the next event to read in the schedule
+    std::size_t m_next_read = 0u;
+    /// Number of events that finished reading (or failed to)
+    std::size_t m_n_read = 0u;
+    /// The first error that occurred during reading
+    std::exception_ptr m_error;
+    /// Flag telling the readers to stop
+    bool m_stop = false;
+
+    /// The reader threads
+    std::vector<std::thread> m_readers;
+
+};  // class cell_event_source
+
+}  // namespace traccc::io
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -14,10 +14,13 @@ namespace traccc {
 
 /// Format for an input or output file
 enum data_format : int {
-    csv = 0,     ///< Comma-separated values
-    binary = 1,  ///< Binary format
-    json = 2,    ///< JSON format
-    obj = 3,     ///< Wavefront OBJ format
+    csv = 0,                ///< Comma-separated values
+    binary = 1,             ///< Binary format
+    json = 2,               ///< JSON format
+    obj = 3,                ///< Wavefront OBJ format
+    mmap = 4,               ///< Memory-mappable binary format
+    compressed_binary = 5,  ///< Block-compressed binary format
+    archive = 6,            ///< Multi-event archive format
 };
 
 /// Printout helper for @c traccc::data_format
@@ -0,0 +1,77 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace traccc::io::details {
+
+/// Sort measurements the same way as the CSV reader does
+///
+/// Used both when writing and when reading event archives, so that the
+/// measurements of archives are always ordered like the ones read from CSV
+/// files.
+///
+/// @param measurements The measurements to sort
+/// @return The new index of every measurement, at its original position
+///
+inline std::vector<measurement_id_type> sort_measurements(
+    measurement_collection_types::host& measurements) {
+
+    // Find the order of the measurements.
+    std::vector<unsigned int> order(measurements.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(),
+                     [&measurements](unsigned int i, unsigned int j) {
+                         return measurement_sort_comp{}(measurements[i],
+                                                        measurements[j]);
+                     });
+
+    // Re-order the measurements, and remember where each of them went.
+    std::vector<measurement_id_type> result(measurements.size());
+    measurement_collection_types::host sorted(measurements.get_allocator());
+    sorted.reserve(measurements.size());
+    for (unsigned int i = 0u; i < order.size(); ++i) {
+        result[order[i]] = static_cast<measurement_id_type>(i);
+        sorted.push_back(measurements[order[i]]);
+    }
+    measurements.swap(sorted);
+    return result;
+}
+
+/// Update the measurement indices of spacepoints after sorting measurements
+///
+/// @param spacepoints The spacepoints to update
+/// @param new_idx_map The new index of every measurement, at its original
+///                    position
+///
+inline void remap_measurement_indices(
+    edm::spacepoint_collection::host& spacepoints,
+    const std::vector<measurement_id_type>& new_idx_map) {
+
+    auto remap = [&new_idx_map](unsigned int& index) {
+        if (index < new_idx_map.size()) {
+            index = static_cast<unsigned int>(new_idx_map[index]);
+        }
+    };
+    for (unsigned int& index : spacepoints.measurement_index_1()) {
+        remap(index);
+    }
+    for (unsigned int& index : spacepoints.measurement_index_2()) {
+        remap(index);
+    }
+}
+
+}  // namespace traccc::io::details
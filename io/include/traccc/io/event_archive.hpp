@@ -0,0 +1,195 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/io/csv/measurement_hit_id.hpp"
+#include "traccc/edm/particle.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace traccc::io {
+
+/// Name of the archive file inside of an event data directory
+///
+/// This is the file that the @c traccc::data_format::archive flavour of the
+/// event reading functions look for.
+///
+inline constexpr std::string_view event_archive_filename = "events.tccar";
+
+/// Types of data sections stored in an event archive
+enum class event_archive_section : std::uint32_t {
+    cells = 0,             ///< Silicon cells
+    hits = 1,              ///< Spacepoints ("hits")
+    measurements = 2,      ///< Measurements
+    particles = 3,         ///< Truth particles
+    measurement_hits = 4,  ///< Measurement to simulated hit map
+};
+
+/// Entry of the index table of an event archive
+struct event_archive_index_entry {
+    /// Index of the event
+    std::uint64_t event = 0u;
+    /// Type of the section (@c traccc::io::event_archive_section)
+    std::uint32_t type = 0u;
+    /// Padding, for a well defined layout
+    std::uint32_t padding = 0u;
+    /// Offset of the section's payload from the start of the file
+    std::uint64_t offset = 0u;
+    /// Size of the section's payload in bytes
+    std::uint64_t size = 0u;
+};
+
+/// Writer for multi-event archive files
+///
+/// An archive holds the data of any number of events in a single file. The
+/// data sections of the events are appended to the file one after the other,
+/// and an index table, giving the position of every section of every event,
+/// is written at the end of the file when the writer is closed.
+///
+/// All write functions are thread-safe.
+///
+class event_archive_writer {
+
+    public:
+    /// Open a new archive file
+    ///
+    /// @param filename The full name of the archive file to create
+    /// @throws std::runtime_error if the file could not be opened
+    ///
+    explicit event_archive_writer(std::string_view filename);
+    /// Destructor, closing the archive if that was not done yet
+    ~event_archive_writer();
+
+    /// Copy constructor (deleted)
+    event_archive_writer(const event_archive_writer&) = delete;
+    /// Copy assignment (deleted)
+    event_archive_writer& operator=(const event_archive_writer&) = delete;
+
+    /// Write the cells of an event
+    void write(std::size_t event,
+               edm::silicon_cell_collection::const_view cells);
+    /// Write the spacepoints and measurements of an event
+    void write(std::size_t event,
+               edm::spacepoint_collection::const_view spacepoints,
+               measurement_collection_types::const_view measurements);
+    /// Write the measurements of an event
+    void write(std::size_t event,
+               measurement_collection_types::const_view measurements);
+    /// Write the truth particles of an event
+    void write(std::size_t event,
+               particle_collection_types::const_view particles);
+    /// Write the measurement to simulated hit map of an event
+    void write(std::size_t event,
+               const std::vector<csv::measurement_hit_id>& measurement_hits);
+
+    /// Write the index table, and close the file
+    void close();
+
+    private:
+    /// Append a data section to the file
+    void write_section(std::size_t event, event_archive_section type,
+                       const std::vector<std::byte>& payload);
+
+    /// The name of the archive file
+    std::string m_filename;
+    /// Mutex protecting the state below
+    std::mutex m_mutex;
+    /// The output file
+    std::ofstream m_file;
+    /// Position of the next data section in the file
+    std::uint64_t m_offset = 0u;
+    /// Index of the sections written so far
+    std::vector<event_archive_index_entry> m_index;
+
+};  // class event_archive_writer
+
+/// Reader for multi-event archive files
+///
+/// The archive is memory mapped, and its index table is read at
+/// construction. The data sections of individual events are then accessed
+/// directly, in any order. All read functions are thread-safe.
+///
+class event_archive_reader {
+
+    public:
+    /// Open an existing archive file
+    ///
+    /// @param filename The full name of the archive file
+    /// @throws std::runtime_error if the file is not a (complete) archive
+    ///
+    explicit event_archive_reader(std::string_view filename);
+
+    /// Get the (shared) reader of an archive file
+    ///
+    /// The reader of the last opened archive is kept around, so that
+    /// reading many events from the same archive would only open and index
+    /// the file once. The file is re-opened if it changed on disk.
+    ///
+    /// @param filename The full name of the archive file
+    /// @return The reader for the file
+    ///
+    static std::shared_ptr<const event_archive_reader> open(
+        std::string_view filename);
+
+    /// The name of the archive file
+    const std::string& filename() const { return m_filename; }
+    /// The event indices that have at least one section in the archive
+    std::vector<std::size_t> events() const;
+    /// Check whether an event has a given type of section in the archive
+    bool contains(std::size_t event, event_archive_section type) const;
+
+    /// Read the cells of an event
+    void read(std::size_t event,
+              edm::silicon_cell_collection::host& cells) const;
+    /// Read the spacepoints of an event
+    void read(std::size_t event,
+              edm::spacepoint_collection::host& spacepoints) const;
+    /// Read the measurements of an event
+    void read(std::size_t event,
+              measurement_collection_types::host& measurements) const;
+    /// Read the truth particles of an event
+    void read(std::size_t event,
+              particle_collection_types::host& particles) const;
+    /// Read the measurement to simulated hit map of an event
+    void read(std::size_t event,
+              std::vector<csv::measurement_hit_id>& measurement_hits) const;
+
+    private:
+    /// Find the payload of a section in the mapped file
+    std::pair<const std::byte*, std::size_t> section(
+        std::size_t event, event_archive_section type) const;
+
+    /// The name of the archive file
+    std::string m_filename;
+    /// The mapped archive file
+    mapped_file m_file;
+    /// Position (offset, size) of the sections, by event and type
+    std::map<std::pair<std::size_t, event_archive_section>,
+             std::pair<std::size_t, std::size_t> >
+        m_sections;
+
+};  // class event_archive_reader
+
+}  // namespace traccc::io
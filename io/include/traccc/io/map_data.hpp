@@ -0,0 +1,81 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <string_view>
+
+namespace traccc::io {
+
+/// Constant view of some data, memory mapped from a file
+///
+/// The view points directly into the mapped memory, so it is only valid for
+/// as long as the object (or one it was moved into) exists.
+///
+template <typename VIEW_TYPE>
+struct mapped_view {
+    /// The mapped file
+    mapped_file file;
+    /// View of the file's contents
+    VIEW_TYPE view;
+};
+
+/// Cells memory mapped from a file
+using mapped_cells = mapped_view<edm::silicon_cell_collection::const_view>;
+/// Spacepoints memory mapped from a file
+using mapped_spacepoints = mapped_view<edm::spacepoint_collection::const_view>;
+/// Measurements memory mapped from a file
+using mapped_measurements =
+    mapped_view<measurement_collection_types::const_view>;
+
+/// Map the cells of an event, written in @c traccc::data_format::mmap
+///
+/// The file to map is selected according the naming conventions used in
+/// our data.
+///
+/// @param event     The event ID to map the cells for
+/// @param directory The directory holding the cell data files
+/// @return The mapped cells
+///
+mapped_cells map_cells(std::size_t event, std::string_view directory);
+
+/// Map cells written in @c traccc::data_format::mmap
+///
+/// @param filename The name of the file to map
+/// @return The mapped cells
+///
+mapped_cells map_cells(std::string_view filename);
+
+/// Map the spacepoints of an event, written in @c traccc::data_format::mmap
+///
+/// @param event     The event ID to map the spacepoints for
+/// @param directory The directory holding the spacepoint data files
+/// @return The mapped spacepoints
+///
+mapped_spacepoints map_spacepoints(std::size_t event,
+                                   std::string_view directory);
+
+/// Map the measurements of an event, written in @c traccc::data_format::mmap
+///
+/// @param event     The event ID to map the measurements for
+/// @param directory The directory holding the measurement data files
+/// @return The mapped measurements
+///
+mapped_measurements map_measurements(std::size_t event,
+                                     std::string_view directory);
+
+}  // namespace traccc::io
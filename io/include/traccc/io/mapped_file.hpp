@@ -0,0 +1,62 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <string_view>
+
+namespace traccc::io {
+
+/// Read-only, memory mapped view of a file
+///
+/// The file's contents are mapped into the address space of the process
+/// for as long as the object exists. Since the address of the mapping does
+/// not change when the object is moved, views pointing into the mapped
+/// memory stay valid across moves.
+///
+class mapped_file {
+
+    public:
+    /// Default constructor, with no file mapped
+    mapped_file() = default;
+    /// Map the specified file into memory
+    ///
+    /// @param filename The name of the file to map
+    /// @throws std::runtime_error if the file could not be mapped
+    ///
+    explicit mapped_file(std::string_view filename);
+    /// Move constructor
+    mapped_file(mapped_file&& parent) noexcept;
+    /// Destructor, unmapping the file
+    ~mapped_file();
+
+    /// Copy constructor (deleted)
+    mapped_file(const mapped_file&) = delete;
+    /// Copy assignment (deleted)
+    mapped_file& operator=(const mapped_file&) = delete;
+    /// Move assignment
+    mapped_file& operator=(mapped_file&& rhs) noexcept;
+
+    /// Pointer to the beginning of the mapped memory
+    const std::byte* data() const { return m_data; }
+    /// Size of the mapped file in bytes
+    std::size_t size() const { return m_size; }
+
+    private:
+    /// Release the mapping held by the object
+    void unmap();
+
+    /// Pointer to the mapped memory
+    const std::byte* m_data = nullptr;
+    /// Size of the mapped memory
+    std::size_t m_size = 0u;
+
+};  // class mapped_file
+
+}  // namespace traccc::io
@@ -20,6 +20,23 @@ namespace traccc::io {
 ///
 const std::string& data_directory();
 
+/// Get the directory to cache binary snapshots of detector descriptions in
+///
+/// Caching is disabled by default. It is enabled by setting the
+/// @c TRACCC_DETECTOR_CACHE_DIR environment variable to the directory to
+/// use. The snapshots are identified by a magic number and by the version of
+/// the cached container's schema, and are ignored if these do not match.
+///
+/// Only silicon detector descriptions are cached. Detray detectors are
+/// always read from their original files, since they are not flat SoA
+/// containers, and could only be snapshotted with dedicated serialization
+/// support in Detray.
+///
+/// @return The cache directory name, or an empty string if caching is
+///         disabled
+///
+std::string detector_cache_directory();
+
 /// Get the name of a data file for a specific event ID
 ///
 /// @param event The event number to get the file name for
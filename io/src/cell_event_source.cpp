@@ -0,0 +1,157 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/cell_event_source.hpp"
+
+#include "traccc/io/read_cells.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace traccc::io {
+
+cell_event_source::event::event(cell_event_source& source, std::size_t buffer,
+                                std::size_t index)
+    : m_source(&source), m_buffer(buffer), m_index(index) {}
+
+cell_event_source::event::event(event&& parent) noexcept
+    : m_source(std::exchange(parent.m_source, nullptr)),
+      m_buffer(parent.m_buffer),
+      m_index(parent.m_index) {}
+
+cell_event_source::event::~event() {
+
+    if (m_source != nullptr) {
+        m_source->release(m_buffer);
+    }
+}
+
+const edm::silicon_cell_collection::host& cell_event_source::event::cells()
+    const {
+
+    return m_source->m_buffers.at(m_buffer);
+}
+
+cell_event_source::cell_event_source(
+    const config& cfg, std::vector<std::size_t> schedule,
+    const silicon_detector_description::host* dd, vecmem::memory_resource& mr,
+    std::unique_ptr<const Logger> logger)
+    : m_config(cfg),
+      m_schedule(std::move(schedule)),
+      m_dd(dd),
+      m_logger(std::move(logger)) {
+
+    if ((m_config.n_buffers == 0u) || (m_config.n_readers == 0u)) {
+        throw std::invalid_argument(
+            "The event source needs at least one buffer and one reader");
+    }
+
+    // Set up the buffers.
+    m_buffers.reserve(m_config.n_buffers);
+    m_free.reserve(m_config.n_buffers);
+    for (std::size_t i = 0; i < m_config.n_buffers; ++i) {
+        m_buffers.emplace_back(mr);
+        m_free.push_back(i);
+    }
+
+    // Start the readers. There is no point in having more of them than
+    // buffers.
+    const std::size_t n_readers =
+        std::min(m_config.n_readers, m_config.n_buffers);
+    m_readers.reserve(n_readers);
+    for (std::size_t i = 0; i < n_readers; ++i) {
+        m_readers.emplace_back([this]() { read_events(); });
+    }
+}
+
+cell_event_source::~cell_event_source() {
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_stop = true;
+    }
+    m_free_cv.notify_all();
+    for (std::thread& reader : m_readers) {
+        reader.join();
+    }
+}
+
+std::optional<cell_event_source::event> cell_event_source::next() {
+
+    std::unique_lock lock{m_mutex};
+    m_ready_cv.wait(lock, [this]() {
+        return (!m_ready.empty()) || m_error ||
+               (m_n_read == m_schedule.size());
+    });
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+    if (m_ready.empty()) {
+        return std::nullopt;
+    }
+    const auto [buffer, index] = m_ready.front();
+    m_ready.pop_front();
+    return event{*this, buffer, index};
+}
+
+void cell_event_source::read_events() {
+
+    while (true) {
+
+        // Wait for a free buffer, and an event to read into it.
+        std::unique_lock lock{m_mutex};
+        m_free_cv.wait(lock, [this]() {
+            return m_stop || (m_next_read == m_schedule.size()) ||
+                   (!m_free.empty());
+        });
+        if (m_stop || (m_next_read == m_schedule.size())) {
+            return;
+        }
+        const std::size_t buffer = m_free.back();
+        m_free.pop_back();
+        const std::size_t index = m_schedule[m_next_read++];
+        lock.unlock();
+
+        // Read the event.
+        std::exception_ptr error;
+        try {
+            read_cells(m_buffers[buffer], index, m_config.directory,
+                       m_logger->clone(), m_dd, m_config.format,
+                       m_config.deduplicate, m_config.use_acts_geometry_id);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // Hand it over to the consumers.
+        lock.lock();
+        ++m_n_read;
+        if (error) {
+            if (!m_error) {
+                m_error = error;
+            }
+            m_free.push_back(buffer);
+        } else {
+            m_ready.emplace_back(buffer, index);
+        }
+        lock.unlock();
+        m_ready_cv.notify_all();
+    }
+}
+
+void cell_event_source::release(std::size_t buffer) {
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_free.push_back(buffer);
+    }
+    m_free_cv.notify_one();
+}
+
+}  // namespace traccc::io
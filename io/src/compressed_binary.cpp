@@ -0,0 +1,309 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "compressed_binary.hpp"
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace traccc::io::details {
+
+namespace {
+
+/// Longest literal sequence described by a single control byte
+constexpr std::size_t max_literal_length = 128u;
+/// Shortest repeated sequence described by a single control byte
+constexpr std::size_t min_run_length = 2u;
+/// Longest repeated sequence described by a single control byte
+constexpr std::size_t max_run_length = 129u;
+
+/// Number of blocks that a column of a given size is split into
+std::size_t n_blocks(std::size_t n_elements) {
+    return (n_elements + compressed_block_elements - 1u) /
+           compressed_block_elements;
+}
+
+/// Byte-shuffle and run-length encode one block of a column
+///
+/// The encoding uses control bytes, each followed by its data. A control
+/// byte value c below 128 means that c+1 literal bytes follow. Values of 128
+/// and above mean that the single byte following the control byte is
+/// repeated (c-128+2) times.
+///
+std::vector<unsigned char> compress_block(const unsigned char* data,
+                                          std::size_t n_elements,
+                                          std::size_t element_size) {
+
+    // Shuffle the bytes of the elements.
+    const std::size_t size = n_elements * element_size;
+    std::vector<unsigned char> shuffled(size);
+    for (std::size_t i = 0; i < n_elements; ++i) {
+        for (std::size_t b = 0; b < element_size; ++b) {
+            shuffled[b * n_elements + i] = data[i * element_size + b];
+        }
+    }
+
+    // Run-length encode the shuffled bytes.
+    std::vector<unsigned char> result;
+    result.reserve(size + size / max_literal_length + 1u);
+    std::size_t i = 0;
+    std::size_t literal_begin = 0;
+    auto flush_literals = [&](std::size_t end) {
+        while (literal_begin < end) {
+            const std::size_t n =
+                std::min(end - literal_begin, max_literal_length);
+            result.push_back(static_cast<unsigned char>(n - 1u));
+            result.insert(result.end(), shuffled.begin() + literal_begin,
+                          shuffled.begin() + literal_begin + n);
+            literal_begin += n;
+        }
+    };
+    while (i < size) {
+        std::size_t run = 1;
+        while ((i + run < size) && (run < max_run_length) &&
+               (shuffled[i + run] == shuffled[i])) {
+            ++run;
+        }
+        if (run >= min_run_length) {
+            flush_literals(i);
+            result.push_back(
+                static_cast<unsigned char>(128u + run - min_run_length));
+            result.push_back(shuffled[i]);
+            i += run;
+            literal_begin = i;
+        } else {
+            ++i;
+        }
+    }
+    flush_literals(size);
+    return result;
+}
+
+/// Decode and un-shuffle one block of a column
+void decompress_block(const unsigned char* input, std::size_t input_size,
+                      unsigned char* data, std::size_t n_elements,
+                      std::size_t element_size, const std::string& filename) {
+
+    // Decode the run-length encoding.
+    const std::size_t size = n_elements * element_size;
+    std::vector<unsigned char> shuffled(size);
+    std::size_t in = 0, out = 0;
+    while (in < input_size) {
+        const unsigned char control = input[in++];
+        if (control < 128u) {
+            const std::size_t n = control + 1u;
+            if ((in + n > input_size) || (out + n > size)) {
+                break;
+            }
+            std::memcpy(shuffled.data() + out, input + in, n);
+            in += n;
+            out += n;
+        } else {
+            const std::size_t n = control - 128u + min_run_length;
+            if ((in >= input_size) || (out + n > size)) {
+                break;
+            }
+            std::memset(shuffled.data() + out, input[in++], n);
+            out += n;
+        }
+    }
+    if ((in != input_size) || (out != size)) {
+        throw std::runtime_error("Corrupt block in compressed file \"" +
+                                 filename + "\"");
+    }
+
+    // Un-shuffle the bytes of the elements.
+    for (std::size_t i = 0; i < n_elements; ++i) {
+        for (std::size_t b = 0; b < element_size; ++b) {
+            data[i * element_size + b] = shuffled[b * n_elements + i];
+        }
+    }
+}
+
+}  // namespace
+
+void write_compressed_columns(
+    std::string_view filename, std::size_t n_elements,
+    const std::vector<compressed_input_column>& columns) {
+
+    // Compress all blocks of all columns in parallel.
+    const std::size_t blocks_per_column = n_blocks(n_elements);
+    std::vector<std::vector<unsigned char> > blocks(columns.size() *
+                                                    blocks_per_column);
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>{0u, blocks.size()},
+        [&](const tbb::blocked_range<std::size_t>& range) {
+            for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                const compressed_input_column& column =
+                    columns[i / blocks_per_column];
+                const std::size_t first =
+                    (i % blocks_per_column) * compressed_block_elements;
+                const std::size_t n =
+                    std::min(compressed_block_elements, n_elements - first);
+                blocks[i] = compress_block(
+                    static_cast<const unsigned char*>(column.data) +
+                        first * column.element_size,
+                    n, column.element_size);
+            }
+        });
+
+    // Open the output file.
+    const std::string filename_str{filename};
+    std::ofstream out_file(filename_str, std::ios::binary);
+    if (!out_file) {
+        throw std::runtime_error("Could not open file \"" + filename_str +
+                                 "\" for writing");
+    }
+
+    // Write the header and the tables.
+    compressed_file_header header;
+    std::copy(std::begin(compressed_magic), std::end(compressed_magic),
+              header.magic);
+    header.n_columns = static_cast<std::uint32_t>(columns.size());
+    header.n_elements = n_elements;
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const compressed_input_column& column : columns) {
+        const std::uint64_t element_size = column.element_size;
+        out_file.write(reinterpret_cast<const char*>(&element_size),
+                       sizeof(element_size));
+    }
+    for (const std::vector<unsigned char>& block : blocks) {
+        const std::uint64_t block_size = block.size();
+        out_file.write(reinterpret_cast<const char*>(&block_size),
+                       sizeof(block_size));
+    }
+
+    // Write the compressed blocks.
+    for (const std::vector<unsigned char>& block : blocks) {
+        out_file.write(reinterpret_cast<const char*>(block.data()),
+                       static_cast<std::streamsize>(block.size()));
+    }
+
+    // Make sure that everything got written.
+    out_file.flush();
+    if (!out_file) {
+        throw std::runtime_error("Could not write file \"" + filename_str +
+                                 "\"");
+    }
+}
+
+compressed_file load_compressed_file(std::string_view filename,
+                                     std::size_t n_columns) {
+
+    compressed_file result;
+    result.filename = filename;
+    auto fail = [&result](const std::string& what) {
+        throw std::runtime_error("Invalid compressed file \"" +
+                                 result.filename + "\": " + what);
+    };
+
+    // Open the input file.
+    std::ifstream in_file(result.filename, std::ios::binary);
+    if (!in_file) {
+        throw std::runtime_error("Could not open file \"" + result.filename +
+                                 "\"");
+    }
+
+    // Read and check the header.
+    if (!in_file.read(reinterpret_cast<char*>(&result.header),
+                      sizeof(result.header))) {
+        fail("file too small");
+    }
+    if (!std::equal(std::begin(compressed_magic), std::end(compressed_magic),
+                    result.header.magic)) {
+        fail("unknown file type");
+    }
+    if (result.header.version != compressed_version) {
+        fail("unsupported version " + std::to_string(result.header.version));
+    }
+    if (result.header.n_columns != n_columns) {
+        fail("expected " + std::to_string(n_columns) + " columns, found " +
+             std::to_string(result.header.n_columns));
+    }
+
+    // Read the tables.
+    result.element_sizes.resize(n_columns);
+    result.block_sizes.resize(
+        n_columns *
+        n_blocks(static_cast<std::size_t>(result.header.n_elements)));
+    if (!in_file.read(
+            reinterpret_cast<char*>(result.element_sizes.data()),
+            static_cast<std::streamsize>(result.element_sizes.size() *
+                                         sizeof(std::uint64_t))) ||
+        !in_file.read(
+            reinterpret_cast<char*>(result.block_sizes.data()),
+            static_cast<std::streamsize>(result.block_sizes.size() *
+                                         sizeof(std::uint64_t)))) {
+        fail("truncated tables");
+    }
+
+    // Read the compressed payload in one go.
+    result.payload.resize(static_cast<std::size_t>(std::accumulate(
+        result.block_sizes.begin(), result.block_sizes.end(),
+        std::uint64_t{0})));
+    if (!in_file.read(reinterpret_cast<char*>(result.payload.data()),
+                      static_cast<std::streamsize>(result.payload.size()))) {
+        fail("truncated payload");
+    }
+    return result;
+}
+
+void decompress_columns(const compressed_file& file,
+                        const std::vector<compressed_output_column>& columns) {
+
+    // Check that the columns match the file.
+    if (columns.size() != file.element_sizes.size()) {
+        throw std::runtime_error("Column number mismatch for file \"" +
+                                 file.filename + "\"");
+    }
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (columns[i].element_size != file.element_sizes[i]) {
+            throw std::runtime_error("Element size mismatch for file \"" +
+                                     file.filename + "\"");
+        }
+    }
+
+    // Find where each block starts in the payload.
+    std::vector<std::size_t> block_offsets(file.block_sizes.size(), 0u);
+    std::exclusive_scan(file.block_sizes.begin(), file.block_sizes.end(),
+                        block_offsets.begin(), std::size_t{0});
+
+    // Decompress all blocks in parallel.
+    const std::size_t n_elements =
+        static_cast<std::size_t>(file.header.n_elements);
+    const std::size_t blocks_per_column = n_blocks(n_elements);
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>{0u, file.block_sizes.size()},
+        [&](const tbb::blocked_range<std::size_t>& range) {
+            for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                const compressed_output_column& column =
+                    columns[i / blocks_per_column];
+                const std::size_t first =
+                    (i % blocks_per_column) * compressed_block_elements;
+                const std::size_t n =
+                    std::min(compressed_block_elements, n_elements - first);
+                decompress_block(
+                    file.payload.data() + block_offsets[i],
+                    static_cast<std::size_t>(file.block_sizes[i]),
+                    static_cast<unsigned char*>(column.data) +
+                        first * column.element_size,
+                    n, column.element_size, file.filename);
+            }
+        });
+}
+
+}  // namespace traccc::io::details
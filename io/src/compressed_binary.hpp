@@ -0,0 +1,237 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/edm/device.hpp>
+#include <vecmem/edm/host.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace traccc::io::details {
+
+/// @name Layout of the compressed binary
+/// (@c traccc::data_format::compressed_binary) files
+///
+/// The files hold a number of equally sized columns, each of them split into
+/// blocks of @c compressed_block_elements elements. Every block is
+/// byte-shuffled (storing the first bytes of all elements, then the second
+/// bytes, etc.), and then run-length encoded. Since the blocks are
+/// compressed independently, they can also be decompressed in parallel.
+///
+/// The file starts with a @c compressed_file_header, followed by the element
+/// sizes of all columns, and the compressed sizes of all blocks (column by
+/// column), as 64-bit integers. The compressed blocks follow in the same
+/// order.
+///
+/// @{
+
+/// Identifier at the start of every compressed binary file
+static constexpr char compressed_magic[8] = {'T', 'R', 'C', 'C',
+                                             'C', 'B', 'L', 'K'};
+/// Version of the file layout
+static constexpr std::uint32_t compressed_version = 1u;
+/// Number of elements in a (full) block
+static constexpr std::size_t compressed_block_elements = 16384u;
+
+/// Header at the start of the files
+struct compressed_file_header {
+    /// Identifier of the file type
+    char magic[8] = {};
+    /// Version of the file layout
+    std::uint32_t version = compressed_version;
+    /// Number of columns in the file
+    std::uint32_t n_columns = 0u;
+    /// Number of elements in each of the columns
+    std::uint64_t n_elements = 0u;
+};
+
+/// @}
+
+/// Column to write into a compressed binary file
+struct compressed_input_column {
+    /// Pointer to the column's payload
+    const void* data = nullptr;
+    /// Size of one element of the column, in bytes
+    std::size_t element_size = 0u;
+};
+
+/// Column to read from a compressed binary file
+struct compressed_output_column {
+    /// Pointer to the column's (already allocated) payload
+    void* data = nullptr;
+    /// Size of one element of the column, in bytes
+    std::size_t element_size = 0u;
+};
+
+/// Contents of a compressed binary file, before decompression
+struct compressed_file {
+    /// The name of the file (for error messages)
+    std::string filename;
+    /// The file's header
+    compressed_file_header header;
+    /// The element sizes of the columns
+    std::vector<std::uint64_t> element_sizes;
+    /// The compressed sizes of the blocks
+    std::vector<std::uint64_t> block_sizes;
+    /// The compressed payload of all blocks
+    std::vector<unsigned char> payload;
+};
+
+/// Write a set of equally sized columns into a compressed binary file
+///
+/// The blocks are compressed in parallel.
+///
+/// @param filename The full output filename
+/// @param n_elements The number of elements in each of the columns
+/// @param columns The columns to write
+///
+void write_compressed_columns(
+    std::string_view filename, std::size_t n_elements,
+    const std::vector<compressed_input_column>& columns);
+
+/// Load the (still compressed) contents of a compressed binary file
+///
+/// @param filename The full input filename
+/// @param n_columns The number of columns expected in the file
+/// @return The contents of the file
+///
+compressed_file load_compressed_file(std::string_view filename,
+                                     std::size_t n_columns);
+
+/// Decompress the contents of a compressed binary file
+///
+/// The blocks are decompressed in parallel.
+///
+/// @param file The loaded file
+/// @param columns The (appropriately sized) columns to decompress into
+///
+void decompress_columns(const compressed_file& file,
+                        const std::vector<compressed_output_column>& columns);
+
+/// Implementation detail for @c traccc::io::details::write_compressed_soa
+template <std::size_t INDEX, typename... VARTYPES,
+          template <typename> class INTERFACE>
+void write_compressed_soa_impl(
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container,
+    std::vector<compressed_input_column>& columns) {
+
+    // Describe the current variable.
+    const auto& var = container.template get<INDEX>();
+    using value_type =
+        std::remove_cv_t<typename std::decay_t<decltype(var)>::value_type>;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Vector type does not have a standard layout.");
+    columns.push_back({var.data(), sizeof(value_type)});
+
+    // Recurse into the next variable.
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        write_compressed_soa_impl<INDEX + 1>(container, columns);
+    }
+}
+
+/// Function writing an SoA container into a compressed binary file
+///
+/// Only containers made up of 1D vector variables are supported.
+///
+/// @param filename The full output filename
+/// @param container The container to write
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void write_compressed_soa(
+    std::string_view filename,
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container) {
+
+    std::vector<compressed_input_column> columns;
+    columns.reserve(sizeof...(VARTYPES));
+    write_compressed_soa_impl<0>(container, columns);
+    write_compressed_columns(filename, container.size(), columns);
+}
+
+/// Function writing a collection into a compressed binary file
+///
+/// @param filename The full output filename
+/// @param collection The collection to write
+///
+template <typename collection_t>
+void write_compressed_collection(std::string_view filename,
+                                 const collection_t& collection) {
+
+    using value_type = std::remove_cv_t<typename collection_t::value_type>;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Collection item type must have standard layout.");
+    write_compressed_columns(filename, collection.size(),
+                             {{collection.data(), sizeof(value_type)}});
+}
+
+/// Implementation detail for @c traccc::io::details::read_compressed_soa
+template <std::size_t INDEX, typename... VARTYPES,
+          template <typename> class INTERFACE>
+void read_compressed_soa_impl(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    std::size_t n_elements, std::vector<compressed_output_column>& columns) {
+
+    // Set up the current variable.
+    auto& var = result.template get<INDEX>();
+    using value_type = typename std::decay_t<decltype(var)>::value_type;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Vector type does not have a standard layout.");
+    var.resize(n_elements);
+    columns.push_back({var.data(), sizeof(value_type)});
+
+    // Recurse into the next variable.
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        read_compressed_soa_impl<INDEX + 1>(result, n_elements, columns);
+    }
+}
+
+/// Function reading an SoA container from a compressed binary file
+///
+/// @param result The container to fill
+/// @param filename The full input filename
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void read_compressed_soa(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    std::string_view filename) {
+
+    const compressed_file file =
+        load_compressed_file(filename, sizeof...(VARTYPES));
+    std::vector<compressed_output_column> columns;
+    columns.reserve(sizeof...(VARTYPES));
+    read_compressed_soa_impl<0>(
+        result, static_cast<std::size_t>(file.header.n_elements), columns);
+    decompress_columns(file, columns);
+}
+
+/// Function reading a collection from a compressed binary file
+///
+/// @param result The collection to fill
+/// @param filename The full input filename
+///
+template <typename collection_t>
+void read_compressed_collection(collection_t& result,
+                                std::string_view filename) {
+
+    using value_type = typename collection_t::value_type;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Collection item type must have standard layout.");
+    const compressed_file file = load_compressed_file(filename, 1u);
+    result.resize(static_cast<std::size_t>(file.header.n_elements));
+    decompress_columns(file, {{result.data(), sizeof(value_type)}});
+}
+
+}  // namespace traccc::io::details
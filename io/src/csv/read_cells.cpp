@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2025 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -14,10 +14,12 @@
 // System include(s).
 #include <algorithm>
 #include <cassert>
-#include <iostream>
-#include <map>
-#include <set>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -28,7 +30,9 @@ namespace {
 struct cell_order {
     bool operator()(const traccc::io::csv::cell& lhs,
                     const traccc::io::csv::cell& rhs) const {
-        if (lhs.channel1 != rhs.channel1) {
+        if (lhs.geometry_id != rhs.geometry_id) {
+            return (lhs.geometry_id < rhs.geometry_id);
+        } else if (lhs.channel1 != rhs.channel1) {
             return (lhs.channel1 < rhs.channel1);
         } else {
             return (lhs.channel0 < rhs.channel0);
@@ -36,74 +40,74 @@ struct cell_order {
     }
 };  // struct cell_order
 
-std::map<std::uint64_t, std::vector<traccc::io::csv::cell> >
-read_deduplicated_cells(std::string_view filename,
-                        std::unique_ptr<const traccc::Logger> ilogger) {
-    TRACCC_LOCAL_LOGGER(std::move(ilogger));
+/// Lookup table from geometry IDs to detector description indices
+struct geometry_id_index {
+    /// Whether Acts or Detray geometry IDs were used
+    bool use_acts_geometry_id = true;
+    /// The geometry IDs of the detector description, in order
+    std::vector<std::uint64_t> geometry_ids;
+    /// The lookup table
+    std::unordered_map<std::uint64_t, unsigned int> index;
+};  // struct geometry_id_index
+
+/// Get the geometry ID of one module of a detector description
+std::uint64_t module_geometry_id(
+    const traccc::silicon_detector_description::host& dd, unsigned int i,
+    bool use_acts_geometry_id) {
+
+    return (use_acts_geometry_id ? dd.acts_geometry_id()[i]
+                                 : dd.geometry_id()[i].value());
+}
 
-    // Temporary storage for all the cells and modules.
-    std::map<std::uint64_t,
-             std::map<traccc::io::csv::cell, float, ::cell_order> >
-        cellMap;
-
-    // Construct the cell reader object.
-    auto reader = traccc::io::csv::make_cell_reader(filename);
-
-    // Read all cells from input file.
-    traccc::io::csv::cell iocell;
-    unsigned int nduplicates = 0;
-    while (reader.read(iocell)) {
-
-        // Add the cell to the module. At this point the module link of the
-        // cells is not set up correctly yet.
-        auto ret = cellMap[iocell.geometry_id].insert({iocell, iocell.value});
-        if (ret.second == false) {
-            cellMap[iocell.geometry_id].at(iocell) += iocell.value;
-            ++nduplicates;
-        }
-    }
-    if (nduplicates > 0) {
-        TRACCC_WARNING(nduplicates << " duplicate cells found in " << filename);
+/// Get a (cached) geometry ID lookup table for a detector description
+///
+/// Building the table for a full detector is much more expensive than
+/// reading the cells of a single event, so the table of the last detector
+/// description is kept around. It is re-used for any detector description
+/// with the same geometry IDs, which is checked with a single comparison
+/// pass over them.
+///
+std::shared_ptr<const geometry_id_index> get_geometry_id_index(
+    const traccc::silicon_detector_description::host& dd,
+    bool use_acts_geometry_id) {
+
+    const unsigned int n_modules = static_cast<unsigned int>(dd.size());
+
+    // Check whether the cached table can be used.
+    static std::mutex cache_mutex;
+    static std::shared_ptr<const geometry_id_index> cache;
+    std::shared_ptr<const geometry_id_index> cached;
+    {
+        std::lock_guard lock{cache_mutex};
+        cached = cache;
     }
-
-    // Create and fill the result container. With summed activation values.
-    std::map<std::uint64_t, std::vector<traccc::io::csv::cell> > result;
-    for (const auto& [geometry_id, cells] : cellMap) {
-        for (const auto& [cell, value] : cells) {
-            traccc::io::csv::cell summed_cell{cell};
-            summed_cell.value = value;
-            result[geometry_id].push_back(summed_cell);
+    if (cached && (cached->use_acts_geometry_id == use_acts_geometry_id) &&
+        (cached->geometry_ids.size() == n_modules)) {
+        bool same_ids = true;
+        for (unsigned int i = 0; same_ids && (i < n_modules); ++i) {
+            same_ids = (cached->geometry_ids[i] ==
+                        module_geometry_id(dd, i, use_acts_geometry_id));
+        }
+        if (same_ids) {
+            return cached;
         }
     }
 
-    // Return the container.
-    return result;
-}
-
-std::map<std::uint64_t, std::vector<traccc::io::csv::cell> > read_all_cells(
-    std::string_view filename) {
-
-    // The result container.
-    std::map<std::uint64_t, std::vector<traccc::io::csv::cell> > result;
-
-    // Construct the cell reader object.
-    auto reader = traccc::io::csv::make_cell_reader(filename);
-
-    // Read all cells from input file.
-    traccc::io::csv::cell iocell;
-    while (reader.read(iocell)) {
-
-        // Add the cell to the module. At this point the module link of the
-        // cells is not set up correctly yet.
-        result[iocell.geometry_id].push_back(iocell);
-    }
-
-    // Sort the cells. Deduplication or not, they do need to be sorted.
-    for (auto& [_, cells] : result) {
-        std::sort(cells.begin(), cells.end(), ::cell_order());
+    // Build a new table.
+    auto result = std::make_shared<geometry_id_index>();
+    result->use_acts_geometry_id = use_acts_geometry_id;
+    result->geometry_ids.reserve(n_modules);
+    result->index.reserve(n_modules);
+    for (unsigned int i = 0; i < n_modules; ++i) {
+        const std::uint64_t id =
+            module_geometry_id(dd, i, use_acts_geometry_id);
+        result->geometry_ids.push_back(id);
+        result->index[id] = i;
     }
 
-    // Return the container.
+    // Cache it, and return it.
+    std::lock_guard lock{cache_mutex};
+    cache = result;
     return result;
 }
 
@@ -117,50 +121,87 @@ void read_cells(edm::silicon_cell_collection::host& cells,
                 const silicon_detector_description::host* dd, bool deduplicate,
                 bool use_acts_geometry_id) {
 
-    // Clear the output container.
-    cells.resize(0u);
+    TRACCC_LOCAL_LOGGER(std::move(ilogger));
 
-    // Get the cells and modules into an intermediate format.
-    auto cellsMap =
-        (deduplicate ? read_deduplicated_cells(filename, ilogger->clone())
-                     : read_all_cells(filename));
+    // Read all cells from the input file into a flat array.
+    std::vector<csv::cell> iocells;
+    {
+        auto reader = make_cell_reader(filename);
+        csv::cell iocell;
+        while (reader.read(iocell)) {
+            iocells.push_back(iocell);
+        }
+    }
 
-    // If there is a detector description object, build a map of geometry IDs
-    // to indices inside the detector description.
-    std::map<geometry_id, unsigned int> geomIdMap;
-    if (dd) {
-        if (use_acts_geometry_id) {
-            for (unsigned int i = 0; i < dd->acts_geometry_id().size(); ++i) {
-                geomIdMap[dd->acts_geometry_id()[i]] = i;
-            }
-        } else {
-            for (unsigned int i = 0; i < dd->geometry_id().size(); ++i) {
-                geomIdMap[dd->geometry_id()[i].value()] = i;
+    // Sort the cells by module, and by their position inside the module. The
+    // sort is stable, so that duplicate cells would remain in their original
+    // order.
+    std::stable_sort(iocells.begin(), iocells.end(), ::cell_order());
+
+    // Merge duplicate cells, which are now next to each other. The first
+    // occurrence of a cell is kept, with the summed activation of all of its
+    // copies.
+    if (deduplicate) {
+        auto is_same_cell = [](const csv::cell& lhs, const csv::cell& rhs) {
+            return ((lhs.geometry_id == rhs.geometry_id) &&
+                    (lhs.channel1 == rhs.channel1) &&
+                    (lhs.channel0 == rhs.channel0));
+        };
+        std::size_t n_unique = 0;
+        for (std::size_t i = 0; i < iocells.size(); ++i) {
+            if ((n_unique > 0) &&
+                is_same_cell(iocells[n_unique - 1], iocells[i])) {
+                iocells[n_unique - 1].value += iocells[i].value;
+            } else {
+                iocells[n_unique++] = iocells[i];
             }
         }
+        const std::size_t n_duplicates = iocells.size() - n_unique;
+        if (n_duplicates > 0) {
+            TRACCC_WARNING(n_duplicates << " duplicate cells found in "
+                                        << filename);
+        }
+        iocells.resize(n_unique);
     }
 
-    // Fill the output containers with the ordered cells and modules.
-    for (const auto& [geometry_id, cellz] : cellsMap) {
+    // Get the geometry ID lookup table, if there is a detector description.
+    std::shared_ptr<const ::geometry_id_index> geomIdIndex;
+    if (dd) {
+        geomIdIndex = ::get_geometry_id_index(*dd, use_acts_geometry_id);
+    }
 
-        // Figure out the index of the detector description object, for this
-        // group of cells.
-        unsigned int ddIndex = 0;
-        if (dd) {
-            auto it = geomIdMap.find(geometry_id);
-            if (it == geomIdMap.end()) {
+    // Fill the output container.
+    const std::size_t n_cells = iocells.size();
+    cells.resize(static_cast<unsigned int>(n_cells));
+    auto& channel0 = cells.channel0();
+    auto& channel1 = cells.channel1();
+    auto& activation = cells.activation();
+    auto& time = cells.time();
+    auto& module_index = cells.module_index();
+    unsigned int ddIndex = 0;
+    for (std::size_t i = 0; i < n_cells; ++i) {
+
+        const csv::cell& iocell = iocells[i];
+
+        // Figure out the index of the detector description object, once for
+        // every module.
+        if (geomIdIndex &&
+            ((i == 0) || (iocell.geometry_id != iocells[i - 1].geometry_id))) {
+            auto it = geomIdIndex->index.find(iocell.geometry_id);
+            if (it == geomIdIndex->index.end()) {
                 throw std::runtime_error("Could not find geometry ID (" +
-                                         std::to_string(geometry_id) +
+                                         std::to_string(iocell.geometry_id) +
                                          ") in the detector description");
             }
             ddIndex = it->second;
         }
 
-        // Add the cells to the output.
-        for (auto& cell : cellz) {
-            cells.push_back({cell.channel0, cell.channel1, cell.value,
-                             cell.timestamp, ddIndex});
-        }
+        // Add the cell to the output.
+        channel0[i] = iocell.channel0;
+        channel1[i] = iocell.channel1;
+        activation[i] = iocell.value;
+        time[i] = iocell.timestamp;
+        module_index[i] = ddIndex;
     }
 }
 
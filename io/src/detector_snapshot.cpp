@@ -0,0 +1,110 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "detector_snapshot.hpp"
+
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace traccc::io::details {
+
+namespace {
+
+/// FNV-1a offset basis
+constexpr std::uint64_t fnv_offset = 14695981039346656037ull;
+/// FNV-1a prime
+constexpr std::uint64_t fnv_prime = 1099511628211ull;
+
+/// Add a block of bytes to an FNV-1a hash, 8 bytes at a time
+std::uint64_t hash_bytes(std::uint64_t hash, const char* data,
+                         std::size_t size) {
+
+    std::size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+        std::uint64_t word = 0u;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * fnv_prime;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * fnv_prime;
+    }
+    return hash;
+}
+
+}  // namespace
+
+std::uint64_t content_hash(const std::vector<std::string>& filenames,
+                           std::string_view parameters) {
+
+    std::uint64_t hash =
+        hash_bytes(fnv_offset, parameters.data(), parameters.size());
+    std::vector<char> buffer(1u << 20);
+    for (const std::string& filename : filenames) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Could not open file \"" + filename +
+                                     "\"");
+        }
+        hash = hash_bytes(hash, filename.data(), filename.size());
+        while (file) {
+            file.read(buffer.data(),
+                      static_cast<std::streamsize>(buffer.size()));
+            hash = hash_bytes(hash, buffer.data(),
+                              static_cast<std::size_t>(file.gcount()));
+        }
+    }
+    return hash;
+}
+
+std::string snapshot_filename(std::string_view kind, std::uint64_t hash) {
+
+    const std::string directory = detector_cache_directory();
+    if (directory.empty()) {
+        return {};
+    }
+    std::ostringstream name;
+    name << kind << '-' << std::hex << std::setfill('0') << std::setw(16)
+         << hash << ".snap";
+    return (std::filesystem::path{directory} / name.str()).native();
+}
+
+std::string snapshot_temp_filename(std::string_view filename) {
+
+    // Make sure that the cache directory exists.
+    const std::filesystem::path path{filename};
+    std::filesystem::create_directories(path.parent_path());
+
+    // Make the name unique between threads and processes.
+    std::ostringstream name;
+    name << filename << ".tmp."
+         << std::hash<std::thread::id>{}(std::this_thread::get_id()) << '.'
+         << std::chrono::steady_clock::now().time_since_epoch().count();
+    return name.str();
+}
+
+void commit_snapshot(const std::string& temp_filename,
+                     const std::string& filename) {
+
+    std::error_code ec;
+    std::filesystem::rename(temp_filename, filename, ec);
+    if (ec) {
+        std::filesystem::remove(temp_filename, ec);
+    }
+}
+
+}  // namespace traccc::io::details
@@ -0,0 +1,135 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "read_mmap.hpp"
+#include "write_mmap.hpp"
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace traccc::io::details {
+
+/// @name Detector snapshots
+///
+/// Snapshots are memory-mappable files (see @c mmap_format.hpp), identified
+/// in their headers by @c snapshot_magic and by the version of the schema of
+/// the container that they hold. Snapshots with a different identification
+/// are ignored, and get overwritten by an up to date snapshot.
+///
+/// Only silicon detector descriptions are snapshotted. Detray detectors are
+/// not flat SoA containers, but (nested) collections of surfaces, volumes,
+/// materials and acceleration structures, which could only be snapshotted
+/// with dedicated serialization support in Detray itself. They are always
+/// read from their original (JSON) files.
+///
+/// @{
+
+/// Identifier of all snapshot files
+static constexpr std::array<char, 8> snapshot_magic = {'T', 'R', 'C', 'C',
+                                                       'S', 'N', 'A', 'P'};
+
+/// @}
+
+/// Calculate a hash of the contents of a set of files
+///
+/// @param filenames The (full) names of the files to hash
+/// @param parameters Additional parameters to include in the hash
+/// @return The hash of the files and the parameters
+///
+std::uint64_t content_hash(const std::vector<std::string>& filenames,
+                           std::string_view parameters);
+
+/// Get the name of the snapshot file for some content
+///
+/// @param kind The kind of data held by the snapshot
+/// @param hash The hash of the content that the snapshot was made from
+/// @return The full name of the snapshot file, or an empty string if
+///         snapshots are disabled
+///
+std::string snapshot_filename(std::string_view kind, std::uint64_t hash);
+
+/// Get a unique, temporary name to write a snapshot file under
+///
+/// Snapshots are written under a temporary name, and then renamed, so that
+/// concurrent jobs would never see partially written snapshots.
+///
+/// @param filename The final name of the snapshot file
+/// @return A temporary name in the same directory
+///
+std::string snapshot_temp_filename(std::string_view filename);
+
+/// Give a finished snapshot its final name
+///
+/// @param temp_filename The temporary name of the snapshot file
+/// @param filename The final name of the snapshot file
+///
+void commit_snapshot(const std::string& temp_filename,
+                     const std::string& filename);
+
+/// Try to read an SoA container from a snapshot file
+///
+/// @param result The container to fill
+/// @param filename The full name of the snapshot file
+/// @param schema_version The version of the container's schema
+/// @return @c true if the snapshot could be read, @c false otherwise
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+bool read_snapshot(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    const std::string& filename, std::uint32_t schema_version) {
+
+    if (filename.empty()) {
+        return false;
+    }
+    try {
+        read_mmap_soa(result, filename, {snapshot_magic, schema_version});
+        return true;
+    } catch (const std::exception&) {
+        // A missing or unusable snapshot just means that the data needs to
+        // be read from its original source.
+        result.resize(0);
+        return false;
+    }
+}
+
+/// Try to write an SoA container into a snapshot file
+///
+/// Failures are ignored, since the snapshots are only an optimization.
+///
+/// @param filename The full name of the snapshot file
+/// @param container The container to write
+/// @param schema_version The version of the container's schema
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void write_snapshot(
+    const std::string& filename,
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container,
+    std::uint32_t schema_version) {
+
+    if (filename.empty()) {
+        return;
+    }
+    try {
+        const std::string temp_filename = snapshot_temp_filename(filename);
+        write_mmap_soa(temp_filename, container,
+                       {snapshot_magic, schema_version});
+        commit_snapshot(temp_filename, filename);
+    } catch (const std::exception&) {
+        // The data will just be read from its original source again.
+    }
+}
+
+}  // namespace traccc::io::details
@@ -0,0 +1,509 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/event_archive.hpp"
+
+// VecMem include(s).
+#include <vecmem/edm/device.hpp>
+#include <vecmem/edm/host.hpp>
+
+// System include(s).
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <type_traits>
+
+namespace traccc::io {
+
+namespace {
+
+/// Identifier at the start of every archive file
+constexpr char archive_magic[8] = {'T', 'R', 'C', 'C', 'A', 'R', 'C', 'H'};
+/// Version of the archive layout
+constexpr std::uint32_t archive_version = 1u;
+
+/// Header at the start of the archive files
+///
+/// The header is followed by the payloads of the data sections, and then by
+/// the index table, made up of @c n_entries
+/// @c traccc::io::event_archive_index_entry objects.
+///
+struct archive_header {
+    /// Identifier of the file type
+    char magic[8] = {};
+    /// Version of the file layout
+    std::uint32_t version = archive_version;
+    /// Padding, for a well defined layout
+    std::uint32_t padding = 0u;
+    /// Number of entries in the index table
+    std::uint64_t n_entries = 0u;
+    /// Offset of the index table from the start of the file, or 0 if the
+    /// archive was not closed (yet)
+    std::uint64_t index_offset = 0u;
+};
+
+/// Column of a data section to write
+struct input_column {
+    /// Pointer to the column's payload
+    const void* data = nullptr;
+    /// Size of one element of the column, in bytes
+    std::size_t element_size = 0u;
+};
+
+/// Column of a data section to read into
+struct output_column {
+    /// Pointer to the column's (already allocated) payload
+    void* data = nullptr;
+    /// Size of one element of the column, in bytes
+    std::size_t element_size = 0u;
+};
+
+/// Serialize a set of equally sized columns into a section payload
+///
+/// A payload holds the number of elements, the number of columns and the
+/// element sizes of the columns (all as 64-bit integers), followed by the
+/// contents of the columns, one after the other.
+///
+std::vector<std::byte> pack_columns(std::size_t n_elements,
+                                    const std::vector<input_column>& columns) {
+
+    std::size_t size = (2u + columns.size()) * sizeof(std::uint64_t);
+    for (const input_column& column : columns) {
+        size += n_elements * column.element_size;
+    }
+    std::vector<std::byte> result(size);
+    std::byte* ptr = result.data();
+    auto append = [&ptr](const void* data, std::size_t bytes) {
+        if (bytes > 0u) {
+            std::memcpy(ptr, data, bytes);
+            ptr += bytes;
+        }
+    };
+    const std::uint64_t header[2] = {n_elements, columns.size()};
+    append(header, sizeof(header));
+    for (const input_column& column : columns) {
+        const std::uint64_t element_size = column.element_size;
+        append(&element_size, sizeof(element_size));
+    }
+    for (const input_column& column : columns) {
+        append(column.data, n_elements * column.element_size);
+    }
+    return result;
+}
+
+/// Read the number of elements stored in a section payload
+std::size_t payload_elements(const std::byte* payload, std::size_t size,
+                             const std::string& filename) {
+
+    std::uint64_t header[2] = {0u, 0u};
+    if (size < sizeof(header)) {
+        throw std::runtime_error("Truncated section in archive \"" +
+                                 filename + "\"");
+    }
+    std::memcpy(header, payload, sizeof(header));
+    if (header[0] > size) {
+        throw std::runtime_error("Corrupt section in archive \"" + filename +
+                                 "\"");
+    }
+    return static_cast<std::size_t>(header[0]);
+}
+
+/// Copy the columns of a section payload into (appropriately sized) columns
+void unpack_columns(const std::byte* payload, std::size_t size,
+                    const std::vector<output_column>& columns,
+                    const std::string& filename) {
+
+    auto fail = [&filename](const std::string& what) {
+        throw std::runtime_error("Invalid section in archive \"" + filename +
+                                 "\": " + what);
+    };
+
+    // Check the layout of the section.
+    const std::size_t n_elements = payload_elements(payload, size, filename);
+    std::uint64_t n_columns = 0u;
+    std::memcpy(&n_columns, payload + sizeof(std::uint64_t),
+                sizeof(n_columns));
+    if (n_columns != columns.size()) {
+        fail("expected " + std::to_string(columns.size()) +
+             " columns, found " + std::to_string(n_columns));
+    }
+    std::size_t expected_size = (2u + columns.size()) * sizeof(std::uint64_t);
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        std::uint64_t element_size = 0u;
+        std::memcpy(&element_size,
+                    payload + (2u + i) * sizeof(std::uint64_t),
+                    sizeof(element_size));
+        if (element_size != columns[i].element_size) {
+            fail("element size mismatch");
+        }
+        expected_size += n_elements * columns[i].element_size;
+    }
+    if (expected_size != size) {
+        fail("size mismatch");
+    }
+
+    // Copy the payload.
+    const std::byte* ptr =
+        payload + (2u + columns.size()) * sizeof(std::uint64_t);
+    for (const output_column& column : columns) {
+        const std::size_t bytes = n_elements * column.element_size;
+        if (bytes > 0u) {
+            std::memcpy(column.data, ptr, bytes);
+            ptr += bytes;
+        }
+    }
+}
+
+/// Collect the columns of an SoA container
+template <std::size_t INDEX, typename... VARTYPES,
+          template <typename> class INTERFACE>
+void soa_columns(
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container,
+    std::vector<input_column>& columns) {
+
+    const auto& var = container.template get<INDEX>();
+    using value_type =
+        std::remove_cv_t<typename std::decay_t<decltype(var)>::value_type>;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Vector type does not have a standard layout.");
+    columns.push_back({var.data(), sizeof(value_type)});
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        soa_columns<INDEX + 1>(container, columns);
+    }
+}
+
+/// Serialize an SoA container into a section payload
+template <typename... VARTYPES, template <typename> class INTERFACE>
+std::vector<std::byte> pack_soa(
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container) {
+
+    std::vector<input_column> columns;
+    columns.reserve(sizeof...(VARTYPES));
+    soa_columns<0>(container, columns);
+    return pack_columns(container.size(), columns);
+}
+
+/// Serialize a collection into a section payload
+template <typename T>
+std::vector<std::byte> pack_collection(
+    const vecmem::data::vector_view<const T>& collection) {
+
+    static_assert(std::is_standard_layout_v<T>,
+                  "Collection item type must have standard layout.");
+    return pack_columns(collection.size(), {{collection.ptr(), sizeof(T)}});
+}
+
+/// Size the variables of an SoA container, and collect its columns
+template <std::size_t INDEX, typename... VARTYPES,
+          template <typename> class INTERFACE>
+void soa_columns(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    std::size_t n_elements, std::vector<output_column>& columns) {
+
+    auto& var = result.template get<INDEX>();
+    using value_type = typename std::decay_t<decltype(var)>::value_type;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Vector type does not have a standard layout.");
+    var.resize(n_elements);
+    columns.push_back({var.data(), sizeof(value_type)});
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        soa_columns<INDEX + 1>(result, n_elements, columns);
+    }
+}
+
+/// De-serialize an SoA container from a section payload
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void unpack_soa(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    std::pair<const std::byte*, std::size_t> payload,
+    const std::string& filename) {
+
+    std::vector<output_column> columns;
+    columns.reserve(sizeof...(VARTYPES));
+    soa_columns<0>(result,
+                   payload_elements(payload.first, payload.second, filename),
+                   columns);
+    unpack_columns(payload.first, payload.second, columns, filename);
+}
+
+/// De-serialize a collection from a section payload
+template <typename collection_t>
+void unpack_collection(collection_t& result,
+                       std::pair<const std::byte*, std::size_t> payload,
+                       const std::string& filename) {
+
+    using value_type = typename collection_t::value_type;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Collection item type must have standard layout.");
+    result.resize(payload_elements(payload.first, payload.second, filename));
+    unpack_columns(payload.first, payload.second,
+                   {{result.data(), sizeof(value_type)}}, filename);
+}
+
+}  // namespace
+
+event_archive_writer::event_archive_writer(std::string_view filename)
+    : m_filename(filename), m_file(m_filename, std::ios::binary) {
+
+    if (!m_file) {
+        throw std::runtime_error("Could not open file \"" + m_filename +
+                                 "\" for writing");
+    }
+
+    // Write a placeholder header, which is only finalized on closing.
+    const archive_header header;
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_offset = sizeof(header);
+}
+
+event_archive_writer::~event_archive_writer() {
+
+    try {
+        close();
+    } catch (...) {
+        // Errors can not be reported from the destructor.
+    }
+}
+
+void event_archive_writer::write(
+    std::size_t event, edm::silicon_cell_collection::const_view cells) {
+
+    write_section(event, event_archive_section::cells,
+                  pack_soa(edm::silicon_cell_collection::const_device{cells}));
+}
+
+void event_archive_writer::write(
+    std::size_t event, edm::spacepoint_collection::const_view spacepoints,
+    measurement_collection_types::const_view measurements) {
+
+    write_section(
+        event, event_archive_section::hits,
+        pack_soa(edm::spacepoint_collection::const_device{spacepoints}));
+    write(event, measurements);
+}
+
+void event_archive_writer::write(
+    std::size_t event, measurement_collection_types::const_view measurements) {
+
+    write_section(event, event_archive_section::measurements,
+                  pack_collection(measurements));
+}
+
+void event_archive_writer::write(
+    std::size_t event, particle_collection_types::const_view particles) {
+
+    write_section(event, event_archive_section::particles,
+                  pack_collection(particles));
+}
+
+void event_archive_writer::write(
+    std::size_t event,
+    const std::vector<csv::measurement_hit_id>& measurement_hits) {
+
+    static_assert(std::is_standard_layout_v<csv::measurement_hit_id>,
+                  "Collection item type must have standard layout.");
+    write_section(event, event_archive_section::measurement_hits,
+                  pack_columns(measurement_hits.size(),
+                               {{measurement_hits.data(),
+                                 sizeof(csv::measurement_hit_id)}}));
+}
+
+void event_archive_writer::close() {
+
+    std::lock_guard lock{m_mutex};
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    // Write the index table after the last section.
+    m_file.write(reinterpret_cast<const char*>(m_index.data()),
+                 static_cast<std::streamsize>(
+                     m_index.size() * sizeof(event_archive_index_entry)));
+
+    // Finalize the header.
+    archive_header header;
+    std::copy(std::begin(archive_magic), std::end(archive_magic),
+              header.magic);
+    header.n_entries = m_index.size();
+    header.index_offset = m_offset;
+    m_file.seekp(0);
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_file.close();
+    if (m_file.fail()) {
+        throw std::runtime_error("Could not write archive \"" + m_filename +
+                                 "\"");
+    }
+}
+
+void event_archive_writer::write_section(
+    std::size_t event, event_archive_section type,
+    const std::vector<std::byte>& payload) {
+
+    std::lock_guard lock{m_mutex};
+    if (!m_file.is_open()) {
+        throw std::runtime_error("Archive \"" + m_filename +
+                                 "\" is already closed");
+    }
+    m_file.write(reinterpret_cast<const char*>(payload.data()),
+                 static_cast<std::streamsize>(payload.size()));
+    if (!m_file) {
+        throw std::runtime_error("Could not write to archive \"" +
+                                 m_filename + "\"");
+    }
+    m_index.push_back({event, static_cast<std::uint32_t>(type), 0u, m_offset,
+                       payload.size()});
+    m_offset += payload.size();
+}
+
+event_archive_reader::event_archive_reader(std::string_view filename)
+    : m_filename(filename), m_file(filename) {
+
+    auto fail = [this](const std::string& what) {
+        throw std::runtime_error("Invalid archive \"" + m_filename +
+                                 "\": " + what);
+    };
+
+    // Read and check the header.
+    archive_header header;
+    if (m_file.size() < sizeof(header)) {
+        fail("file too small");
+    }
+    std::memcpy(&header, m_file.data(), sizeof(header));
+    if (!std::equal(std::begin(archive_magic), std::end(archive_magic),
+                    header.magic)) {
+        fail("unknown file type");
+    }
+    if (header.version != archive_version) {
+        fail("unsupported version " + std::to_string(header.version));
+    }
+    if (header.index_offset == 0u) {
+        fail("archive was not closed");
+    }
+    const std::size_t index_size = m_file.size() - header.index_offset;
+    if ((header.index_offset > m_file.size()) ||
+        (index_size / sizeof(event_archive_index_entry) < header.n_entries)) {
+        fail("truncated index");
+    }
+
+    // Read the index. Later sections replace earlier ones for the same event
+    // and type.
+    for (std::uint64_t i = 0; i < header.n_entries; ++i) {
+        event_archive_index_entry entry;
+        std::memcpy(&entry,
+                    m_file.data() + header.index_offset +
+                        i * sizeof(event_archive_index_entry),
+                    sizeof(entry));
+        if ((entry.offset > header.index_offset) ||
+            (entry.size > header.index_offset - entry.offset)) {
+            fail("section out of bounds");
+        }
+        m_sections[{static_cast<std::size_t>(entry.event),
+                    static_cast<event_archive_section>(entry.type)}] = {
+            static_cast<std::size_t>(entry.offset),
+            static_cast<std::size_t>(entry.size)};
+    }
+}
+
+std::shared_ptr<const event_archive_reader> event_archive_reader::open(
+    std::string_view filename) {
+
+    // The last opened archive, with the properties of its file at the time.
+    static std::mutex mutex;
+    static std::shared_ptr<const event_archive_reader> cached;
+    static std::filesystem::file_time_type cached_time;
+    static std::uintmax_t cached_size = 0u;
+
+    const std::filesystem::path path{filename};
+    std::error_code time_ec, size_ec;
+    const std::filesystem::file_time_type time =
+        std::filesystem::last_write_time(path, time_ec);
+    const std::uintmax_t size = std::filesystem::file_size(path, size_ec);
+
+    std::lock_guard lock{mutex};
+    if (!cached || (cached->filename() != filename) || time_ec || size_ec ||
+        (cached_time != time) || (cached_size != size)) {
+        cached = std::make_shared<const event_archive_reader>(filename);
+        cached_time = time;
+        cached_size = size;
+    }
+    return cached;
+}
+
+std::vector<std::size_t> event_archive_reader::events() const {
+
+    std::vector<std::size_t> result;
+    for (const auto& [key, position] : m_sections) {
+        if (result.empty() || (result.back() != key.first)) {
+            result.push_back(key.first);
+        }
+    }
+    return result;
+}
+
+bool event_archive_reader::contains(std::size_t event,
+                                    event_archive_section type) const {
+
+    return m_sections.contains({event, type});
+}
+
+void event_archive_reader::read(
+    std::size_t event, edm::silicon_cell_collection::host& cells) const {
+
+    unpack_soa(cells, section(event, event_archive_section::cells),
+               m_filename);
+}
+
+void event_archive_reader::read(
+    std::size_t event, edm::spacepoint_collection::host& spacepoints) const {
+
+    unpack_soa(spacepoints, section(event, event_archive_section::hits),
+               m_filename);
+}
+
+void event_archive_reader::read(
+    std::size_t event, measurement_collection_types::host& measurements) const {
+
+    unpack_collection(measurements,
+                      section(event, event_archive_section::measurements),
+                      m_filename);
+}
+
+void event_archive_reader::read(
+    std::size_t event, particle_collection_types::host& particles) const {
+
+    unpack_collection(particles,
+                      section(event, event_archive_section::particles),
+                      m_filename);
+}
+
+void event_archive_reader::read(
+    std::size_t event,
+    std::vector<csv::measurement_hit_id>& measurement_hits) const {
+
+    unpack_collection(measurement_hits,
+                      section(event, event_archive_section::measurement_hits),
+                      m_filename);
+}
+
+std::pair<const std::byte*, std::size_t> event_archive_reader::section(
+    std::size_t event, event_archive_section type) const {
+
+    const auto it = m_sections.find({event, type});
+    if (it == m_sections.end()) {
+        throw std::runtime_error(
+            "Event " + std::to_string(event) + " has no section of type " +
+            std::to_string(static_cast<std::uint32_t>(type)) +
+            " in archive \"" + m_filename + "\"");
+    }
+    return {m_file.data() + it->second.first, it->second.second};
+}
+
+}  // namespace traccc::io
@@ -0,0 +1,67 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/map_data.hpp"
+
+#include "read_mmap.hpp"
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <filesystem>
+#include <string>
+
+namespace traccc::io {
+
+namespace {
+
+/// Get the full name of an event's file
+std::string event_file(std::size_t event, std::string_view directory,
+                       std::string_view suffix) {
+
+    return get_absolute_path(
+        (std::filesystem::path(directory) /
+         std::filesystem::path(get_event_filename(event, suffix)))
+            .native());
+}
+
+}  // namespace
+
+mapped_cells map_cells(std::size_t event, std::string_view directory) {
+
+    return map_cells(event_file(event, directory, "-cells.mmap"));
+}
+
+mapped_cells map_cells(std::string_view filename) {
+
+    mapped_cells result{mapped_file{filename}, {}};
+    details::map_mmap_soa(result.view, result.file, filename);
+    return result;
+}
+
+mapped_spacepoints map_spacepoints(std::size_t event,
+                                   std::string_view directory) {
+
+    const std::string filename = event_file(event, directory, "-hits.mmap");
+    mapped_spacepoints result{mapped_file{filename}, {}};
+    details::map_mmap_soa(result.view, result.file, filename);
+    return result;
+}
+
+mapped_measurements map_measurements(std::size_t event,
+                                     std::string_view directory) {
+
+    const std::string filename =
+        event_file(event, directory, "-measurements.mmap");
+    mapped_measurements result{mapped_file{filename}, {}};
+    result.view =
+        details::map_mmap_collection<measurement_collection_types::const_view>(
+            result.file, filename);
+    return result;
+}
+
+}  // namespace traccc::io
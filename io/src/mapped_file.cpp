@@ -0,0 +1,93 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// System include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace traccc::io {
+
+mapped_file::mapped_file(std::string_view filename) {
+
+    // Open the file.
+    const std::string fname{filename};
+    const int fd = ::open(fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file \"" + fname +
+                                 "\": " + std::strerror(errno));
+    }
+
+    // Find out its size.
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        const int err = errno;
+        ::close(fd);
+        throw std::runtime_error("Could not stat file \"" + fname +
+                                 "\": " + std::strerror(err));
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+    if (m_size == 0u) {
+        ::close(fd);
+        throw std::runtime_error("File \"" + fname + "\" is empty");
+    }
+
+    // Map it into memory. The file descriptor is not needed anymore once the
+    // mapping exists.
+    void* ptr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    const int err = errno;
+    ::close(fd);
+    if (ptr == MAP_FAILED) {
+        m_size = 0u;
+        throw std::runtime_error("Could not map file \"" + fname +
+                                 "\": " + std::strerror(err));
+    }
+    m_data = static_cast<const std::byte*>(ptr);
+
+    // The data is typically read front-to-back.
+    ::madvise(ptr, m_size, MADV_SEQUENTIAL);
+}
+
+mapped_file::mapped_file(mapped_file&& parent) noexcept
+    : m_data(std::exchange(parent.m_data, nullptr)),
+      m_size(std::exchange(parent.m_size, 0u)) {}
+
+mapped_file::~mapped_file() {
+
+    unmap();
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept {
+
+    if (this != &rhs) {
+        unmap();
+        m_data = std::exchange(rhs.m_data, nullptr);
+        m_size = std::exchange(rhs.m_size, 0u);
+    }
+    return *this;
+}
+
+void mapped_file::unmap() {
+
+    if (m_data != nullptr) {
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+        m_data = nullptr;
+        m_size = 0u;
+    }
+}
+
+}  // namespace traccc::io
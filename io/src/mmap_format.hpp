@@ -0,0 +1,84 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace traccc::io::details {
+
+/// @name Layout of the memory-mappable (@c traccc::data_format::mmap) files
+///
+/// Every file starts with a @c mmap_file_header, followed by one
+/// @c mmap_array_header for every array stored in the file. The arrays
+/// themselves come after the headers, each of them starting at an offset
+/// that is a multiple of @c mmap_alignment. Since mappings always start on
+/// a page boundary, the arrays can be used in-place from the mapped memory.
+///
+/// Files holding a specific kind of data (like detector description
+/// snapshots) also identify that data, and the version of its schema, in
+/// their header. Plain event data files leave these fields zeroed.
+///
+/// @{
+
+/// Identifier at the start of every memory-mappable file
+static constexpr std::array<char, 8> mmap_magic = {'T', 'R', 'C', 'C',
+                                                   'M', 'M', 'A', 'P'};
+/// Version of the file layout
+static constexpr std::uint32_t mmap_version = 2u;
+/// Alignment of the arrays in the files
+static constexpr std::size_t mmap_alignment = 64u;
+
+/// Identification of the data stored in a file
+struct mmap_content {
+    /// Identifier of the stored data
+    std::array<char, 8> magic = {};
+    /// Version of the schema of the stored data
+    std::uint32_t version = 0u;
+};
+
+/// Header at the start of the files
+struct mmap_file_header {
+    /// Identifier of the file type
+    std::array<char, 8> magic = mmap_magic;
+    /// Version of the file layout
+    std::uint32_t version = mmap_version;
+    /// Number of arrays in the file
+    std::uint32_t n_arrays = 0u;
+    /// Number of elements in each of the arrays
+    std::uint64_t n_elements = 0u;
+    /// Identifier of the stored data
+    std::array<char, 8> content_magic = {};
+    /// Version of the schema of the stored data
+    std::uint32_t content_version = 0u;
+    /// Unused, keeps the header free of implicit padding
+    std::uint32_t reserved = 0u;
+};
+static_assert(std::is_standard_layout_v<mmap_file_header>);
+static_assert(sizeof(mmap_file_header) == 40u);
+
+/// Description of one array in the files
+struct mmap_array_header {
+    /// Offset of the array from the start of the file, in bytes
+    std::uint64_t offset = 0u;
+    /// Size of one element of the array, in bytes
+    std::uint64_t element_size = 0u;
+};
+static_assert(std::is_standard_layout_v<mmap_array_header>);
+
+/// @}
+
+/// Round an offset up to the next multiple of @c mmap_alignment
+constexpr std::size_t mmap_align(std::size_t offset) {
+    return ((offset + mmap_alignment - 1u) / mmap_alignment) * mmap_alignment;
+}
+
+}  // namespace traccc::io::details
@@ -0,0 +1,38 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+#include "traccc/io/details/sort_measurements.hpp"
+#include "traccc/io/event_archive.hpp"
+#include "traccc/io/utils.hpp"
+
+// System include(s).
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+namespace traccc::io::details {
+
+/// Get the reader of the event archive in a given directory
+///
+/// @param directory The event data directory holding the archive
+/// @return The (shared) reader of the archive
+///
+inline std::shared_ptr<const event_archive_reader> open_archive(
+    std::string_view directory) {
+
+    return event_archive_reader::open(get_absolute_path(
+        (std::filesystem::path(directory) /
+         std::filesystem::path(event_archive_filename))
+            .native()));
+}
+
+}  // namespace traccc::io::details
@@ -8,8 +8,11 @@
 // Local include(s).
 #include "traccc/io/read_cells.hpp"
 
+#include "compressed_binary.hpp"
 #include "csv/read_cells.hpp"
+#include "read_archive.hpp"
 #include "read_binary.hpp"
+#include "read_mmap.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
@@ -46,6 +49,30 @@ void read_cells(edm::silicon_cell_collection::host& cells, std::size_t event,
                 ilogger->clone(), dd, format, deduplicate);
             break;
 
+        case data_format::compressed_binary:
+            read_cells(cells,
+                       get_absolute_path(
+                           (std::filesystem::path(directory) /
+                            std::filesystem::path(
+                                get_event_filename(event, "-cells.cdat")))
+                               .native()),
+                       ilogger->clone(), dd, format, deduplicate);
+            break;
+
+        case data_format::mmap:
+            read_cells(cells,
+                       get_absolute_path(
+                           (std::filesystem::path(directory) /
+                            std::filesystem::path(
+                                get_event_filename(event, "-cells.mmap")))
+                               .native()),
+                       ilogger->clone(), dd, format, deduplicate);
+            break;
+
+        case data_format::archive:
+            details::open_archive(directory)->read(event, cells);
+            break;
+
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -68,6 +95,14 @@ void read_cells(edm::silicon_cell_collection::host& cells,
             details::read_binary_soa(cells, filename);
             break;
 
+        case data_format::mmap:
+            details::read_mmap_soa(cells, filename);
+            break;
+
+        case data_format::compressed_binary:
+            details::read_compressed_soa(cells, filename);
+            break;
+
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -9,6 +9,7 @@
 #include "traccc/io/read_detector_description.hpp"
 
 #include "csv/read_surfaces.hpp"
+#include "detector_snapshot.hpp"
 #include "traccc/io/read_detector.hpp"
 #include "traccc/io/read_digitization_config.hpp"
 #include "traccc/io/utils.hpp"
@@ -20,6 +21,7 @@
 #include <vecmem/memory/host_memory_resource.hpp>
 
 // System include(s).
+#include <future>
 #include <sstream>
 #include <stdexcept>
 
@@ -44,13 +46,16 @@ void fill_digi_info(traccc::silicon_detector_description::host& dd,
 
 void read_csv_dd(traccc::silicon_detector_description::host& dd,
                  std::string_view geometry_file,
-                 const traccc::digitization_config& digi) {
+                 std::future<traccc::digitization_config>& digi_future) {
 
     // Read the geometry description as a map of surface tranformations.
     const std::map<traccc::geometry_id, traccc::transform3> surfaces =
         traccc::io::csv::read_surfaces(
             traccc::io::get_absolute_path(geometry_file.data()));
 
+    // Wait for the digitization configuration.
+    const traccc::digitization_config digi = digi_future.get();
+
     // Fill the detector description with information about the (sensitive)
     // surfaces, and the digitization configurations belonging to those
     // surfaces.
@@ -93,7 +98,7 @@ void read_csv_dd(traccc::silicon_detector_description::host& dd,
 
 void read_json_dd(traccc::silicon_detector_description::host& dd,
                   std::string_view geometry_file,
-                  const traccc::digitization_config& digi) {
+                  std::future<traccc::digitization_config>& digi_future) {
 
     // Construct a (temporary) Detray detector object from the geometry
     // configuration file.
@@ -101,6 +106,9 @@ void read_json_dd(traccc::silicon_detector_description::host& dd,
     traccc::default_detector::host detector{mr};
     traccc::io::read_detector(detector, mr, geometry_file);
 
+    // Wait for the digitization configuration.
+    const traccc::digitization_config digi = digi_future.get();
+
     // Iterate over the surfaces of the detector.
     const traccc::default_detector::host::surface_lookup_container& surfaces =
         detector.surfaces();
@@ -145,6 +153,13 @@ void read_json_dd(traccc::silicon_detector_description::host& dd,
     }
 }
 
+/// Version of the layout of @c traccc::silicon_detector_description
+///
+/// It needs to be increased with every change to the variables of the
+/// container, so that snapshots of the earlier layout would not be used.
+///
+constexpr std::uint32_t dd_snapshot_version = 1u;
+
 }  // namespace
 
 namespace traccc::io {
@@ -155,9 +170,29 @@ void read_detector_description(silicon_detector_description::host& dd,
                                const data_format geometry_format,
                                const data_format digitization_format) {
 
-    // Read the digitization configuration.
-    const digitization_config digi =
-        read_digitization_config(digitization_file, digitization_format);
+    // Look for a snapshot of the detector description, made from the same
+    // input files earlier, if snapshots are enabled.
+    std::string snapshot;
+    if (!detector_cache_directory().empty()) {
+        std::ostringstream parameters;
+        parameters << "silicon_detector_description:" << geometry_format
+                   << ':' << digitization_format;
+        snapshot = details::snapshot_filename(
+            "dd",
+            details::content_hash({get_absolute_path(geometry_file),
+                                   get_absolute_path(digitization_file)},
+                                  parameters.str()));
+        if (details::read_snapshot(dd, snapshot, dd_snapshot_version)) {
+            return;
+        }
+    }
+
+    // Read the digitization configuration, while the geometry is being read.
+    std::future<digitization_config> digi =
+        std::async(std::launch::async, [&]() {
+            return read_digitization_config(digitization_file,
+                                            digitization_format);
+        });
 
     // Fill the detector description with the correct type of geometry file.
     switch (geometry_format) {
@@ -170,6 +205,13 @@ void read_detector_description(silicon_detector_description::host& dd,
         default:
             throw std::invalid_argument("Unsupported geometry format.");
     }
+
+    // Save the detector description for the next time.
+    const silicon_detector_description::const_view dd_view =
+        vecmem::get_data(dd);
+    details::write_snapshot(
+        snapshot, silicon_detector_description::const_device{dd_view},
+        dd_snapshot_version);
 }
 
 }  // namespace traccc::io
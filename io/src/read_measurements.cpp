@@ -8,8 +8,11 @@
 // Local include(s).
 #include "traccc/io/read_measurements.hpp"
 
+#include "compressed_binary.hpp"
 #include "csv/read_measurements.hpp"
+#include "read_archive.hpp"
 #include "read_binary.hpp"
+#include "read_mmap.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
@@ -42,6 +45,34 @@ std::vector<measurement_id_type> read_measurements(
                                       .native()));
             return {};
         }
+        case data_format::compressed_binary: {
+
+            details::read_compressed_collection(
+                measurements,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.cdat")))
+                                      .native()));
+            return {};
+        }
+        case data_format::mmap: {
+
+            details::read_mmap_collection(
+                measurements,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.mmap")))
+                                      .native()));
+            return {};
+        }
+        case data_format::archive: {
+
+            details::open_archive(directory)->read(event, measurements);
+            if (sort_measurements) {
+                return details::sort_measurements(measurements);
+            }
+            return {};
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
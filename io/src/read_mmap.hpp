@@ -0,0 +1,225 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "mmap_format.hpp"
+#include "traccc/io/mapped_file.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/edm/host.hpp>
+#include <vecmem/edm/view.hpp>
+
+// System include(s).
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace traccc::io::details {
+
+/// Check the layout of a memory mapped file
+///
+/// @param file The mapped file
+/// @param filename The name of the mapped file (for error messages)
+/// @param n_arrays The number of arrays expected in the file
+/// @param content The identification of the data expected in the file
+/// @return The description of the arrays in the file
+///
+inline const mmap_array_header* check_mmap_file(
+    const mapped_file& file, std::string_view filename, std::size_t n_arrays,
+    const mmap_content& content = {}) {
+
+    auto fail = [filename](const std::string& what) {
+        throw std::runtime_error("Invalid mmap file \"" +
+                                 std::string{filename} + "\": " + what);
+    };
+
+    // Check the file's header.
+    const std::size_t headers_size =
+        sizeof(mmap_file_header) + n_arrays * sizeof(mmap_array_header);
+    if (file.size() < headers_size) {
+        fail("file too small");
+    }
+    mmap_file_header header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (header.magic != mmap_magic) {
+        fail("unknown file type");
+    }
+    if (header.version != mmap_version) {
+        fail("unsupported version " + std::to_string(header.version));
+    }
+    if (header.content_magic != content.magic) {
+        fail("unexpected content");
+    }
+    if (header.content_version != content.version) {
+        fail("unsupported content version " +
+             std::to_string(header.content_version));
+    }
+    if (header.n_arrays != n_arrays) {
+        fail("expected " + std::to_string(n_arrays) + " arrays, found " +
+             std::to_string(header.n_arrays));
+    }
+    if (header.n_elements > std::numeric_limits<unsigned int>::max()) {
+        fail("too many elements");
+    }
+
+    // Check that all arrays are properly aligned, and inside the file.
+    const mmap_array_header* arrays =
+        reinterpret_cast<const mmap_array_header*>(file.data() +
+                                                   sizeof(mmap_file_header));
+    for (std::size_t i = 0; i < n_arrays; ++i) {
+        if ((arrays[i].offset % mmap_alignment) != 0u) {
+            fail("misaligned array " + std::to_string(i));
+        }
+        if (arrays[i].offset + header.n_elements * arrays[i].element_size >
+            file.size()) {
+            fail("truncated array " + std::to_string(i));
+        }
+    }
+    return arrays;
+}
+
+/// Get the number of elements stored in a (valid) memory mapped file
+inline unsigned int mmap_file_elements(const mapped_file& file) {
+
+    mmap_file_header header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    return static_cast<unsigned int>(header.n_elements);
+}
+
+/// Point a vector view at one of the arrays of a memory mapped file
+template <typename TYPE>
+vecmem::data::vector_view<TYPE> map_mmap_array(
+    const mapped_file& file, std::string_view filename,
+    const mmap_array_header& array) {
+
+    using value_type = std::remove_cv_t<TYPE>;
+    static_assert(std::is_const_v<TYPE>, "Mapped memory is read-only.");
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Vector type does not have a standard layout.");
+    if (array.element_size != sizeof(value_type)) {
+        throw std::runtime_error("Invalid mmap file \"" +
+                                 std::string{filename} +
+                                 "\": element size mismatch");
+    }
+    return {mmap_file_elements(file),
+            reinterpret_cast<TYPE*>(file.data() + array.offset)};
+}
+
+/// Implementation detail for @c traccc::io::details::map_mmap_soa
+template <std::size_t INDEX, typename... VARTYPES>
+void map_mmap_soa_impl(
+    vecmem::edm::view<vecmem::edm::schema<VARTYPES...>>& view,
+    const mapped_file& file, std::string_view filename,
+    const mmap_array_header* arrays) {
+
+    // Set up the current variable.
+    auto& var = view.template get<INDEX>();
+    using value_type = typename std::decay_t<decltype(var)>::value_type;
+    var = map_mmap_array<value_type>(file, filename, arrays[INDEX]);
+
+    // Recurse into the next variable.
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        map_mmap_soa_impl<INDEX + 1>(view, file, filename, arrays);
+    }
+}
+
+/// Function creating an SoA view on top of a memory mapped file
+///
+/// Only containers made up of 1D vector variables are supported.
+///
+/// @param result The view to set up
+/// @param file The mapped file
+/// @param filename The name of the mapped file (for error messages)
+///
+template <typename... VARTYPES>
+void map_mmap_soa(vecmem::edm::view<vecmem::edm::schema<VARTYPES...>>& result,
+                  const mapped_file& file, std::string_view filename) {
+
+    const mmap_array_header* arrays =
+        check_mmap_file(file, filename, sizeof...(VARTYPES));
+    result = vecmem::edm::view<vecmem::edm::schema<VARTYPES...>>{
+        mmap_file_elements(file)};
+    map_mmap_soa_impl<0>(result, file, filename, arrays);
+}
+
+/// Function creating a collection view on top of a memory mapped file
+///
+/// @param file The mapped file
+/// @param filename The name of the mapped file (for error messages)
+/// @return A constant view of the file's contents
+///
+template <typename view_t>
+view_t map_mmap_collection(const mapped_file& file,
+                           std::string_view filename) {
+
+    const mmap_array_header* arrays = check_mmap_file(file, filename, 1u);
+    return map_mmap_array<typename view_t::value_type>(file, filename,
+                                                       arrays[0]);
+}
+
+/// Implementation detail for @c traccc::io::details::read_mmap_soa
+template <std::size_t INDEX, typename... VARTYPES,
+          template <typename> class INTERFACE>
+void read_mmap_soa_impl(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    const mapped_file& file, std::string_view filename,
+    const mmap_array_header* arrays) {
+
+    // Copy the current variable.
+    auto& var = result.template get<INDEX>();
+    using value_type = typename std::decay_t<decltype(var)>::value_type;
+    const vecmem::data::vector_view<const value_type> array =
+        map_mmap_array<const value_type>(file, filename, arrays[INDEX]);
+    var.assign(array.ptr(), array.ptr() + array.size());
+
+    // Recurse into the next variable.
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        read_mmap_soa_impl<INDEX + 1>(result, file, filename, arrays);
+    }
+}
+
+/// Function reading an SoA container from a memory-mappable file
+///
+/// @param result The container to fill
+/// @param filename The full input filename
+/// @param content The identification of the data expected in the file
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void read_mmap_soa(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    std::string_view filename, const mmap_content& content = {}) {
+
+    const mapped_file file{filename};
+    const mmap_array_header* arrays =
+        check_mmap_file(file, filename, sizeof...(VARTYPES), content);
+    read_mmap_soa_impl<0>(result, file, filename, arrays);
+}
+
+/// Function reading a collection from a memory-mappable file
+///
+/// @param result The collection to fill
+/// @param filename The full input filename
+///
+template <typename collection_t>
+void read_mmap_collection(collection_t& result, std::string_view filename) {
+
+    using view_type =
+        vecmem::data::vector_view<const typename collection_t::value_type>;
+
+    const mapped_file file{filename};
+    const auto view = map_mmap_collection<view_type>(file, filename);
+    result.assign(view.ptr(), view.ptr() + view.size());
+}
+
+}  // namespace traccc::io::details
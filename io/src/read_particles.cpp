@@ -9,6 +9,7 @@
 #include "traccc/io/read_particles.hpp"
 
 #include "csv/read_particles.hpp"
+#include "read_archive.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
@@ -31,6 +32,9 @@ void read_particles(particle_collection_types::host& particles,
                         .native()),
                 format);
             break;
+        case data_format::archive:
+            details::open_archive(directory)->read(event, particles);
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -8,8 +8,11 @@
 // Local include(s).
 #include "traccc/io/read_spacepoints.hpp"
 
+#include "compressed_binary.hpp"
 #include "csv/read_spacepoints.hpp"
+#include "read_archive.hpp"
 #include "read_binary.hpp"
+#include "read_mmap.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
@@ -57,6 +60,45 @@ void read_spacepoints(edm::spacepoint_collection::host& spacepoints,
                                       .native()));
             break;
         }
+        case data_format::compressed_binary: {
+            details::read_compressed_soa(
+                spacepoints,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-hits.cdat")))
+                                      .native()));
+            details::read_compressed_collection(
+                measurements,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.cdat")))
+                                      .native()));
+            break;
+        }
+        case data_format::mmap: {
+            details::read_mmap_soa(
+                spacepoints,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-hits.mmap")))
+                                      .native()));
+            details::read_mmap_collection(
+                measurements,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.mmap")))
+                                      .native()));
+            break;
+        }
+        case data_format::archive: {
+            const auto archive = details::open_archive(directory);
+            archive->read(event, spacepoints);
+            archive->read(event, measurements);
+            // Sort the measurements the same way as for CSV input.
+            details::remap_measurement_indices(
+                spacepoints, details::sort_measurements(measurements));
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
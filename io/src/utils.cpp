@@ -35,6 +35,14 @@ const std::string& data_directory() {
     return data_dir;
 }
 
+std::string detector_cache_directory() {
+
+    // The caching is only enabled through an environment variable. It is
+    // looked up on every call, so that it could be changed at runtime.
+    const char* env_dir = std::getenv("TRACCC_DETECTOR_CACHE_DIR");
+    return (env_dir == nullptr ? std::string{} : std::string{env_dir});
+}
+
 std::string get_event_filename(std::size_t event, std::string_view suffix) {
 
     std::ostringstream stream;
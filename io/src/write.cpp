@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/io/write.hpp"
 
+#include "compressed_binary.hpp"
 #include "csv/write_cells.hpp"
 #include "json/write_digitization_config.hpp"
 #include "obj/write_seeds.hpp"
@@ -15,6 +16,7 @@
 #include "obj/write_track_candidates.hpp"
 #include "traccc/io/utils.hpp"
 #include "write_binary.hpp"
+#include "write_mmap.hpp"
 #include "csv/write_spacepoints.hpp"
 
 // System include(s).
@@ -38,6 +40,22 @@ void write(std::size_t event, std::string_view directory,
                                       .native()),
                 traccc::edm::silicon_cell_collection::const_device{cells});
             break;
+        case data_format::compressed_binary:
+            details::write_compressed_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-cells.cdat")))
+                                      .native()),
+                traccc::edm::silicon_cell_collection::const_device{cells});
+            break;
+        case data_format::mmap:
+            details::write_mmap_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-cells.mmap")))
+                                      .native()),
+                traccc::edm::silicon_cell_collection::const_device{cells});
+            break;
         case data_format::csv:
             csv::write_cells(
                 get_absolute_path((std::filesystem::path(directory) /
@@ -72,6 +90,36 @@ void write(std::size_t event, std::string_view directory,
                 traccc::measurement_collection_types::const_device{
                     measurements});
             break;
+        case data_format::compressed_binary:
+            details::write_compressed_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-hits.cdat")))
+                                      .native()),
+                edm::spacepoint_collection::const_device{spacepoints});
+            details::write_compressed_collection(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.cdat")))
+                                      .native()),
+                traccc::measurement_collection_types::const_device{
+                    measurements});
+            break;
+        case data_format::mmap:
+            details::write_mmap_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-hits.mmap")))
+                                      .native()),
+                edm::spacepoint_collection::const_device{spacepoints});
+            details::write_mmap_collection(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.mmap")))
+                                      .native()),
+                traccc::measurement_collection_types::const_device{
+                    measurements});
+            break;
         case data_format::obj:
             obj::write_spacepoints(
                 get_absolute_path((std::filesystem::path(directory) /
@@ -108,6 +156,24 @@ void write(std::size_t event, std::string_view directory,
                 traccc::measurement_collection_types::const_device{
                     measurements});
             break;
+        case data_format::compressed_binary:
+            details::write_compressed_collection(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.cdat")))
+                                      .native()),
+                traccc::measurement_collection_types::const_device{
+                    measurements});
+            break;
+        case data_format::mmap:
+            details::write_mmap_collection(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.mmap")))
+                                      .native()),
+                traccc::measurement_collection_types::const_device{
+                    measurements});
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
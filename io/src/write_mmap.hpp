@@ -0,0 +1,158 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "mmap_format.hpp"
+
+// VecMem include(s).
+#include <vecmem/edm/device.hpp>
+
+// System include(s).
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace traccc::io::details {
+
+/// Description of one array to write into a memory-mappable file
+struct mmap_array {
+    /// Pointer to the array's payload
+    const void* data = nullptr;
+    /// Size of one element of the array, in bytes
+    std::size_t element_size = 0u;
+};
+
+/// Function writing a set of equally sized arrays into a memory-mappable file
+///
+/// @param filename The full output filename
+/// @param n_elements The number of elements in each of the arrays
+/// @param arrays The arrays to write
+/// @param content The identification of the data being written
+///
+inline void write_mmap_arrays(std::string_view filename,
+                              std::size_t n_elements,
+                              const std::vector<mmap_array>& arrays,
+                              const mmap_content& content = {}) {
+
+    // Open the output file.
+    const std::string filename_str{filename};
+    std::ofstream out_file(filename_str, std::ios::binary);
+    if (!out_file) {
+        throw std::runtime_error("Could not open file \"" + filename_str +
+                                 "\" for writing");
+    }
+
+    // Lay out the arrays.
+    mmap_file_header header;
+    header.n_arrays = static_cast<std::uint32_t>(arrays.size());
+    header.n_elements = n_elements;
+    header.content_magic = content.magic;
+    header.content_version = content.version;
+    std::vector<mmap_array_header> array_headers(arrays.size());
+    std::size_t offset = mmap_align(
+        sizeof(mmap_file_header) + arrays.size() * sizeof(mmap_array_header));
+    for (std::size_t i = 0; i < arrays.size(); ++i) {
+        array_headers[i].offset = offset;
+        array_headers[i].element_size = arrays[i].element_size;
+        offset = mmap_align(offset + n_elements * arrays[i].element_size);
+    }
+
+    // Write the headers.
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_file.write(
+        reinterpret_cast<const char*>(array_headers.data()),
+        static_cast<std::streamsize>(array_headers.size() *
+                                     sizeof(mmap_array_header)));
+
+    // Write the arrays, with the padding in front of each of them.
+    static const std::vector<char> padding(mmap_alignment, '\0');
+    std::size_t position =
+        sizeof(mmap_file_header) + arrays.size() * sizeof(mmap_array_header);
+    for (std::size_t i = 0; i < arrays.size(); ++i) {
+        out_file.write(
+            padding.data(),
+            static_cast<std::streamsize>(array_headers[i].offset - position));
+        const std::size_t size = n_elements * arrays[i].element_size;
+        out_file.write(static_cast<const char*>(arrays[i].data),
+                       static_cast<std::streamsize>(size));
+        position = array_headers[i].offset + size;
+    }
+
+    // Make sure that everything got written.
+    out_file.flush();
+    if (!out_file) {
+        throw std::runtime_error("Could not write file \"" + filename_str +
+                                 "\"");
+    }
+}
+
+/// Implementation detail for @c traccc::io::details::write_mmap_soa
+template <std::size_t INDEX, typename... VARTYPES,
+          template <typename> class INTERFACE>
+void write_mmap_soa_impl(
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container,
+    std::vector<mmap_array>& arrays) {
+
+    // Describe the current variable.
+    const auto& var = container.template get<INDEX>();
+    using value_type =
+        std::remove_cv_t<typename std::decay_t<decltype(var)>::value_type>;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Vector type does not have a standard layout.");
+    arrays.push_back({var.data(), sizeof(value_type)});
+
+    // Recurse into the next variable.
+    if constexpr (sizeof...(VARTYPES) > (INDEX + 1)) {
+        write_mmap_soa_impl<INDEX + 1>(container, arrays);
+    }
+}
+
+/// Function writing an SoA container into a memory-mappable file
+///
+/// Only containers made up of 1D vector variables are supported.
+///
+/// @param filename The full output filename
+/// @param container The container to write
+/// @param content The identification of the data being written
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void write_mmap_soa(
+    std::string_view filename,
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container,
+    const mmap_content& content = {}) {
+
+    std::vector<mmap_array> arrays;
+    arrays.reserve(sizeof...(VARTYPES));
+    write_mmap_soa_impl<0>(container, arrays);
+    write_mmap_arrays(filename, container.size(), arrays, content);
+}
+
+/// Function writing a collection into a memory-mappable file
+///
+/// @param filename The full output filename
+/// @param collection The collection to write
+///
+template <typename collection_t>
+void write_mmap_collection(std::string_view filename,
+                           const collection_t& collection) {
+
+    using value_type = std::remove_cv_t<typename collection_t::value_type>;
+    static_assert(std::is_standard_layout_v<value_type>,
+                  "Collection item type must have standard layout.");
+    write_mmap_arrays(filename, collection.size(),
+                      {{collection.data(), sizeof(value_type)}});
+}
+
+}  // namespace traccc::io::details
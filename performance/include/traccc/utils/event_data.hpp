@@ -50,13 +50,16 @@ struct event_data {
     /// @param[in] format    file format
     /// @param[in] include_silicon_cells Use silicon cell data in object
     /// construction
+    /// @param[in] use_truth_cache Cache the decoded CSV files in a binary
+    /// sidecar file next to them, and use that cache when it is up to date
     ///
     event_data(const std::string& event_dir, const std::size_t event_id,
                vecmem::memory_resource& resource,
                bool use_acts_geom_source = false,
                const detector_type* det = nullptr,
                data_format format = data_format::csv,
-               bool include_silicon_cells = false);
+               bool include_silicon_cells = false,
+               bool use_truth_cache = false);
 
     /// Fill the member variables related to CCA
     ///
@@ -107,7 +110,7 @@ struct event_data {
 
     private:
     void setup_csv(bool use_acts_geom_source, const detector_type* det,
-                   bool include_silicon_cells);
+                   bool include_silicon_cells, bool use_truth_cache);
 };
 
 }  // namespace traccc
@@ -23,112 +23,271 @@
 
 // System include(s).
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+/// The decoded contents of the truth CSV files of one event
+struct truth_csv_data {
+    std::vector<traccc::io::csv::cell> cells;
+    std::vector<traccc::io::csv::hit> hits;
+    std::vector<traccc::io::csv::measurement> measurements;
+    std::vector<traccc::io::csv::measurement_hit_id> meas_hit_ids;
+    std::vector<traccc::io::csv::particle> particles;
+};
+
+/// Read all rows of a CSV file
+template <typename row_t, typename reader_t>
+std::vector<row_t> read_csv_rows(reader_t reader) {
+
+    std::vector<row_t> result;
+    row_t row;
+    while (reader.read(row)) {
+        result.push_back(row);
+    }
+    return result;
+}
+
+/// Identifier at the start of the truth cache files
+constexpr char truth_cache_magic[8] = {'T', 'R', 'C', 'C',
+                                       'T', 'R', 'T', 'H'};
+/// Version of the truth cache file layout
+constexpr std::uint32_t truth_cache_version = 1u;
+
+/// Header of the truth cache files
+///
+/// The header is followed by the hits, measurements, measurement-hit
+/// associations, particles and cells, as arrays of the CSV row types.
+///
+struct truth_cache_header {
+    /// Identifier of the file type
+    char magic[8] = {};
+    /// Version of the file layout
+    std::uint32_t version = truth_cache_version;
+    /// Whether the file holds cells
+    std::uint32_t has_cells = 0u;
+    /// Sizes and modification times of the CSV files the cache was made from
+    std::array<std::uint64_t, 10u> inputs = {};
+    /// Number of rows in each of the arrays
+    std::array<std::uint64_t, 5u> n_rows = {};
+    /// Sizes of the row types of the arrays
+    std::array<std::uint64_t, 5u> row_sizes = {};
+};
+
+/// Describe the CSV files that a truth cache is made from
+std::array<std::uint64_t, 10u> describe_inputs(
+    const std::array<std::string, 5u>& filenames) {
+
+    std::array<std::uint64_t, 10u> result = {};
+    for (std::size_t i = 0; i < filenames.size(); ++i) {
+        if (filenames[i].empty()) {
+            continue;
+        }
+        std::error_code ec;
+        result[2 * i] =
+            static_cast<std::uint64_t>(std::filesystem::file_size(
+                std::filesystem::path{filenames[i]}, ec));
+        result[2 * i + 1] = static_cast<std::uint64_t>(
+            std::filesystem::last_write_time(
+                std::filesystem::path{filenames[i]}, ec)
+                .time_since_epoch()
+                .count());
+    }
+    return result;
+}
+
+/// Apply an operation on all arrays of a truth cache, in file order
+template <typename data_t, typename function_t>
+void for_each_array(data_t& data, function_t&& func) {
+
+    func(data.hits);
+    func(data.measurements);
+    func(data.meas_hit_ids);
+    func(data.particles);
+    func(data.cells);
+}
+
+/// Write the decoded truth information into a cache file
+///
+/// Failures are ignored, since the cache is only an optimization.
+///
+void write_truth_cache(const truth_csv_data& data, const std::string& filename,
+                       const std::array<std::string, 5u>& inputs) {
+
+    truth_cache_header header;
+    std::copy(std::begin(truth_cache_magic), std::end(truth_cache_magic),
+              header.magic);
+    header.has_cells = inputs.back().empty() ? 0u : 1u;
+    header.inputs = describe_inputs(inputs);
+    std::size_t i = 0;
+    for_each_array(data, [&](const auto& rows) {
+        header.n_rows[i] = rows.size();
+        header.row_sizes[i++] =
+            sizeof(typename std::decay_t<decltype(rows)>::value_type);
+    });
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file) {
+        return;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for_each_array(data, [&](const auto& rows) {
+        using row_t = typename std::decay_t<decltype(rows)>::value_type;
+        file.write(reinterpret_cast<const char*>(rows.data()),
+                   static_cast<std::streamsize>(rows.size() * sizeof(row_t)));
+    });
+    file.close();
+    if (file.fail()) {
+        std::error_code ec;
+        std::filesystem::remove(filename, ec);
+    }
+}
+
+/// Read the decoded truth information from a cache file
+///
+/// @return @c true if the cache exists, and matches the CSV files
+///
+bool read_truth_cache(truth_csv_data& data, const std::string& filename,
+                      const std::array<std::string, 5u>& inputs,
+                      bool need_cells) {
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    truth_cache_header header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        !std::equal(std::begin(truth_cache_magic),
+                    std::end(truth_cache_magic), header.magic) ||
+        (header.version != truth_cache_version) ||
+        (need_cells && (header.has_cells == 0u)) ||
+        (header.inputs != describe_inputs(inputs))) {
+        return false;
+    }
+    std::size_t i = 0;
+    bool good = true;
+    for_each_array(data, [&](auto& rows) {
+        using row_t = typename std::decay_t<decltype(rows)>::value_type;
+        if (!good || (header.row_sizes[i] != sizeof(row_t))) {
+            good = false;
+            return;
+        }
+        rows.resize(static_cast<std::size_t>(header.n_rows[i++]));
+        good = static_cast<bool>(file.read(
+            reinterpret_cast<char*>(rows.data()),
+            static_cast<std::streamsize>(rows.size() * sizeof(row_t))));
+    });
+    if (!need_cells) {
+        data.cells.clear();
+    }
+    return good;
+}
+
+}  // namespace
 
 namespace traccc {
 
 event_data::event_data(const std::string& event_dir, const std::size_t event_id,
                        vecmem::memory_resource& resource,
                        bool use_acts_geom_source, const detector_type* det,
-                       data_format format, bool include_silicon_cells)
+                       data_format format, bool include_silicon_cells,
+                       bool use_truth_cache)
     : m_event_dir(event_dir), m_event_id(event_id), m_mr(resource) {
 
     // Currently, we only support csv type for event data
     assert(format == data_format::csv);
     if (format == data_format::csv) {
-        setup_csv(use_acts_geom_source, det, include_silicon_cells);
+        setup_csv(use_acts_geom_source, det, include_silicon_cells,
+                  use_truth_cache);
     }
 }
 
 void event_data::setup_csv(bool use_acts_geom_source, const detector_type* det,
-                           bool include_silicon_cells) {
+                           bool include_silicon_cells, bool use_truth_cache) {
 
     /********************
      *  Read Csv files  *
      ********************/
 
-    // CSV IO EDM containers
-    std::vector<io::csv::cell> csv_cells;
-    std::vector<io::csv::hit> csv_hits;
-    std::vector<io::csv::measurement> csv_measurements;
-    std::vector<io::csv::measurement_hit_id> csv_meas_hit_ids;
-    std::vector<io::csv::particle> csv_particles;
+    // Names of the input files
+    auto event_file = [this](std::string_view suffix) {
+        return io::get_absolute_path(
+            (std::filesystem::path(m_event_dir) /
+             std::filesystem::path(io::get_event_filename(m_event_id, suffix)))
+                .native());
+    };
+    const std::string io_cells_file = event_file("-cells.csv");
+    const std::string io_hits_file = event_file("-hits.csv");
+    const std::string io_measurements_file = event_file("-measurements.csv");
+    const std::string io_measurement_hit_id_file =
+        event_file("-measurement-simhit-map.csv");
+    const std::string io_particles_file =
+        event_file("-particles_initial.csv");
+    const std::string truth_cache_file = event_file("-truth.cache");
 
-    if (include_silicon_cells) {
-        // Read the cells from the relevant event file
-        std::string io_cells_file =
-            io::get_absolute_path((std::filesystem::path(m_event_dir) /
-                                   std::filesystem::path(io::get_event_filename(
-                                       m_event_id, "-cells.csv")))
-                                      .native());
-
-        auto creader = io::csv::make_cell_reader(io_cells_file);
-        io::csv::cell iocell;
-
-        while (creader.read(iocell)) {
-            csv_cells.push_back(iocell);
-        }
-    }
-
-    // Read the hits from the relevant event file
-    std::string io_hits_file = io::get_absolute_path(
-        (std::filesystem::path(m_event_dir) /
-         std::filesystem::path(io::get_event_filename(m_event_id, "-hits.csv")))
-            .native());
-
-    auto hreader = io::csv::make_hit_reader(io_hits_file);
-    {
-        io::csv::hit iohit;
-        while (hreader.read(iohit)) {
-            csv_hits.push_back(iohit);
-        }
-    }
-
-    // Read the measurements from the relevant event file
-    std::string io_measurements_file =
-        io::get_absolute_path((std::filesystem::path(m_event_dir) /
-                               std::filesystem::path(io::get_event_filename(
-                                   m_event_id, "-measurements.csv")))
-                                  .native());
-
-    auto mreader = io::csv::make_measurement_reader(io_measurements_file);
-    {
-        io::csv::measurement iomeas;
-        while (mreader.read(iomeas)) {
-            csv_measurements.push_back(iomeas);
-        }
-    }
-
-    // Read the measurement hit id from the relevant event file
-    std::string io_measurement_hit_id_file =
-        io::get_absolute_path((std::filesystem::path(m_event_dir) /
-                               std::filesystem::path(io::get_event_filename(
-                                   m_event_id, "-measurement-simhit-map.csv")))
-                                  .native());
-
-    auto mhid_reader =
-        io::csv::make_measurement_hit_id_reader(io_measurement_hit_id_file);
-    {
-        io::csv::measurement_hit_id mh_id;
-        while (mhid_reader.read(mh_id)) {
-            csv_meas_hit_ids.push_back(mh_id);
+    // CSV IO EDM containers
+    truth_csv_data csv;
+
+    // Try to use the cached truth information first.
+    std::array<std::string, 5u> input_files{
+        io_hits_file, io_measurements_file, io_measurement_hit_id_file,
+        io_particles_file, (include_silicon_cells ? io_cells_file : "")};
+    const bool have_cache =
+        use_truth_cache &&
+        read_truth_cache(csv, truth_cache_file, input_files,
+                         include_silicon_cells);
+
+    if (!have_cache) {
+
+        // Read the (independent) files concurrently.
+        auto cells = std::async(std::launch::async, [&]() {
+            return include_silicon_cells
+                       ? read_csv_rows<io::csv::cell>(
+                             io::csv::make_cell_reader(io_cells_file))
+                       : std::vector<io::csv::cell>{};
+        });
+        auto hits = std::async(std::launch::async, [&]() {
+            return read_csv_rows<io::csv::hit>(
+                io::csv::make_hit_reader(io_hits_file));
+        });
+        auto measurements = std::async(std::launch::async, [&]() {
+            return read_csv_rows<io::csv::measurement>(
+                io::csv::make_measurement_reader(io_measurements_file));
+        });
+        auto meas_hit_ids = std::async(std::launch::async, [&]() {
+            return read_csv_rows<io::csv::measurement_hit_id>(
+                io::csv::make_measurement_hit_id_reader(
+                    io_measurement_hit_id_file));
+        });
+        csv.particles = read_csv_rows<io::csv::particle>(
+            io::csv::make_particle_reader(io_particles_file));
+        csv.cells = cells.get();
+        csv.hits = hits.get();
+        csv.measurements = measurements.get();
+        csv.meas_hit_ids = meas_hit_ids.get();
+
+        // Save the decoded files for the next time, if requested.
+        if (use_truth_cache) {
+            write_truth_cache(csv, truth_cache_file, input_files);
         }
     }
 
-    // Read the particles from the relevant event file
-    std::string io_particles_file =
-        io::get_absolute_path((std::filesystem::path(m_event_dir) /
-                               std::filesystem::path(io::get_event_filename(
-                                   m_event_id, "-particles_initial.csv")))
-                                  .native());
-
-    auto preader = io::csv::make_particle_reader(io_particles_file);
-    {
-        io::csv::particle ioptc;
-        while (preader.read(ioptc)) {
-            csv_particles.push_back(ioptc);
-        }
-    }
+    const std::vector<io::csv::cell>& csv_cells = csv.cells;
+    const std::vector<io::csv::hit>& csv_hits = csv.hits;
+    const std::vector<io::csv::measurement>& csv_measurements =
+        csv.measurements;
+    const std::vector<io::csv::measurement_hit_id>& csv_meas_hit_ids =
+        csv.meas_hit_ids;
+    const std::vector<io::csv::particle>& csv_particles = csv.particles;
 
     /********************
      * Make geom_id map *
@@ -163,6 +322,13 @@ void event_data::setup_csv(bool use_acts_geom_source, const detector_type* det,
         std::cout << "Using hit time" << std::endl;
     }
 
+    // Measurements in the order of the CSV file, and a flat, sorted lookup
+    // table from measurement IDs to their position in that order
+    std::vector<measurement> measurements;
+    measurements.reserve(csv_measurements.size());
+    std::vector<std::pair<std::uint64_t, std::size_t>> measurement_lookup;
+    measurement_lookup.reserve(csv_measurements.size());
+
     // Measurement map
     for (const auto& iomeas : csv_measurements) {
         // Construct the measurement object.
@@ -188,7 +354,26 @@ void event_data::setup_csv(bool use_acts_geom_source, const detector_type* det,
         } else {
             throw std::runtime_error("Measurement ID exceeds the bound");
         }
+        measurement_lookup.emplace_back(iomeas.measurement_id,
+                                        measurements.size());
+        measurements.push_back(meas);
     }
+    std::ranges::sort(measurement_lookup);
+
+    // Find a measurement by its ID. Like with the measurement map, the last
+    // measurement wins if the same ID appears more than once.
+    auto find_measurement =
+        [&](std::uint64_t meas_id) -> const traccc::measurement& {
+        auto it = std::ranges::upper_bound(
+            measurement_lookup,
+            std::make_pair(meas_id, std::numeric_limits<std::size_t>::max()));
+        if ((it == measurement_lookup.begin()) ||
+            (std::prev(it)->first != meas_id)) {
+            throw std::out_of_range("Unknown measurement ID " +
+                                    std::to_string(meas_id));
+        }
+        return measurements[std::prev(it)->second];
+    };
 
     // Particle map
     for (const auto& ioptc : csv_particles) {
@@ -210,35 +395,26 @@ void event_data::setup_csv(bool use_acts_geom_source, const detector_type* det,
     // When including silicon cells
     if (include_silicon_cells) {
 
-        std::map<measurement, std::vector<io::csv::cell>> meas_to_cluster_map;
+        // The measurement of each cell
+        std::vector<const traccc::measurement*> cell_measurements;
+        cell_measurements.reserve(csv_cells.size());
 
         for (const auto& iocell : csv_cells) {
 
-            // Fill the measurement_to_cluster_map
             auto meas_id = iocell.measurement_id;
             auto hid = csv_meas_hit_ids[meas_id].hit_id;
             const auto& iohit = csv_hits[hid];
 
-            traccc::measurement meas;
-            if (meas_id <= std::numeric_limits<measurement_id_type>::max()) {
-                meas = m_measurement_map.at(
-                    static_cast<measurement_id_type>(meas_id));
-            } else {
-                throw std::runtime_error("Measurement ID exceeds the bound");
-            }
-
-            meas_to_cluster_map[meas].push_back(iocell);
+            cell_measurements.push_back(&find_measurement(meas_id));
 
             const auto& ptc = m_particle_map.at(iohit.particle_id);
             m_cell_to_particle_map[iocell] = ptc;
         }
 
         // Fill the meas_to_particle_map
-        for (auto const& [ms, cluster] : meas_to_cluster_map) {
-            for (const auto& cell : cluster) {
-                const auto& ptc = m_cell_to_particle_map.at(cell);
-                m_meas_to_ptc_map[ms][ptc]++;
-            }
+        for (std::size_t i = 0; i < csv_cells.size(); ++i) {
+            const auto& ptc = m_cell_to_particle_map.at(csv_cells[i]);
+            m_meas_to_ptc_map[*(cell_measurements[i])][ptc]++;
         }
     }
 
@@ -256,14 +432,8 @@ void event_data::setup_csv(bool use_acts_geom_source, const detector_type* det,
         const auto& ptc = m_particle_map.at(iohit.particle_id);
 
         // Construct the measurement object.
-        traccc::measurement meas;
-        if (iomeas.measurement_id <=
-            std::numeric_limits<measurement_id_type>::max()) {
-            meas = m_measurement_map.at(
-                static_cast<measurement_id_type>(iomeas.measurement_id));
-        } else {
-            throw std::runtime_error("Measurement ID exceeds the bound");
-        }
+        const traccc::measurement& meas =
+            find_measurement(iomeas.measurement_id);
 
         // Fill measurement to truth global position and momentum map
         m_meas_to_param_map[meas] = std::make_pair(global_pos, global_mom);
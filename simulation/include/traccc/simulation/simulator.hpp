@@ -132,6 +132,9 @@ struct simulator {
                 // Increase the particle id
                 writer_state.particle_id++;
             }
+
+            // Finish writing the event
+            writer_state.write_event();
         }
     }
 
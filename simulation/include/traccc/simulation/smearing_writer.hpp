@@ -8,11 +8,17 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/particle.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
 #include "traccc/edm/track_parameters.hpp"
 #include "traccc/io/csv/hit.hpp"
+#include "traccc/io/csv/make_measurement_edm.hpp"
 #include "traccc/io/csv/measurement.hpp"
 #include "traccc/io/csv/measurement_hit_id.hpp"
 #include "traccc/io/csv/particle.hpp"
+#include "traccc/io/details/sort_measurements.hpp"
+#include "traccc/io/event_archive.hpp"
 #include "traccc/io/utils.hpp"
 #include "traccc/simulation/measurement_smearer.hpp"
 #include "traccc/utils/particle.hpp"
@@ -21,13 +27,19 @@
 #include <detray/propagator/base_actor.hpp>
 #include <detray/utils/concepts.hpp>
 
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
 // DFE include(s).
 #include <dfe/dfe_io_dsv.hpp>
 #include <dfe/dfe_namedtuple.hpp>
 
 // System include(s).
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace traccc {
 
@@ -45,40 +57,87 @@ struct smearing_writer : detray::actor {
 
     struct config {
         smearer_t smearer;
+        /// Archive to write the events into, instead of per-event CSV files
+        std::shared_ptr<io::event_archive_writer> archive;
     };
 
     struct state {
         state(std::size_t event_id, const config& writer_cfg,
               const std::string directory)
-            : m_particle_writer((std::filesystem::path{directory} /
-                                 traccc::io::get_event_filename(
-                                     event_id, "-particles_initial.csv"))
-                                    .native()),
-              m_hit_writer(
-                  (std::filesystem::path{directory} /
-                   traccc::io::get_event_filename(event_id, "-hits.csv"))
-                      .native()),
-              m_meas_writer((std::filesystem::path{directory} /
-                             traccc::io::get_event_filename(
-                                 event_id, "-measurements.csv"))
-                                .native()),
-              m_measurement_hit_id_writer(
-                  (std::filesystem::path{directory} /
-                   traccc::io::get_event_filename(
-                       event_id, "-measurement-simhit-map.csv"))
-                      .native()),
-              m_meas_smearer(writer_cfg.smearer) {}
+            : m_event_id(event_id),
+              m_archive(writer_cfg.archive),
+              m_spacepoints(m_mr),
+              m_meas_smearer(writer_cfg.smearer) {
+
+            // The CSV files are only written without an archive.
+            if (m_archive) {
+                return;
+            }
+            m_particle_writer.emplace((std::filesystem::path{directory} /
+                                       traccc::io::get_event_filename(
+                                           event_id, "-particles_initial.csv"))
+                                          .native());
+            m_hit_writer.emplace(
+                (std::filesystem::path{directory} /
+                 traccc::io::get_event_filename(event_id, "-hits.csv"))
+                    .native());
+            m_meas_writer.emplace((std::filesystem::path{directory} /
+                                   traccc::io::get_event_filename(
+                                       event_id, "-measurements.csv"))
+                                      .native());
+            m_measurement_hit_id_writer.emplace(
+                (std::filesystem::path{directory} /
+                 traccc::io::get_event_filename(
+                     event_id, "-measurement-simhit-map.csv"))
+                    .native());
+        }
 
         uint64_t particle_id = 0u;
-        particle_writer m_particle_writer;
-        hit_writer m_hit_writer;
-        measurement_writer m_meas_writer;
-        measurement_hit_id_writer m_measurement_hit_id_writer;
+        std::size_t m_event_id;
+        std::optional<particle_writer> m_particle_writer;
+        std::optional<hit_writer> m_hit_writer;
+        std::optional<measurement_writer> m_meas_writer;
+        std::optional<measurement_hit_id_writer> m_measurement_hit_id_writer;
+        std::shared_ptr<io::event_archive_writer> m_archive;
+        vecmem::host_memory_resource m_mr;
+        particle_collection_types::host m_particles{&m_mr};
+        edm::spacepoint_collection::host m_spacepoints;
+        measurement_collection_types::host m_measurements{&m_mr};
         uint64_t m_hit_count = 0u;
         smearer_t m_meas_smearer;
 
         void set_seed(const uint_fast64_t sd) { m_meas_smearer.set_seed(sd); }
 
+        /// Write the collected event data into the archive (if there is one)
+        ///
+        /// The measurements are sorted the same way as the CSV reader sorts
+        /// them, with the measurement indices of the spacepoints and the
+        /// measurement to hit map following the new order.
+        ///
+        void write_event() {
+            if (!m_archive) {
+                return;
+            }
+
+            // Sort the measurements, and update the references to them.
+            const std::vector<measurement_id_type> new_index =
+                io::details::sort_measurements(m_measurements);
+            io::details::remap_measurement_indices(m_spacepoints, new_index);
+
+            // Every hit made the measurement with the same original index.
+            std::vector<io::csv::measurement_hit_id> measurement_hits(
+                new_index.size());
+            for (unsigned int i = 0u; i < new_index.size(); ++i) {
+                measurement_hits[new_index[i]].measurement_id = new_index[i];
+                measurement_hits[new_index[i]].hit_id = i;
+            }
+
+            m_archive->write(m_event_id, vecmem::get_data(m_particles));
+            m_archive->write(m_event_id, vecmem::get_data(m_spacepoints),
+                             vecmem::get_data(m_measurements));
+            m_archive->write(m_event_id, measurement_hits);
+        }
+
         void write_particle(
             const traccc::free_track_parameters<algebra_type>& track,
             const traccc::pdg_particle<scalar_type>& ptc_type) {
@@ -97,7 +156,19 @@ struct smearing_writer : detray::actor {
             particle.pz = static_cast<float>(mom[2]);
             particle.q = static_cast<float>(ptc_type.charge());
 
-            m_particle_writer.append(particle);
+            if (m_archive) {
+                m_particles.push_back(
+                    {particle.particle_id,
+                     particle.particle_type,
+                     particle.process,
+                     {particle.vx, particle.vy, particle.vz},
+                     particle.vt,
+                     {particle.px, particle.py, particle.pz},
+                     particle.m,
+                     particle.q});
+            } else {
+                m_particle_writer->append(particle);
+            }
         }
     };
 
@@ -151,7 +222,17 @@ struct smearing_writer : detray::actor {
             hit.tpy = static_cast<float>(mom[1]);
             hit.tpz = static_cast<float>(mom[2]);
 
-            writer_state.m_hit_writer.append(hit);
+            if (writer_state.m_archive) {
+                writer_state.m_spacepoints.push_back(
+                    {static_cast<unsigned int>(writer_state.m_hit_count),
+                     edm::spacepoint_collection::host::
+                         INVALID_MEASUREMENT_INDEX,
+                     {hit.tx, hit.ty, hit.tz},
+                     0.f,
+                     0.f});
+            } else {
+                writer_state.m_hit_writer->append(hit);
+            }
 
             // Write measurements
             io::csv::measurement meas;
@@ -171,13 +252,51 @@ struct smearing_writer : detray::actor {
             sf.template visit_mask<measurement_kernel>(
                 bound_params, writer_state.m_meas_smearer, meas);
 
-            writer_state.m_meas_writer.append(meas);
-
-            // Write hit measurement map
-            io::csv::measurement_hit_id measurement_hit_id;
-            measurement_hit_id.hit_id = writer_state.m_hit_count;
-            measurement_hit_id.measurement_id = writer_state.m_hit_count;
-            writer_state.m_measurement_hit_id_writer.append(measurement_hit_id);
+            if (writer_state.m_archive) {
+                writer_state.m_measurements.push_back(
+                    io::csv::make_measurement_edm(meas, nullptr));
+
+                // Give the spacepoint of the hit the variances of its
+                // measurement, projected onto the radial and the Z
+                // directions.
+                using point2_type = detray::dpoint2D<algebra_type>;
+                const auto local = bound_params.bound_local();
+                const auto dir = track.dir();
+                const auto centre = sf.local_to_global({}, local, dir);
+                const auto axis0 =
+                    sf.local_to_global(
+                        {}, point2_type{local[0] + 1.f, local[1]}, dir) -
+                    centre;
+                const auto axis1 =
+                    sf.local_to_global(
+                        {}, point2_type{local[0], local[1] + 1.f}, dir) -
+                    centre;
+                const scalar_type r2 =
+                    centre[0] * centre[0] + centre[1] * centre[1];
+                if (r2 > 0.f) {
+                    const scalar_type proj0 =
+                        axis0[0] * centre[0] + axis0[1] * centre[1];
+                    const scalar_type proj1 =
+                        axis1[0] * centre[0] + axis1[1] * centre[1];
+                    writer_state.m_spacepoints.radius_variance().back() =
+                        static_cast<scalar>((meas.var_local0 * proj0 * proj0 +
+                                             meas.var_local1 * proj1 * proj1) /
+                                            r2);
+                }
+                writer_state.m_spacepoints.z_variance().back() =
+                    static_cast<scalar>(
+                        meas.var_local0 * axis0[2] * axis0[2] +
+                        meas.var_local1 * axis1[2] * axis1[2]);
+            } else {
+                writer_state.m_meas_writer->append(meas);
+
+                // Write hit measurement map
+                io::csv::measurement_hit_id measurement_hit_id;
+                measurement_hit_id.hit_id = writer_state.m_hit_count;
+                measurement_hit_id.measurement_id = writer_state.m_hit_count;
+                writer_state.m_measurement_hit_id_writer->append(
+                    measurement_hit_id);
+            }
             writer_state.m_hit_count++;
         }
     }
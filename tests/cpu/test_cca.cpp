@@ -52,6 +52,56 @@ cca_function_t f = [](const traccc::edm::silicon_cell_collection::host& cells,
 
     return {std::move(result), std::nullopt};
 };
+
+traccc::host::sparse_ccl_runs_algorithm ccr(resource);
+
+cca_function_t rf = [](const traccc::edm::silicon_cell_collection::host& cells,
+                       const traccc::silicon_detector_description::host& dd)
+    -> std::pair<
+        std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>>,
+        std::optional<traccc::edm::silicon_cluster_collection::host>> {
+    std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>> result;
+
+    const traccc::edm::silicon_cell_collection::const_data cells_data =
+        vecmem::get_data(cells);
+    const traccc::silicon_detector_description::const_data dd_data =
+        vecmem::get_data(dd);
+
+    auto clusters = ccr(cells_data);
+    const auto clusters_data = vecmem::get_data(clusters);
+    auto measurements = mc(cells_data, clusters_data, dd_data);
+
+    for (std::size_t i = 0; i < measurements.size(); i++) {
+        result[measurements.at(i).surface_link.value()].push_back(
+            measurements.at(i));
+    }
+
+    return {std::move(result), std::move(clusters)};
+};
+
+traccc::host::clusterization_algorithm::config_type parallel_config() {
+    traccc::host::clusterization_algorithm::config_type config;
+    config.parallel = true;
+    return config;
+}
+traccc::host::clusterization_algorithm pca(parallel_config(), resource);
+
+cca_function_t pf = [](const traccc::edm::silicon_cell_collection::host& cells,
+                       const traccc::silicon_detector_description::host& dd)
+    -> std::pair<
+        std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>>,
+        std::optional<traccc::edm::silicon_cluster_collection::host>> {
+    std::map<traccc::geometry_id, vecmem::vector<traccc::measurement>> result;
+
+    auto measurements = pca(vecmem::get_data(cells), vecmem::get_data(dd));
+
+    for (std::size_t i = 0; i < measurements.size(); i++) {
+        result[measurements.at(i).surface_link.value()].push_back(
+            measurements.at(i));
+    }
+
+    return {std::move(result), std::nullopt};
+};
 }  // namespace
 
 TEST_P(ConnectedComponentAnalysisTests, Run) {
@@ -64,3 +114,17 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values(f),
         ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
     ConnectedComponentAnalysisTests::get_test_name);
+
+INSTANTIATE_TEST_SUITE_P(
+    SparseCclRunsAlgorithm, ConnectedComponentAnalysisTests,
+    ::testing::Combine(
+        ::testing::Values(rf),
+        ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
+    ConnectedComponentAnalysisTests::get_test_name);
+
+INSTANTIATE_TEST_SUITE_P(
+    ParallelClusterizationAlgorithm, ConnectedComponentAnalysisTests,
+    ::testing::Combine(
+        ::testing::Values(pf),
+        ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
+    ConnectedComponentAnalysisTests::get_test_name);
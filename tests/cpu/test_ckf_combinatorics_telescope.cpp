@@ -123,11 +123,39 @@ TEST_P(CpuCkfCombinatoricsTelescopeTests, Run) {
     cfg_limit.max_num_branches_per_surface = 10;
     cfg_limit.chi2_max = 30.f;
 
+    traccc::finding_config cfg_parallel = cfg_no_limit;
+    cfg_parallel.parallel = true;
+
+    traccc::finding_config cfg_window = cfg_limit;
+    cfg_window.use_measurement_window = true;
+
     // Finding algorithm object
     traccc::host::combinatorial_kalman_filter_algorithm host_finding(
         cfg_no_limit, host_mr);
     traccc::host::combinatorial_kalman_filter_algorithm host_finding_limit(
         cfg_limit, host_mr);
+    traccc::host::combinatorial_kalman_filter_algorithm host_finding_parallel(
+        cfg_parallel, host_mr);
+    traccc::host::combinatorial_kalman_filter_algorithm host_finding_window(
+        cfg_window, host_mr);
+
+    // Check that two sets of track candidates are identical, in the same order
+    auto expect_same = [](const auto& result, const auto& expected) {
+        ASSERT_EQ(result.size(), expected.size());
+        for (unsigned int i = 0; i < expected.size(); ++i) {
+            const auto expected_track = expected.at(i);
+            const auto result_track = result.at(i);
+            EXPECT_EQ(result_track.chi2(), expected_track.chi2());
+            EXPECT_EQ(result_track.nholes(), expected_track.nholes());
+            ASSERT_EQ(result_track.measurement_indices().size(),
+                      expected_track.measurement_indices().size());
+            for (std::size_t j = 0;
+                 j < expected_track.measurement_indices().size(); ++j) {
+                EXPECT_EQ(result_track.measurement_indices()[j],
+                          expected_track.measurement_indices()[j]);
+            }
+        }
+    };
 
     // Iterate over events
     for (std::size_t i_evt = 0; i_evt < n_events; i_evt++) {
@@ -170,6 +198,17 @@ TEST_P(CpuCkfCombinatoricsTelescopeTests, Run) {
                   std::pow(n_truth_tracks, std::get<11>(GetParam()) + 1));
         ASSERT_EQ(track_candidates_limit.size(),
                   n_truth_tracks * cfg_limit.max_num_branches_per_seed);
+
+        // Make sure that the parallel track finding finds the same tracks, in
+        // the same order
+        auto track_candidates_parallel = host_finding_parallel(
+            host_det, field, measurements_view, seeds_view);
+        expect_same(track_candidates_parallel, track_candidates);
+
+        // Make sure that the measurement window does not change the result
+        auto track_candidates_window =
+            host_finding_window(host_det, field, measurements_view, seeds_view);
+        expect_same(track_candidates_window, track_candidates_limit);
     }
 }
 
@@ -0,0 +1,101 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/dbscan_algorithm.hpp"
+#include "traccc/clusterization/dbscan_config.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+/// Get the (sorted) cell indices of all clusters
+std::vector<std::vector<unsigned int>> get_clusters(
+    const traccc::edm::silicon_cluster_collection::host& clusters) {
+
+    std::vector<std::vector<unsigned int>> result;
+    for (std::size_t i = 0; i < clusters.size(); ++i) {
+        const auto& indices = clusters.cell_indices().at(i);
+        result.emplace_back(indices.begin(), indices.end());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+}  // namespace
+
+TEST(CPUDbscan, SingleLinkage) {
+
+    vecmem::host_memory_resource mr;
+
+    // Two groups of cells on module 0, and one cell on module 1 that is
+    // "right next to" the first group in channel space.
+    traccc::edm::silicon_cell_collection::host cells{mr};
+    cells.push_back({1u, 2u, 1.f, 0.f, 0u});
+    cells.push_back({2u, 2u, 1.f, 0.f, 0u});
+    cells.push_back({3u, 3u, 1.f, 0.f, 0u});
+    cells.push_back({9u, 9u, 1.f, 0.f, 0u});
+    cells.push_back({10u, 9u, 1.f, 0.f, 0u});
+    cells.push_back({2u, 2u, 1.f, 0.f, 1u});
+
+    // With min_pts == 1, cells are neighbours if their Manhattan distance in
+    // channel space is at most 2.
+    traccc::dbscan_config config;
+    config.epsilon = 0.25f;
+    config.min_pts = 1u;
+    config.channel0_range = 4.f;
+    config.channel1_range = 4.f;
+
+    traccc::host::dbscan_algorithm dbscan(config, mr);
+    const auto clusters = dbscan(vecmem::get_data(cells));
+
+    const std::vector<std::vector<unsigned int>> expected{
+        {0u, 1u, 2u}, {3u, 4u}, {5u}};
+    EXPECT_EQ(get_clusters(clusters), expected);
+}
+
+TEST(CPUDbscan, NoiseCells) {
+
+    vecmem::host_memory_resource mr;
+
+    // A dense 3x3 block, with a border cell attached to it and an isolated
+    // cell far away from it.
+    traccc::edm::silicon_cell_collection::host cells{mr};
+    for (traccc::channel_id c1 = 10u; c1 < 13u; ++c1) {
+        for (traccc::channel_id c0 = 10u; c0 < 13u; ++c0) {
+            cells.push_back({c0, c1, 1.f, 0.f, 0u});
+        }
+    }
+    cells.push_back({14u, 12u, 1.f, 0.f, 0u});
+    cells.push_back({100u, 100u, 1.f, 0.f, 0u});
+
+    // Neighbours are at a Manhattan distance of at most 2, and a core cell
+    // needs 5 of them.
+    traccc::dbscan_config config;
+    config.epsilon = 0.5f;
+    config.min_pts = 5u;
+    config.channel0_range = 2.f;
+    config.channel1_range = 2.f;
+
+    traccc::host::dbscan_algorithm dbscan(config, mr);
+    const auto clusters = dbscan(vecmem::get_data(cells));
+
+    // The border cell joins the block, while the isolated (noise) cell
+    // becomes a cluster on its own.
+    const std::vector<std::vector<unsigned int>> expected{
+        {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u}, {10u}};
+    EXPECT_EQ(get_clusters(clusters), expected);
+}
@@ -0,0 +1,97 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/measurement.hpp"
+#include "traccc/edm/track_parameters.hpp"
+#include "traccc/edm/track_state.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_batch_updater.hpp"
+#include "traccc/fitting/kalman_filter/gain_matrix_updater.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <vector>
+
+using namespace traccc;
+
+namespace {
+
+/// Make predicted track parameters with a non-trivial covariance
+bound_track_parameters<> make_predicted(scalar loc0) {
+
+    bound_track_parameters<> result{};
+    result.set_surface_link(detray::geometry::barcode{}
+                                .set_volume(0u)
+                                .set_id(detray::surface_id::e_sensitive)
+                                .set_index(0u));
+    result.set_bound_local({loc0, -1.5f});
+    result.set_phi(0.3f);
+    result.set_theta(1.2f);
+    result.set_qop(-0.5f);
+
+    bound_matrix<> cov = matrix::zero<bound_matrix<>>();
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        getter::element(cov, i, i) = 0.01f * static_cast<scalar>(i + 1u);
+    }
+    getter::element(cov, e_bound_loc0, e_bound_loc1) = 0.002f;
+    getter::element(cov, e_bound_loc1, e_bound_loc0) = 0.002f;
+    getter::element(cov, e_bound_loc0, e_bound_phi) = 0.001f;
+    getter::element(cov, e_bound_phi, e_bound_loc0) = 0.001f;
+    result.set_covariance(cov);
+    return result;
+}
+
+/// Make the measurements to test with
+std::vector<measurement> make_measurements() {
+
+    std::vector<measurement> result;
+    for (scalar offset : {-0.3f, 0.f, 0.1f, 0.25f}) {
+        // Two dimensional measurements.
+        measurement meas{};
+        meas.local = {1.f + offset, -1.5f - 0.5f * offset};
+        meas.variance = {0.02f, 0.05f};
+        result.push_back(meas);
+        // With swapped axes.
+        meas.subs.set_indices({e_bound_loc1, e_bound_loc0});
+        result.push_back(meas);
+        // One dimensional measurements.
+        meas.subs.set_indices({e_bound_loc0, e_bound_loc1});
+        meas.meas_dim = 1u;
+        meas.local[1] = 0.f;
+        result.push_back(meas);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(gain_matrix_batch_updater, chi2) {
+
+    for (bool is_line : {false, true}) {
+        for (scalar loc0 : {1.f, -1.f}) {
+
+            const bound_track_parameters<> predicted = make_predicted(loc0);
+            gain_matrix_batch_updater<default_algebra> batch_updater(predicted,
+                                                                     is_line);
+            ASSERT_EQ(batch_updater.status(), kalman_fitter_status::SUCCESS);
+
+            // The chi2 of all measurements must agree with the one of the
+            // single measurement update.
+            for (const measurement& meas : make_measurements()) {
+                track_state<default_algebra> trk_state(meas);
+                ASSERT_EQ(gain_matrix_updater<default_algebra>{}(
+                              trk_state, predicted, is_line),
+                          kalman_fitter_status::SUCCESS);
+                const scalar expected = trk_state.filtered_chi2();
+                EXPECT_NEAR(batch_updater.chi2(meas), expected,
+                            1e-4f + 1e-4f * expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/edm/measurement_index.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <array>
+
+namespace {
+
+/// Make a barcode for a surface with a given index
+detray::geometry::barcode make_barcode(unsigned int index) {
+    return detray::geometry::barcode{}.set_volume(0u).set_index(index);
+}
+
+}  // namespace
+
+TEST(measurement_index, ranges) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // The number of measurements on the surfaces of a small detector.
+    constexpr std::array<unsigned int, 6u> n_measurements{3u, 0u, 1u,
+                                                          5u, 0u, 2u};
+
+    // Create the measurements, sorted by surface.
+    traccc::measurement_collection_types::host measurements{&host_mr};
+    for (unsigned int sf = 0u; sf < n_measurements.size(); ++sf) {
+        for (unsigned int i = 0u; i < n_measurements[sf]; ++i) {
+            measurements.push_back({{static_cast<float>(i), 0.f},
+                                    {1.f, 1.f},
+                                    make_barcode(sf)});
+        }
+    }
+    std::sort(measurements.begin(), measurements.end(),
+              traccc::measurement_sort_comp());
+    const traccc::measurement_collection_types::const_device
+        measurements_device{vecmem::get_data(measurements)};
+
+    // Index the measurements.
+    const traccc::measurement_range_collection_types::host index =
+        traccc::host::make_measurement_index(
+            measurements_device, n_measurements.size(), host_mr);
+    ASSERT_EQ(index.size(), n_measurements.size());
+    const traccc::measurement_range_collection_types::const_device
+        index_device{vecmem::get_data(index)};
+
+    // Check the ranges of all surfaces.
+    for (unsigned int sf = 0u; sf < n_measurements.size(); ++sf) {
+        const traccc::measurement_range range =
+            traccc::get_measurement_range(index_device, make_barcode(sf));
+        ASSERT_EQ(range.second - range.first, n_measurements[sf]);
+        for (unsigned int i = range.first; i < range.second; ++i) {
+            EXPECT_EQ(measurements.at(i).surface_link, make_barcode(sf));
+        }
+    }
+
+    // Surfaces outside of the index have no measurements.
+    const traccc::measurement_range outside = traccc::get_measurement_range(
+        index_device,
+        make_barcode(static_cast<unsigned int>(n_measurements.size())));
+    EXPECT_EQ(outside.first, outside.second);
+}
@@ -0,0 +1,76 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/utils/scratch_memory_resource.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+
+using namespace traccc;
+
+// Test the alignment of the allocations
+TEST(scratch_memory_resource, alignment) {
+
+    vecmem::host_memory_resource host_mr;
+    scratch_memory_resource mr{host_mr, 256u};
+
+    for (std::size_t alignment : {1u, 2u, 8u, 64u, 128u}) {
+        void* ptr = mr.allocate(3u, alignment);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+    }
+    // An allocation larger than the block size.
+    void* ptr = mr.allocate(1000u, 16u);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 16u, 0u);
+
+    EXPECT_EQ(mr.get_statistics().n_allocations, 6u);
+    EXPECT_EQ(mr.get_statistics().allocated_bytes, 5u * 3u + 1000u);
+}
+
+// Test that the memory is re-used after a reset
+TEST(scratch_memory_resource, reset) {
+
+    vecmem::host_memory_resource host_mr;
+    scratch_memory_resource mr{host_mr, 64u};
+
+    // Fill a vector a couple of times, rewinding the resource in between.
+    scratch_memory_resource::statistics first_pass;
+    for (int pass = 0; pass < 3; ++pass) {
+        mr.reset();
+        vecmem::vector<int> v{&mr};
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(v[static_cast<std::size_t>(i)], i);
+        }
+        if (pass == 0) {
+            first_pass = mr.get_statistics();
+            EXPECT_GT(first_pass.n_upstream_allocations, 1u);
+        } else if (pass == 1) {
+            // Merging the blocks of the first pass needs one more upstream
+            // allocation.
+            EXPECT_EQ(mr.get_statistics().n_upstream_allocations,
+                      first_pass.n_upstream_allocations + 1u);
+        } else {
+            // The third pass should not need any.
+            EXPECT_EQ(mr.get_statistics().n_upstream_allocations,
+                      first_pass.n_upstream_allocations + 1u);
+            EXPECT_EQ(mr.get_statistics().n_allocations,
+                      3u * first_pass.n_allocations);
+        }
+    }
+}
@@ -9,8 +9,12 @@
 #include "traccc/definitions/common.hpp"
 #include "traccc/edm/measurement.hpp"
 #include "traccc/edm/spacepoint_collection.hpp"
+#include "traccc/seeding/detail/spacepoint_binning.hpp"
+#include "traccc/seeding/doublet_finding_batch_helper.hpp"
+#include "traccc/seeding/doublet_finding_helper.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/seeding/triplet_weighting_helper.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -18,6 +22,13 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
 using namespace traccc;
 
 namespace {
@@ -29,6 +40,51 @@ vecmem::host_memory_resource host_mr;
 static constexpr vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
                            2.f * unit<scalar>::T};
 
+/// Properties of the tracks made by @c make_track_spacepoints
+struct track_properties {
+    /// Spread of the track origins along the beam line
+    scalar z0_spread = 0.f;
+    /// Z variance of the spacepoints
+    scalar z_variance = 0.f;
+    /// Radius variance of the spacepoints
+    scalar radius_variance = 0.f;
+    /// Make three out of every four tracks central
+    bool mostly_central = false;
+};
+
+/// Make spacepoints along straight tracks, on five cylindrical layers
+///
+/// The tracks are spread evenly in phi, and in cot(theta) between -2 and 2.
+///
+/// @param n_tracks The number of tracks to make
+/// @param props The properties of the tracks
+/// @return The spacepoints of all tracks
+///
+edm::spacepoint_collection::host make_track_spacepoints(
+    unsigned int n_tracks, const track_properties& props = {}) {
+
+    edm::spacepoint_collection::host spacepoints{host_mr};
+    for (unsigned int t = 0; t < n_tracks; ++t) {
+        const scalar fraction =
+            static_cast<scalar>(t) / static_cast<scalar>(n_tracks);
+        const scalar phi = -3.f + 6.f * fraction;
+        scalar cot_theta = -2.f + 4.f * fraction;
+        if (props.mostly_central && (t % 4u != 0u)) {
+            cot_theta = -0.2f + 0.52f * fraction;
+        }
+        const scalar z0 = props.z0_spread * (fraction - 0.5f);
+        for (scalar r : {35.f, 70.f, 105.f, 140.f, 175.f}) {
+            spacepoints.push_back(
+                {0u,
+                 edm::spacepoint_collection::host::INVALID_MEASUREMENT_INDEX,
+                 {r * std::cos(phi), r * std::sin(phi), z0 + r * cot_theta},
+                 props.z_variance,
+                 props.radius_variance});
+        }
+    }
+    return spacepoints;
+}
+
 }  // namespace
 
 // Seeding with two muons
@@ -175,3 +231,448 @@ TEST(seeding, case2) {
                 0.1 * unit<scalar>::GeV);
     */
 }
+
+// Check the layout of the flat spacepoint grid used by the host seeding
+TEST(seeding, flat_grid) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+
+    // Create some spacepoints, a few of them sharing the same bins, and one
+    // of them outside of the seeding region.
+    edm::spacepoint_collection::host spacepoints{host_mr};
+    for (const point3& global :
+         {point3{36.6706f, 10.6472f, 104.131f},
+          point3{-94.2191f, 29.6699f, -113.628f},
+          point3{36.6706f, 10.6472f, 104.5f},
+          point3{0.f, 0.f, 5000.f},
+          point3{94.2191f, -29.6699f, 113.628f},
+          point3{36.7f, 10.65f, 104.2f}}) {
+        spacepoints.push_back(
+            {0u, edm::spacepoint_collection::host::INVALID_MEASUREMENT_INDEX,
+             global, 0.1f, 0.2f});
+    }
+
+    // Bin the spacepoints.
+    traccc::host::details::spacepoint_binning sb{finder_config, grid_config,
+                                                 host_mr};
+    const traccc::details::flat_spacepoint_grid grid =
+        sb(vecmem::get_data(spacepoints));
+
+    // Check that all valid spacepoints were binned exactly once, with their
+    // original order preserved inside of the bins.
+    ASSERT_EQ(grid.size(), 5u);
+    std::vector<unsigned int> seen(spacepoints.size(), 0u);
+    for (unsigned int bin = 0; bin < grid.nbins(); ++bin) {
+        ASSERT_LE(grid.bin_begin(bin), grid.bin_end(bin));
+        const auto indices = grid.bin(bin);
+        for (unsigned int j = 0; j < indices.size(); ++j) {
+            if (j > 0u) {
+                EXPECT_LT(indices[j - 1u], indices[j]);
+            }
+            ++seen.at(indices[j]);
+
+            // Check the cached coordinates.
+            const auto sp = spacepoints.at(indices[j]);
+            const traccc::details::binned_spacepoint binned =
+                grid.at(sp_location{bin, j});
+            EXPECT_EQ(grid.sp_index(sp_location{bin, j}), indices[j]);
+            EXPECT_EQ(binned.x(), sp.x());
+            EXPECT_EQ(binned.y(), sp.y());
+            EXPECT_EQ(binned.z(), sp.z());
+            EXPECT_EQ(binned.radius(), sp.radius());
+            EXPECT_EQ(binned.phi(), sp.phi());
+            EXPECT_EQ(binned.z_variance(), sp.z_variance());
+            EXPECT_EQ(binned.radius_variance(), sp.radius_variance());
+        }
+    }
+    EXPECT_EQ(seen, (std::vector<unsigned int>{1u, 1u, 1u, 0u, 1u, 1u}));
+}
+
+// Check that the parallel host seed finding reproduces the serial one
+TEST(seeding, parallel) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100.f * unit<float>::mm;
+    finder_config.maxPtScattering = 0.5f * unit<float>::GeV;
+
+    // Create spacepoints along a set of straight tracks coming from the
+    // origin. Enough of them to be processed by multiple tasks.
+    const edm::spacepoint_collection::host spacepoints =
+        make_track_spacepoints(200u);
+
+    // Run the serial and the parallel seeding.
+    traccc::host::seeding_algorithm serial_sa(finder_config, grid_config,
+                                              filter_config, host_mr);
+    finder_config.parallel = true;
+    finder_config.max_threads = 2u;
+    traccc::host::seeding_algorithm parallel_sa(finder_config, grid_config,
+                                                filter_config, host_mr);
+    const auto serial_seeds = serial_sa(vecmem::get_data(spacepoints));
+    const auto parallel_seeds = parallel_sa(vecmem::get_data(spacepoints));
+
+    // The results must be identical.
+    ASSERT_GT(serial_seeds.size(), 0u);
+    ASSERT_EQ(parallel_seeds.size(), serial_seeds.size());
+    for (unsigned int i = 0; i < serial_seeds.size(); ++i) {
+        EXPECT_EQ(parallel_seeds.bottom_index().at(i),
+                  serial_seeds.bottom_index().at(i));
+        EXPECT_EQ(parallel_seeds.middle_index().at(i),
+                  serial_seeds.middle_index().at(i));
+        EXPECT_EQ(parallel_seeds.top_index().at(i),
+                  serial_seeds.top_index().at(i));
+    }
+}
+
+// Check that the batched doublet finding helpers agree with the scalar ones
+TEST(seeding, doublet_batch) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+
+    // Create spacepoints along a set of straight tracks, with origins
+    // spread along the beam line.
+    const edm::spacepoint_collection::host spacepoints =
+        make_track_spacepoints(50u, {.z0_spread = 600.f,
+                                     .z_variance = 0.1f,
+                                     .radius_variance = 0.2f});
+
+    // Bin the spacepoints.
+    traccc::host::details::spacepoint_binning sb{finder_config, grid_config,
+                                                 host_mr};
+    const traccc::details::flat_spacepoint_grid grid =
+        sb(vecmem::get_data(spacepoints));
+    ASSERT_GT(grid.size(), 0u);
+
+    // Compare the two implementations for all pairs of spacepoints.
+    std::vector<unsigned char> compatible(grid.size());
+    std::vector<unsigned int> candidates;
+    std::vector<traccc::lin_circle> lin_circles;
+    unsigned int n_compatible = 0u;
+    for (unsigned int middle = 0; middle < grid.size(); ++middle) {
+        traccc::doublet_finding_batch_helper::isCompatible<
+            traccc::details::spacepoint_type::bottom>(
+            grid, middle, 0u, grid.size(), finder_config, compatible.data());
+        candidates.clear();
+        for (unsigned int other = 0; other < grid.size(); ++other) {
+            const bool expected = traccc::doublet_finding_helper::isCompatible<
+                traccc::details::spacepoint_type::bottom>(
+                grid.at(middle), grid.at(other), finder_config);
+            EXPECT_EQ(compatible[other] != 0u, expected);
+            if (expected) {
+                candidates.push_back(other);
+            }
+        }
+        lin_circles.resize(candidates.size());
+        traccc::doublet_finding_batch_helper::transform_coordinates<
+            traccc::details::spacepoint_type::bottom>(
+            grid, middle, candidates.data(),
+            static_cast<unsigned int>(candidates.size()), lin_circles.data());
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            const traccc::lin_circle expected =
+                traccc::doublet_finding_helper::transform_coordinates<
+                    traccc::details::spacepoint_type::bottom>(
+                    grid.at(middle), grid.at(candidates[i]));
+            EXPECT_FLOAT_EQ(lin_circles[i].Zo(), expected.Zo());
+            EXPECT_FLOAT_EQ(lin_circles[i].cotTheta(), expected.cotTheta());
+            EXPECT_FLOAT_EQ(lin_circles[i].iDeltaR(), expected.iDeltaR());
+            EXPECT_FLOAT_EQ(lin_circles[i].Er(), expected.Er());
+            EXPECT_FLOAT_EQ(lin_circles[i].U(), expected.U());
+            EXPECT_FLOAT_EQ(lin_circles[i].V(), expected.V());
+        }
+        n_compatible += static_cast<unsigned int>(candidates.size());
+    }
+    EXPECT_GT(n_compatible, 0u);
+}
+
+// Compare the curvature sorted triplet weighting with the double loop
+TEST(seeding, sorted_triplet_weighting) {
+
+    // Make triplets with curvatures and top spacepoint radii that lead to
+    // many compatible pairs, including ones with identical curvatures.
+    std::mt19937 rng(1234u);
+    std::uniform_int_distribution<int> curvature_dist(0, 40);
+    std::uniform_int_distribution<int> layer_dist(0, 7);
+    std::uniform_real_distribution<scalar> jitter_dist(-3.f, 3.f);
+    triplet_collection_types::host triplets{&host_mr};
+    traccc::triplet_weighting_scratch tmp{host_mr};
+    for (unsigned int i = 0; i < 200u; ++i) {
+        const scalar curvature =
+            0.00001f * static_cast<scalar>(curvature_dist(rng)) /
+            unit<scalar>::mm;
+        const scalar top_radius =
+            100.f + 40.f * static_cast<scalar>(layer_dist(rng)) +
+            jitter_dist(rng);
+        triplets.push_back({{0u, 0u},
+                            {0u, 1u},
+                            {0u, i},
+                            curvature,
+                            -0.1f * static_cast<scalar>(i),
+                            0.f});
+        tmp.sorted.push_back({curvature, top_radius, i});
+    }
+
+    for (std::size_t limit : {2u, 5u}) {
+
+        traccc::seedfilter_config filter_config;
+        filter_config.compatSeedLimit = limit;
+
+        // Weight the triplets with both methods.
+        triplet_collection_types::host triplets_loop = triplets;
+        traccc::triplet_weighting_scratch tmp_loop = tmp;
+        traccc::triplet_weighting_helper::weight_triplets(
+            filter_config, triplets_loop, tmp_loop);
+        triplet_collection_types::host triplets_sorted = triplets;
+        traccc::triplet_weighting_scratch tmp_sorted = tmp;
+        traccc::triplet_weighting_helper::weight_sorted_triplets(
+            filter_config, triplets_sorted, tmp_sorted);
+
+        // The weights must be exactly the same.
+        ASSERT_EQ(triplets_loop.size(), triplets_sorted.size());
+        unsigned int n_changed = 0u;
+        for (std::size_t i = 0; i < triplets.size(); ++i) {
+            EXPECT_EQ(triplets_sorted[i].weight, triplets_loop[i].weight);
+            if (triplets_loop[i].weight != triplets[i].weight) {
+                ++n_changed;
+            }
+        }
+        EXPECT_GT(n_changed, 0u);
+    }
+}
+
+// Seeding in regions of interest
+TEST(seeding, roi) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100.f * unit<float>::mm;
+    finder_config.maxPtScattering = 0.5f * unit<float>::GeV;
+
+    // Create spacepoints along a set of straight tracks coming from the
+    // origin.
+    const edm::spacepoint_collection::host spacepoints =
+        make_track_spacepoints(200u);
+
+    // Set up an RoI covering the full event, a small one, and one crossing
+    // the +-pi boundary that covers the full event except for a narrow
+    // azimuthal gap between two of the tracks.
+    seeding_roi_collection_types::host rois{&host_mr};
+    rois.push_back({-5.f, 5.f, -constant<scalar>::pi, constant<scalar>::pi,
+                    finder_config.collisionRegionMin,
+                    finder_config.collisionRegionMax});
+    const seeding_roi small_roi{-0.5f, 0.5f, 0.f, 1.f, -1.f, 1.f};
+    rois.push_back(small_roi);
+    rois.push_back({-5.f, 5.f, 2.f, 1.999f, finder_config.collisionRegionMin,
+                    finder_config.collisionRegionMax});
+
+    // Run the seeding on the full event, and in the RoIs.
+    traccc::host::seeding_algorithm sa(finder_config, grid_config,
+                                       filter_config, host_mr);
+    const auto event_seeds = sa(vecmem::get_data(spacepoints));
+    const auto roi_result =
+        sa(vecmem::get_data(spacepoints), vecmem::get_data(rois));
+    ASSERT_EQ(roi_result.roi_offsets.size(), 4u);
+    EXPECT_EQ(roi_result.roi_offsets[0], 0u);
+    EXPECT_EQ(roi_result.roi_offsets[3], roi_result.seeds.size());
+
+    // The RoIs covering the full event must give the same seeds as the
+    // full event seeding.
+    ASSERT_GT(event_seeds.size(), 0u);
+    for (unsigned int roi_index : {0u, 2u}) {
+        const unsigned int offset = roi_result.roi_offsets[roi_index];
+        ASSERT_EQ(roi_result.roi_offsets[roi_index + 1u] - offset,
+                  event_seeds.size());
+        for (unsigned int i = 0; i < event_seeds.size(); ++i) {
+            EXPECT_EQ(roi_result.seeds.bottom_index().at(offset + i),
+                      event_seeds.bottom_index().at(i));
+            EXPECT_EQ(roi_result.seeds.middle_index().at(offset + i),
+                      event_seeds.middle_index().at(i));
+            EXPECT_EQ(roi_result.seeds.top_index().at(offset + i),
+                      event_seeds.top_index().at(i));
+        }
+    }
+
+    // The small RoI must only have seeds made of spacepoints inside of it.
+    ASSERT_GT(roi_result.roi_offsets[2], roi_result.roi_offsets[1]);
+    ASSERT_LT(roi_result.roi_offsets[2] - roi_result.roi_offsets[1],
+              event_seeds.size());
+    for (unsigned int i = roi_result.roi_offsets[1];
+         i < roi_result.roi_offsets[2]; ++i) {
+        for (unsigned int sp_index : {roi_result.seeds.bottom_index().at(i),
+                                      roi_result.seeds.middle_index().at(i),
+                                      roi_result.seeds.top_index().at(i)}) {
+            const auto sp = spacepoints.at(sp_index);
+            EXPECT_TRUE(is_inside(small_roi, sp.radius(), sp.z(), sp.phi()));
+        }
+    }
+}
+
+// Check the statistics collected by the host seeding
+TEST(seeding, statistics) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100.f * unit<float>::mm;
+    finder_config.maxPtScattering = 0.5f * unit<float>::GeV;
+    finder_config.collect_statistics = true;
+
+    // Create spacepoints along a set of straight tracks coming from the
+    // origin.
+    const edm::spacepoint_collection::host spacepoints =
+        make_track_spacepoints(200u);
+
+    // Run the serial and the parallel seeding, on two events each.
+    traccc::host::seeding_algorithm serial_sa(finder_config, grid_config,
+                                              filter_config, host_mr);
+    finder_config.parallel = true;
+    finder_config.max_threads = 2u;
+    traccc::host::seeding_algorithm parallel_sa(finder_config, grid_config,
+                                                filter_config, host_mr);
+    std::size_t n_seeds = 0u;
+    for (int event = 0; event < 2; ++event) {
+        n_seeds += serial_sa(vecmem::get_data(spacepoints)).size();
+        parallel_sa(vecmem::get_data(spacepoints));
+    }
+
+    // Check the consistency of the serial statistics.
+    const seeding_statistics stats = serial_sa.statistics();
+    EXPECT_EQ(stats.n_grids, 2u);
+    EXPECT_EQ(stats.n_spacepoints, 2u * spacepoints.size());
+    EXPECT_EQ(stats.n_middle_spacepoints, stats.n_spacepoints);
+    EXPECT_EQ(stats.n_seeds, n_seeds);
+    EXPECT_GT(stats.n_seeds, 0u);
+    EXPECT_GE(stats.n_triplets_passing_single_seed_cuts, stats.n_seeds);
+    EXPECT_GE(stats.n_triplets, stats.n_triplets_passing_single_seed_cuts);
+    EXPECT_GE(stats.n_triplet_candidates, stats.n_triplets);
+    EXPECT_LE(stats.n_middle_spacepoints_with_doublets,
+              stats.n_middle_spacepoints);
+    const auto sum = [](const seeding_statistics::histogram& h) {
+        std::uint64_t result = 0u;
+        for (std::uint64_t v : h) {
+            result += v;
+        }
+        return result;
+    };
+    EXPECT_EQ(sum(stats.mid_bot_doublets_per_middle),
+              stats.n_middle_spacepoints);
+    EXPECT_EQ(sum(stats.triplets_per_middle),
+              stats.n_middle_spacepoints_with_doublets);
+
+    // The histograms use power-of-two bins.
+    seeding_statistics::histogram h{};
+    for (std::size_t value : {0u, 1u, 2u, 3u, 4u, 7u, 8u}) {
+        seeding_statistics::fill(h, value);
+    }
+    seeding_statistics::fill(h, std::numeric_limits<std::size_t>::max());
+    EXPECT_EQ(h[0], 1u);
+    EXPECT_EQ(h[1], 1u);
+    EXPECT_EQ(h[2], 2u);
+    EXPECT_EQ(h[3], 2u);
+    EXPECT_EQ(h[4], 1u);
+    EXPECT_EQ(h.back(), 1u);
+    EXPECT_EQ(sum(h), 8u);
+    EXPECT_EQ(seeding_statistics::bin_lower_edge(0u), 0u);
+    EXPECT_EQ(seeding_statistics::bin_lower_edge(3u), 4u);
+
+    // The parallel seeding must count the same combinatorics.
+    const seeding_statistics parallel_stats = parallel_sa.statistics();
+    EXPECT_EQ(parallel_stats.n_mid_bot_doublets, stats.n_mid_bot_doublets);
+    EXPECT_EQ(parallel_stats.n_mid_top_doublets, stats.n_mid_top_doublets);
+    EXPECT_EQ(parallel_stats.n_triplets, stats.n_triplets);
+    EXPECT_EQ(parallel_stats.n_seeds, stats.n_seeds);
+    EXPECT_EQ(parallel_stats.bin_occupancy, stats.bin_occupancy);
+    EXPECT_EQ(parallel_stats.seeds_per_middle, stats.seeds_per_middle);
+
+    // Without requesting it, no statistics should be collected.
+    finder_config.collect_statistics = false;
+    traccc::host::seeding_algorithm plain_sa(finder_config, grid_config,
+                                             filter_config, host_mr);
+    plain_sa(vecmem::get_data(spacepoints));
+    EXPECT_EQ(plain_sa.statistics().n_grids, 0u);
+    EXPECT_EQ(plain_sa.statistics().n_middle_spacepoints, 0u);
+}
+
+// Check that the adaptive Z binning finds the same seeds as the uniform one
+TEST(seeding, adaptive_z_binning) {
+
+    // Config objects
+    traccc::seedfinder_config finder_config;
+    traccc::spacepoint_grid_config grid_config(finder_config);
+    traccc::seedfilter_config filter_config;
+
+    // Adjust parameters
+    finder_config.deltaRMax = 100.f * unit<float>::mm;
+    finder_config.maxPtScattering = 0.5f * unit<float>::GeV;
+    finder_config.collect_statistics = true;
+
+    // Create spacepoints along a set of straight tracks coming from the
+    // origin, most of them central.
+    const edm::spacepoint_collection::host spacepoints =
+        make_track_spacepoints(400u, {.mostly_central = true});
+
+    // Check that the adaptive binning splits some of the Z bins.
+    traccc::host::details::spacepoint_binning uniform_sb{
+        finder_config, grid_config, host_mr};
+    finder_config.adaptive_z_binning = true;
+    traccc::host::details::spacepoint_binning adaptive_sb{
+        finder_config, grid_config, host_mr};
+    const traccc::details::flat_spacepoint_grid uniform_grid =
+        uniform_sb(vecmem::get_data(spacepoints));
+    const traccc::details::flat_spacepoint_grid adaptive_grid =
+        adaptive_sb(vecmem::get_data(spacepoints));
+    EXPECT_TRUE(uniform_grid.has_uniform_z_bins());
+    EXPECT_FALSE(adaptive_grid.has_uniform_z_bins());
+    EXPECT_GT(adaptive_grid.z_bins(), uniform_grid.z_bins());
+    EXPECT_EQ(adaptive_grid.size(), uniform_grid.size());
+
+    // Run the seeding with uniform, adaptive and fixed Z bins.
+    finder_config.adaptive_z_binning = false;
+    traccc::host::seeding_algorithm uniform_sa(finder_config, grid_config,
+                                               filter_config, host_mr);
+    traccc::host::seeding_algorithm fixed_sa(finder_config, grid_config,
+                                             filter_config, host_mr);
+    const scalar z_width = (grid_config.zMax - grid_config.zMin) /
+                           static_cast<scalar>(uniform_grid.z_bins());
+    std::vector<scalar> z_edges;
+    for (unsigned int i = 0; i < uniform_grid.z_bins(); ++i) {
+        z_edges.push_back(grid_config.zMin + z_width * static_cast<scalar>(i));
+        z_edges.push_back(grid_config.zMin +
+                          z_width * (static_cast<scalar>(i) + 0.3f));
+    }
+    z_edges.push_back(grid_config.zMax);
+    fixed_sa.set_z_bin_edges(z_edges);
+    finder_config.adaptive_z_binning = true;
+    traccc::host::seeding_algorithm adaptive_sa(finder_config, grid_config,
+                                                filter_config, host_mr);
+
+    // All of them must find the same doublets, triplets and number of seeds.
+    // (The order of the triplets may differ, which could make the seed
+    // filtering choose differently between equal weight triplets.)
+    const auto uniform_seeds = uniform_sa(vecmem::get_data(spacepoints));
+    ASSERT_GT(uniform_seeds.size(), 0u);
+    for (traccc::host::seeding_algorithm* sa : {&adaptive_sa, &fixed_sa}) {
+        EXPECT_EQ((*sa)(vecmem::get_data(spacepoints)).size(),
+                  uniform_seeds.size());
+        EXPECT_EQ(sa->statistics().n_mid_bot_doublets,
+                  uniform_sa.statistics().n_mid_bot_doublets);
+        EXPECT_EQ(sa->statistics().n_mid_top_doublets,
+                  uniform_sa.statistics().n_mid_top_doublets);
+        EXPECT_EQ(sa->statistics().n_triplets,
+                  uniform_sa.statistics().n_triplets);
+    }
+}
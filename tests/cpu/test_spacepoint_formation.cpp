@@ -9,6 +9,11 @@
 #include "tests/test_detectors.hpp"
 #include "traccc/definitions/common.hpp"
 #include "traccc/seeding/silicon_pixel_spacepoint_formation_algorithm.hpp"
+#include "traccc/seeding/strip_spacepoint_formation_algorithm.hpp"
+#include "traccc/seeding/track_params_estimation.hpp"
+
+// Detray include(s).
+#include <detray/tracks/helix.hpp>
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -67,3 +72,260 @@ TEST(spacepoint_formation, cpu) {
     EXPECT_FLOAT_EQ(static_cast<float>(spacepoints[1].y()), 10.f);
     EXPECT_FLOAT_EQ(static_cast<float>(spacepoints[1].z()), 15.f);
 }
+
+TEST(spacepoint_formation, cpu_strips) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Use rectangle surfaces
+    detray::mask<detray::rectangle2D, traccc::default_algebra> rectangle{
+        0u, 10000.f * traccc::unit<scalar>::mm,
+        10000.f * traccc::unit<scalar>::mm};
+
+    // Plane alignment direction (aligned to x-axis)
+    detray::detail::ray<traccc::default_algebra> traj{
+        {0, 0, 0}, 0, {1, 0, 0}, -1};
+    // Position of two back-to-back planes (in mm unit)
+    std::vector<scalar> plane_positions = {20.f, 21.f};
+
+    detray::tel_det_config tel_cfg{rectangle};
+    tel_cfg.positions(plane_positions);
+    tel_cfg.pilot_track(traj);
+
+    // Create telescope geometry
+    const auto [det, name_map] = build_telescope_detector(host_mr, tel_cfg);
+
+    // Surface lookup
+    auto surfaces = det.surfaces();
+
+    // Pair up the two planes, with strips along local 1 on the first plane,
+    // and along local 0 on the second one
+    strip_module_pair_collection_types::host module_pairs{&host_mr};
+    module_pairs.push_back({surfaces[0].barcode(), surfaces[1u].barcode(),
+                            100.f, 100.f, 1u, 0u});
+
+    // Prepare measurement collection
+    typename measurement_collection_types::host measurements{&host_mr};
+
+    // Add a measurement of local 0 on the first plane
+    measurement meas1{{7.f, 0.f}, {0.f, 0.f}, surfaces[0].barcode()};
+    meas1.meas_dim = 1u;
+    meas1.subs.set_indices({e_bound_loc0, e_bound_loc0});
+    measurements.push_back(meas1);
+
+    // Add a measurement of local 1 on the second plane
+    measurement meas2{{0.f, 2.f}, {0.f, 0.f}, surfaces[1u].barcode()};
+    meas2.meas_dim = 1u;
+    meas2.subs.set_indices({e_bound_loc1, e_bound_loc0});
+    measurements.push_back(meas2);
+
+    // Add a measurement on the second plane, which does not measure the
+    // position across the strips of the plane
+    measurement meas3{{150.f, 0.f}, {0.f, 0.f}, surfaces[1u].barcode()};
+    meas3.meas_dim = 1u;
+    meas3.subs.set_indices({e_bound_loc0, e_bound_loc0});
+    measurements.push_back(meas3);
+
+    // Run spacepoint formation
+    host::strip_spacepoint_formation_algorithm sp_formation(
+        strip_spacepoint_formation_config{}, host_mr);
+    auto spacepoints = sp_formation(det, vecmem::get_data(module_pairs),
+                                    vecmem::get_data(measurements));
+
+    // Check the results. The spacepoint is on the first strip, along the
+    // line from the origin that crosses both strips.
+    ASSERT_EQ(spacepoints.size(), 1u);
+    EXPECT_EQ(spacepoints[0].measurement_index_1(), 0u);
+    EXPECT_EQ(spacepoints[0].measurement_index_2(), 1u);
+    EXPECT_NEAR(static_cast<float>(spacepoints[0].x()), 20.f, 1e-4f);
+    EXPECT_NEAR(static_cast<float>(spacepoints[0].y()), 7.f, 1e-4f);
+    EXPECT_NEAR(static_cast<float>(spacepoints[0].z()), 40.f / 21.f, 1e-4f);
+}
+
+TEST(spacepoint_formation, cpu_strip_module_pairs) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Use rectangle surfaces
+    detray::mask<detray::rectangle2D, traccc::default_algebra> rectangle{
+        0u, 10000.f * traccc::unit<scalar>::mm,
+        10000.f * traccc::unit<scalar>::mm};
+
+    // Plane alignment direction (aligned to x-axis)
+    detray::detail::ray<traccc::default_algebra> traj{
+        {0, 0, 0}, 0, {1, 0, 0}, -1};
+    // Position of two back-to-back planes, and of a third one further away
+    // (in mm unit)
+    std::vector<scalar> plane_positions = {20.f, 21.f, 60.f};
+
+    detray::tel_det_config tel_cfg{rectangle};
+    tel_cfg.positions(plane_positions);
+    tel_cfg.pilot_track(traj);
+
+    // Create telescope geometry
+    const auto [det, name_map] = build_telescope_detector(host_mr, tel_cfg);
+
+    // Surface lookup
+    auto surfaces = det.surfaces();
+
+    // Describe the planes as strip modules. The strips of the first and the
+    // third plane run along local 1, the strips of the second plane run
+    // along local 0.
+    silicon_detector_description::host dd{host_mr};
+    dd.resize(3u);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        dd.geometry_id().at(i) = surfaces[i].barcode();
+        dd.acts_geometry_id().at(i) = i;
+        dd.dimensions().at(i) = 1u;
+        dd.pitch_x().at(i) = (i == 1u ? 200.f : 0.1f);
+        dd.pitch_y().at(i) = (i == 1u ? 0.1f : 200.f);
+    }
+
+    // Find the module pairs of the detector
+    host::strip_spacepoint_formation_algorithm sp_formation(
+        strip_spacepoint_formation_config{}, host_mr);
+    const strip_module_pair_collection_types::host module_pairs =
+        sp_formation.find_module_pairs(det, vecmem::get_data(dd));
+
+    // Only the two back-to-back planes should be paired up
+    ASSERT_EQ(module_pairs.size(), 1u);
+    EXPECT_EQ(module_pairs[0].first_surface, surfaces[0].barcode());
+    EXPECT_EQ(module_pairs[0].second_surface, surfaces[1u].barcode());
+    EXPECT_FLOAT_EQ(module_pairs[0].first_half_length, 100.f);
+    EXPECT_FLOAT_EQ(module_pairs[0].second_half_length, 100.f);
+    EXPECT_EQ(module_pairs[0].first_strip_axis, 1u);
+    EXPECT_EQ(module_pairs[0].second_strip_axis, 0u);
+
+    // Make one measurement on each of the paired planes
+    typename measurement_collection_types::host measurements{&host_mr};
+    measurement meas1{{7.f, 0.f}, {0.f, 0.f}, surfaces[0].barcode()};
+    meas1.meas_dim = 1u;
+    measurements.push_back(meas1);
+    measurement meas2{{0.f, 2.f}, {0.f, 0.f}, surfaces[1u].barcode()};
+    meas2.meas_dim = 1u;
+    meas2.subs.set_indices({e_bound_loc1, e_bound_loc0});
+    measurements.push_back(meas2);
+
+    // Form a spacepoint out of them, using the found module pairs
+    auto spacepoints = sp_formation(det, vecmem::get_data(module_pairs),
+                                    vecmem::get_data(measurements));
+    ASSERT_EQ(spacepoints.size(), 1u);
+    EXPECT_EQ(spacepoints[0].measurement_index_1(), 0u);
+    EXPECT_EQ(spacepoints[0].measurement_index_2(), 1u);
+    EXPECT_NEAR(static_cast<float>(spacepoints[0].x()), 20.f, 1e-4f);
+    EXPECT_NEAR(static_cast<float>(spacepoints[0].y()), 7.f, 1e-4f);
+    EXPECT_NEAR(static_cast<float>(spacepoints[0].z()), 40.f / 21.f, 1e-4f);
+}
+
+TEST(spacepoint_formation, cpu_strips_track_params) {
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Use rectangle surfaces
+    detray::mask<detray::rectangle2D, traccc::default_algebra> rectangle{
+        0u, 10000.f * traccc::unit<scalar>::mm,
+        10000.f * traccc::unit<scalar>::mm};
+
+    // Plane alignment direction (aligned to x-axis)
+    detray::detail::ray<traccc::default_algebra> traj{
+        {0, 0, 0}, 0, {1, 0, 0}, -1};
+    // Positions of three pairs of back-to-back planes (in mm unit)
+    std::vector<scalar> plane_positions = {50.f,  51.f,  100.f,
+                                           101.f, 150.f, 151.f};
+
+    detray::tel_det_config tel_cfg{rectangle};
+    tel_cfg.positions(plane_positions);
+    tel_cfg.pilot_track(traj);
+
+    // Create telescope geometry
+    const auto [det, name_map] = build_telescope_detector(host_mr, tel_cfg);
+
+    // Surface lookup
+    auto surfaces = det.surfaces();
+
+    // Pair up the back-to-back planes, with strips along local 1 on the
+    // first plane of each pair, and along local 0 on the second one
+    strip_module_pair_collection_types::host module_pairs{&host_mr};
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        module_pairs.push_back({surfaces[2u * i].barcode(),
+                                surfaces[2u * i + 1u].barcode(), 100.f,
+                                100.f, 1u, 0u});
+    }
+
+    // Make a helix crossing the planes, and a function finding its position
+    // on a plane
+    const vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                    2.f * unit<scalar>::T};
+    const scalar q{-1.f * unit<scalar>::e};
+    const vector3 mom{1.f * unit<scalar>::GeV, 0.1f * unit<scalar>::GeV,
+                      0.2f * unit<scalar>::GeV};
+    detray::detail::helix<traccc::default_algebra> hlx(
+        {0.f, 0.f, 0.f}, 0.f, vector::normalize(mom), q / vector::norm(mom),
+        B);
+    auto helix_at = [&hlx](scalar x) {
+        scalar s_low = 0.f, s_high = 2.f * x;
+        for (unsigned int i = 0u; i < 50u; ++i) {
+            const scalar s = 0.5f * (s_low + s_high);
+            if (hlx(s)[0] < x) {
+                s_low = s;
+            } else {
+                s_high = s;
+            }
+        }
+        return hlx(0.5f * (s_low + s_high));
+    };
+
+    // Measure the helix on the planes. The local 1 measurements on the second
+    // planes are chosen such that the spacepoints would be on the helix.
+    typename measurement_collection_types::host measurements{&host_mr};
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        const scalar x = plane_positions[2u * i];
+        const point3 pos = helix_at(x);
+
+        measurement meas1{
+            {pos[1], 0.f}, {0.01f, 0.f}, surfaces[2u * i].barcode()};
+        meas1.meas_dim = 1u;
+        meas1.subs.set_indices({e_bound_loc0, e_bound_loc0});
+        measurements.push_back(meas1);
+
+        measurement meas2{{0.f, pos[2] * (x + 1.f) / x},
+                          {0.f, 0.01f},
+                          surfaces[2u * i + 1u].barcode()};
+        meas2.meas_dim = 1u;
+        meas2.subs.set_indices({e_bound_loc1, e_bound_loc0});
+        measurements.push_back(meas2);
+    }
+
+    // Run spacepoint formation
+    host::strip_spacepoint_formation_algorithm sp_formation(
+        strip_spacepoint_formation_config{}, host_mr);
+    auto spacepoints = sp_formation(det, vecmem::get_data(module_pairs),
+                                    vecmem::get_data(measurements));
+    ASSERT_EQ(spacepoints.size(), 3u);
+
+    // Estimate the track parameters of a seed made out of the strip
+    // spacepoints
+    edm::seed_collection::host seeds{host_mr};
+    seeds.push_back({0u, 1u, 2u});
+    host::track_params_estimation tp(host_mr);
+    auto bound_params =
+        tp(vecmem::get_data(measurements), vecmem::get_data(spacepoints),
+           vecmem::get_data(seeds), B);
+
+    // The parameters are on the first surface of the bottom spacepoint, at
+    // the position of its first measurement, with the helix's momentum.
+    ASSERT_EQ(bound_params.size(), 1u);
+    const measurement& meas_for_spB =
+        measurements.at(spacepoints.at(0u).measurement_index_1());
+    EXPECT_EQ(bound_params[0].surface_link(), meas_for_spB.surface_link);
+    EXPECT_EQ(getter::element(bound_params[0].vector(), e_bound_loc0, 0),
+              meas_for_spB.local[0]);
+    EXPECT_EQ(getter::element(bound_params[0].vector(), e_bound_loc1, 0),
+              meas_for_spB.local[1]);
+    EXPECT_NEAR(bound_params[0].p(q), vector::norm(mom),
+                0.01f * vector::norm(mom));
+    EXPECT_TRUE(bound_params[0].qop() < 0.f);
+}
@@ -11,6 +11,7 @@
 #include "traccc/edm/spacepoint_collection.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
+#include "traccc/seeding/track_params_estimation_helper.hpp"
 
 // Detray include(s).
 #include <detray/tracks/helix.hpp>
@@ -21,6 +22,9 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <cmath>
+
 using namespace traccc;
 
 namespace {
@@ -125,3 +129,77 @@ TEST(track_params_estimation, helix_positive_charge) {
     ASSERT_NEAR(bound_params[0].p(q), vector::norm(mom), 2.f * 1e-4);
     ASSERT_TRUE(bound_params[0].qop() > 0.f);
 }
+
+TEST(track_params_estimation, batched_parallel) {
+
+    // Set B field
+    const vector3 B{0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                    2.f * unit<scalar>::T};
+
+    // Make seeds out of helices with many different momenta, in multiple
+    // batches.
+    measurement_collection_types::host measurements(&host_mr);
+    edm::spacepoint_collection::host spacepoints{host_mr};
+    edm::seed_collection::host seeds{host_mr};
+    const unsigned int n_seeds = 1000u;
+    for (unsigned int i = 0; i < n_seeds; ++i) {
+        const scalar q = ((i % 2u) == 0u ? -1.f : 1.f) * unit<scalar>::e;
+        const scalar phi = -2.5f + 5.f * static_cast<scalar>(i) / n_seeds;
+        const scalar pt = (0.5f + 0.01f * static_cast<scalar>(i % 300u)) *
+                          unit<scalar>::GeV;
+        const scalar pz =
+            (-1.f + 0.002f * static_cast<scalar>(i)) * unit<scalar>::GeV;
+        const vector3 mom{pt * std::cos(phi), pt * std::sin(phi), pz};
+        detray::detail::helix<traccc::default_algebra> hlx(
+            point3{0.f, 0.f, 0.f}, 0.f, vector::normalize(mom),
+            q / vector::norm(mom), B);
+        for (unsigned int j = 1; j <= 3; ++j) {
+            measurements.push_back({});
+            spacepoints.push_back(
+                {static_cast<unsigned int>(measurements.size() - 1u),
+                 traccc::edm::spacepoint_collection::host::
+                     INVALID_MEASUREMENT_INDEX,
+                 hlx(static_cast<scalar>(j) * 50.f * unit<scalar>::mm), 0.f,
+                 0.f});
+        }
+        seeds.push_back({3u * i, 3u * i + 1u, 3u * i + 2u});
+    }
+
+    // Run the track parameter estimation serially and in parallel.
+    traccc::host::track_params_estimation tp_serial(host_mr);
+    traccc::host::track_params_estimation::config_type parallel_config;
+    parallel_config.parallel = true;
+    traccc::host::track_params_estimation tp_parallel(parallel_config,
+                                                      host_mr);
+    auto serial_params =
+        tp_serial(vecmem::get_data(measurements),
+                  vecmem::get_data(spacepoints), vecmem::get_data(seeds), B);
+    auto parallel_params =
+        tp_parallel(vecmem::get_data(measurements),
+                    vecmem::get_data(spacepoints), vecmem::get_data(seeds), B);
+
+    // The two should be identical, and agree with the scalar helper function.
+    ASSERT_EQ(serial_params.size(), n_seeds);
+    ASSERT_EQ(parallel_params.size(), n_seeds);
+    const measurement_collection_types::const_device measurements_device(
+        vecmem::get_data(measurements));
+    const edm::spacepoint_collection::const_device spacepoints_device(
+        vecmem::get_data(spacepoints));
+    const edm::seed_collection::const_device seeds_device(
+        vecmem::get_data(seeds));
+    for (unsigned int i = 0; i < n_seeds; ++i) {
+        for (std::size_t j = 0; j < e_bound_size; ++j) {
+            EXPECT_EQ(getter::element(serial_params[i].vector(), j, 0),
+                      getter::element(parallel_params[i].vector(), j, 0));
+        }
+        const bound_vector<> expected = seed_to_bound_vector(
+            measurements_device, spacepoints_device, seeds_device[i], B);
+        EXPECT_NEAR(serial_params[i].phi(),
+                    getter::element(expected, e_bound_phi, 0), 1e-4f);
+        EXPECT_NEAR(serial_params[i].theta(),
+                    getter::element(expected, e_bound_theta, 0), 1e-4f);
+        EXPECT_NEAR(serial_params[i].qop(),
+                    getter::element(expected, e_bound_qoverp, 0),
+                    1e-4f * std::abs(serial_params[i].qop()));
+    }
+}
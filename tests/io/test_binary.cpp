@@ -21,8 +21,13 @@
 #include <gtest/gtest.h>
 
 // System
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
+#include <random>
+#include <string>
 
 // This defines the local frame test suite for binary cell container
 TEST(io_binary, cell) {
@@ -80,6 +85,63 @@ TEST(io_binary, cell) {
     }
 }
 
+// This defines the test suite for compressed binary cell files
+TEST(io_binary, compressed_cell) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string cells_directory = "tml_full/ttbar_mu100/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the detector description.
+    traccc::silicon_detector_description::host dd{host_mr};
+    traccc::io::read_detector_description(
+        dd, "tml_detector/trackml-detector.csv",
+        "tml_detector/default-geometric-config-generic.json",
+        traccc::data_format::csv);
+
+    // Read csv file
+    traccc::edm::silicon_cell_collection::host cells_csv(host_mr);
+    traccc::io::read_cells(cells_csv, event, cells_directory,
+                           traccc::getDummyLogger().clone(), &dd,
+                           traccc::data_format::csv);
+
+    // Write compressed binary file
+    traccc::io::write(event, cells_directory,
+                      traccc::data_format::compressed_binary,
+                      vecmem::get_data(cells_csv));
+
+    // Read compressed binary file
+    traccc::edm::silicon_cell_collection::host cells_binary(host_mr);
+    traccc::io::read_cells(cells_binary, event, cells_directory,
+                           traccc::getDummyLogger().clone(), &dd,
+                           traccc::data_format::compressed_binary);
+
+    // Delete compressed binary file
+    std::string io_cells_file =
+        traccc::io::data_directory() + cells_directory +
+        traccc::io::get_event_filename(event, "-cells.cdat");
+    std::remove(io_cells_file.c_str());
+
+    EXPECT_TRUE(!std::ifstream(io_cells_file));
+
+    // Check cells size
+    EXPECT_GT(cells_csv.size(), 0u);
+    EXPECT_EQ(cells_csv.size(), cells_binary.size());
+
+    for (std::size_t i = 0; i < cells_csv.size(); i++) {
+        EXPECT_EQ(cells_csv.channel0().at(i), cells_binary.channel0().at(i));
+        EXPECT_EQ(cells_csv.channel1().at(i), cells_binary.channel1().at(i));
+        EXPECT_EQ(cells_csv.activation().at(i),
+                  cells_binary.activation().at(i));
+        EXPECT_EQ(cells_csv.time().at(i), cells_binary.time().at(i));
+        EXPECT_EQ(cells_csv.module_index().at(i),
+                  cells_binary.module_index().at(i));
+    }
+}
+
 // This defines the local frame test suite for binary spacepoint container
 TEST(io_binary, spacepoint) {
 
@@ -180,3 +242,116 @@ TEST(io_binary, measurement) {
         EXPECT_EQ(measurements_csv[i], measurements_binary[i]);
     }
 }
+
+// This checks that detector descriptions read from a snapshot (on the second
+// read) are identical to the ones read from the original files
+TEST(io_binary, detector_description_snapshot) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Enable the caching, in a directory used only by this test.
+    const std::filesystem::path cache_dir =
+        std::filesystem::temp_directory_path() /
+        ("traccc_test_detector_snapshot_" +
+         std::to_string(std::random_device{}()));
+    std::filesystem::remove_all(cache_dir);
+    ASSERT_EQ(setenv("TRACCC_DETECTOR_CACHE_DIR", cache_dir.c_str(), 1), 0);
+
+    // Read the detector description twice, the second time from the
+    // snapshot made by the first read.
+    traccc::silicon_detector_description::host dd1{host_mr}, dd2{host_mr};
+    for (traccc::silicon_detector_description::host* dd : {&dd1, &dd2}) {
+        traccc::io::read_detector_description(
+            *dd, "tml_detector/trackml-detector.csv",
+            "tml_detector/default-geometric-config-generic.json",
+            traccc::data_format::csv);
+        EXPECT_FALSE(std::filesystem::is_empty(cache_dir));
+    }
+
+    // Disable the caching again.
+    unsetenv("TRACCC_DETECTOR_CACHE_DIR");
+    std::filesystem::remove_all(cache_dir);
+
+    // Compare the two.
+    ASSERT_GT(dd1.size(), 0u);
+    ASSERT_EQ(dd1.size(), dd2.size());
+    for (std::size_t i = 0; i < dd1.size(); ++i) {
+        EXPECT_EQ(dd1.geometry_id().at(i), dd2.geometry_id().at(i));
+        EXPECT_EQ(dd1.acts_geometry_id().at(i), dd2.acts_geometry_id().at(i));
+        EXPECT_EQ(dd1.threshold().at(i), dd2.threshold().at(i));
+        EXPECT_EQ(dd1.reference_x().at(i), dd2.reference_x().at(i));
+        EXPECT_EQ(dd1.reference_y().at(i), dd2.reference_y().at(i));
+        EXPECT_EQ(dd1.pitch_x().at(i), dd2.pitch_x().at(i));
+        EXPECT_EQ(dd1.pitch_y().at(i), dd2.pitch_y().at(i));
+        EXPECT_EQ(dd1.dimensions().at(i), dd2.dimensions().at(i));
+    }
+}
+
+// This checks that snapshots made for a different version of the detector
+// description's schema are ignored, and replaced by up to date ones
+TEST(io_binary, detector_description_snapshot_version) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Enable the caching, in a directory used only by this test.
+    const std::filesystem::path cache_dir =
+        std::filesystem::temp_directory_path() /
+        ("traccc_test_detector_snapshot_version_" +
+         std::to_string(std::random_device{}()));
+    std::filesystem::remove_all(cache_dir);
+    ASSERT_EQ(setenv("TRACCC_DETECTOR_CACHE_DIR", cache_dir.c_str(), 1), 0);
+
+    auto read_dd = [](traccc::silicon_detector_description::host& dd) {
+        traccc::io::read_detector_description(
+            dd, "tml_detector/trackml-detector.csv",
+            "tml_detector/default-geometric-config-generic.json",
+            traccc::data_format::csv);
+    };
+
+    // Make the snapshot.
+    traccc::silicon_detector_description::host dd1{host_mr};
+    read_dd(dd1);
+    ASSERT_FALSE(std::filesystem::is_empty(cache_dir));
+    const std::filesystem::path snapshot =
+        std::filesystem::directory_iterator{cache_dir}->path();
+
+    // Change the schema version recorded in the snapshot's header. (It is
+    // stored after the file magic, file version, array count, element count
+    // and content magic.)
+    constexpr std::streamoff version_offset = 32;
+    auto snapshot_version = [&snapshot]() {
+        std::ifstream file(snapshot, std::ios::binary);
+        file.seekg(version_offset);
+        std::uint32_t version = 0u;
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        return version;
+    };
+    const std::uint32_t version = snapshot_version();
+    {
+        std::fstream file(snapshot,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(version_offset);
+        const std::uint32_t other_version = version + 1u;
+        file.write(reinterpret_cast<const char*>(&other_version),
+                   sizeof(other_version));
+    }
+
+    // Read the detector description again. It must come from the original
+    // files, and must replace the snapshot.
+    traccc::silicon_detector_description::host dd2{host_mr};
+    read_dd(dd2);
+    EXPECT_EQ(snapshot_version(), version);
+
+    // Disable the caching again.
+    unsetenv("TRACCC_DETECTOR_CACHE_DIR");
+    std::filesystem::remove_all(cache_dir);
+
+    // Compare the two.
+    ASSERT_GT(dd1.size(), 0u);
+    ASSERT_EQ(dd1.size(), dd2.size());
+    for (std::size_t i = 0; i < dd1.size(); ++i) {
+        EXPECT_EQ(dd1.geometry_id().at(i), dd2.geometry_id().at(i));
+        EXPECT_EQ(dd1.pitch_x().at(i), dd2.pitch_x().at(i));
+        EXPECT_EQ(dd1.pitch_y().at(i), dd2.pitch_y().at(i));
+    }
+}
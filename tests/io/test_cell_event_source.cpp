@@ -0,0 +1,72 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/cell_event_source.hpp"
+#include "traccc/io/read_cells.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// This checks that all events of the schedule are served, with the same
+// contents as when reading them directly
+TEST(io_cell_event_source, mock_data) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Read the reference event directly.
+    traccc::edm::silicon_cell_collection::host reference{host_mr};
+    traccc::io::read_cells(reference, 0u, TRACCC_TEST_IO_MOCK_DATA_DIR);
+
+    // Set up a source with fewer buffers than events, so that the buffers
+    // would need to be recycled.
+    traccc::io::cell_event_source::config cfg;
+    cfg.directory = TRACCC_TEST_IO_MOCK_DATA_DIR;
+    cfg.n_buffers = 2u;
+    cfg.n_readers = 2u;
+    static constexpr std::size_t n_events = 10u;
+    traccc::io::cell_event_source source{
+        cfg, std::vector<std::size_t>(n_events, 0u), nullptr, host_mr};
+
+    // Consume all events.
+    std::size_t n_served = 0u;
+    while (std::optional<traccc::io::cell_event_source::event> event =
+               source.next()) {
+        ++n_served;
+        EXPECT_EQ(event->index(), 0u);
+        const traccc::edm::silicon_cell_collection::host& cells =
+            event->cells();
+        ASSERT_EQ(cells.size(), reference.size());
+        for (std::size_t i = 0; i < cells.size(); ++i) {
+            EXPECT_EQ(cells.channel0().at(i), reference.channel0().at(i));
+            EXPECT_EQ(cells.channel1().at(i), reference.channel1().at(i));
+            EXPECT_EQ(cells.activation().at(i), reference.activation().at(i));
+        }
+    }
+    EXPECT_EQ(n_served, n_events);
+}
+
+// This checks that reading errors reach the consumers
+TEST(io_cell_event_source, missing_file) {
+
+    vecmem::host_memory_resource host_mr;
+
+    traccc::io::cell_event_source::config cfg;
+    cfg.directory = TRACCC_TEST_IO_MOCK_DATA_DIR;
+    traccc::io::cell_event_source source{cfg, {123456u}, nullptr, host_mr};
+
+    EXPECT_THROW(source.next(), std::exception);
+}
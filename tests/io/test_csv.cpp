@@ -28,6 +28,7 @@
 
 // System include(s).
 #include <filesystem>
+#include <string>
 
 class io : public traccc::tests::data_test {};
 
@@ -77,6 +78,76 @@ TEST_F(io, csv_read_two_modules) {
     EXPECT_EQ(cells.channel1().at(13), 98u);
 }
 
+// This checks the deduplication of cells
+TEST_F(io, csv_read_duplicate_cells) {
+
+    vecmem::host_memory_resource resource;
+
+    const std::string filename = std::string{TRACCC_TEST_IO_MOCK_DATA_DIR} +
+                                 "/event000000000-cells.csv";
+
+    // Read the cells without deduplication.
+    traccc::edm::silicon_cell_collection::host all_cells{resource};
+    traccc::io::read_cells(all_cells, filename,
+                           traccc::getDummyLogger().clone(), nullptr,
+                           traccc::data_format::csv, false);
+    ASSERT_EQ(all_cells.size(), 10u);
+
+    // Read them with deduplication.
+    traccc::edm::silicon_cell_collection::host cells{resource};
+    traccc::io::read_cells(cells, filename, traccc::getDummyLogger().clone(),
+                           nullptr, traccc::data_format::csv, true);
+    ASSERT_EQ(cells.size(), 9u);
+
+    // Check that the cells are sorted, and that the activation of the
+    // duplicate cell got summed up.
+    for (std::size_t i = 1; i < cells.size(); ++i) {
+        EXPECT_TRUE((cells.channel1().at(i - 1) < cells.channel1().at(i)) ||
+                    ((cells.channel1().at(i - 1) == cells.channel1().at(i)) &&
+                     (cells.channel0().at(i - 1) < cells.channel0().at(i))));
+    }
+    EXPECT_EQ(cells.channel0().at(2), 1u);
+    EXPECT_EQ(cells.channel1().at(2), 1u);
+    EXPECT_FLOAT_EQ(static_cast<float>(cells.activation().at(2)),
+                    0.00868905429f + 0.00886478275f);
+}
+
+// This checks that cells are assigned to the current modules of a detector
+// description, even if its geometry IDs change between reads
+TEST_F(io, csv_read_cells_updated_detector_description) {
+
+    vecmem::host_memory_resource resource;
+
+    const std::string filename = std::string{TRACCC_TEST_IO_MOCK_DATA_DIR} +
+                                 "/event000000000-cells.csv";
+    static constexpr traccc::geometry_id module_id = 1224979236083738112ul;
+
+    // Describe a detector with the cells' module at the second position.
+    traccc::silicon_detector_description::host dd{resource};
+    dd.resize(2u);
+    dd.acts_geometry_id().at(0) = module_id + 1u;
+    dd.acts_geometry_id().at(1) = module_id;
+
+    traccc::edm::silicon_cell_collection::host cells{resource};
+    traccc::io::read_cells(cells, filename, traccc::getDummyLogger().clone(),
+                           &dd);
+    ASSERT_GT(cells.size(), 0u);
+    for (unsigned int i = 0; i < cells.size(); ++i) {
+        EXPECT_EQ(cells.module_index().at(i), 1u);
+    }
+
+    // Move the module to the first position, in place.
+    dd.acts_geometry_id().at(0) = module_id;
+    dd.acts_geometry_id().at(1) = module_id + 1u;
+
+    traccc::io::read_cells(cells, filename, traccc::getDummyLogger().clone(),
+                           &dd);
+    ASSERT_GT(cells.size(), 0u);
+    for (unsigned int i = 0; i < cells.size(); ++i) {
+        EXPECT_EQ(cells.module_index().at(i), 0u);
+    }
+}
+
 // This reads in the tml pixel barrel first event
 TEST_F(io, csv_read_tml_transforms) {
     std::string file = get_datafile("tml_detector/trackml-detector.csv");
@@ -0,0 +1,190 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/event_archive.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_particles.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// This checks that events written into an archive can be read back through
+// the usual per-event reading functions
+TEST(io_event_archive, mock_data) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Read the reference data.
+    traccc::edm::silicon_cell_collection::host cells{host_mr};
+    traccc::io::read_cells(cells, 0u, TRACCC_TEST_IO_MOCK_DATA_DIR);
+    traccc::edm::spacepoint_collection::host spacepoints{host_mr};
+    traccc::measurement_collection_types::host measurements{&host_mr};
+    traccc::io::read_spacepoints(spacepoints, measurements, 0u,
+                                 TRACCC_TEST_IO_MOCK_DATA_DIR);
+    traccc::particle_collection_types::host particles{&host_mr};
+    traccc::io::read_particles(particles, 0u, TRACCC_TEST_IO_MOCK_DATA_DIR);
+
+    // Write the data as two different events into an archive.
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "traccc_test_event_archive";
+    std::filesystem::create_directories(directory);
+    {
+        traccc::io::event_archive_writer writer{
+            (directory / traccc::io::event_archive_filename).native()};
+        for (std::size_t event : {3u, 7u}) {
+            writer.write(event, vecmem::get_data(cells));
+            writer.write(event, vecmem::get_data(spacepoints),
+                         vecmem::get_data(measurements));
+            writer.write(event, vecmem::get_data(particles));
+        }
+    }
+
+    // Read back the second event.
+    traccc::edm::silicon_cell_collection::host cells_read{host_mr};
+    traccc::io::read_cells(cells_read, 7u, directory.native(),
+                           traccc::getDummyLogger().clone(), nullptr,
+                           traccc::data_format::archive);
+    traccc::edm::spacepoint_collection::host spacepoints_read{host_mr};
+    traccc::measurement_collection_types::host measurements_read{&host_mr};
+    traccc::io::read_spacepoints(spacepoints_read, measurements_read, 7u,
+                                 directory.native(), nullptr,
+                                 traccc::data_format::archive);
+    traccc::particle_collection_types::host particles_read{&host_mr};
+    traccc::io::read_particles(particles_read, 7u, directory.native(),
+                               traccc::data_format::archive);
+
+    // Check the results.
+    ASSERT_EQ(cells_read.size(), cells.size());
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        EXPECT_EQ(cells_read.channel0().at(i), cells.channel0().at(i));
+        EXPECT_EQ(cells_read.channel1().at(i), cells.channel1().at(i));
+        EXPECT_EQ(cells_read.activation().at(i), cells.activation().at(i));
+        EXPECT_EQ(cells_read.module_index().at(i),
+                  cells.module_index().at(i));
+    }
+    ASSERT_EQ(spacepoints_read.size(), spacepoints.size());
+    for (std::size_t i = 0; i < spacepoints.size(); ++i) {
+        EXPECT_EQ(spacepoints_read.measurement_index_1().at(i),
+                  spacepoints.measurement_index_1().at(i));
+        for (unsigned int j = 0; j < 3u; ++j) {
+            EXPECT_EQ(spacepoints_read.global().at(i)[j],
+                      spacepoints.global().at(i)[j]);
+        }
+    }
+    ASSERT_EQ(measurements_read.size(), measurements.size());
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+        EXPECT_EQ(measurements_read[i], measurements[i]);
+    }
+    ASSERT_EQ(particles_read.size(), particles.size());
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+        EXPECT_EQ(particles_read[i].particle_id, particles[i].particle_id);
+        EXPECT_EQ(particles_read[i].particle_type,
+                  particles[i].particle_type);
+    }
+
+    // Check the index of the archive.
+    const auto archive = traccc::io::event_archive_reader::open(
+        (directory / traccc::io::event_archive_filename).native());
+    EXPECT_EQ(archive->events(), (std::vector<std::size_t>{3u, 7u}));
+    EXPECT_TRUE(
+        archive->contains(3u, traccc::io::event_archive_section::particles));
+    EXPECT_FALSE(
+        archive->contains(5u, traccc::io::event_archive_section::cells));
+    EXPECT_THROW(archive->read(5u, cells_read), std::runtime_error);
+
+    std::filesystem::remove_all(directory);
+}
+
+// This checks that unsorted measurements are sorted when read from an
+// archive, with the spacepoints following them
+TEST(io_event_archive, unsorted_measurements) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Make measurements in reverse module order, with one spacepoint per
+    // measurement.
+    traccc::measurement_collection_types::host measurements{&host_mr};
+    traccc::edm::spacepoint_collection::host spacepoints{host_mr};
+    std::vector<traccc::io::csv::measurement_hit_id> measurement_hits;
+    for (unsigned int i = 0u; i < 5u; ++i) {
+        traccc::measurement meas{};
+        meas.local = {static_cast<float>(i), 0.f};
+        meas.surface_link =
+            detray::geometry::barcode{}.set_volume(0u).set_index(4u - i);
+        measurements.push_back(meas);
+        spacepoints.push_back(
+            {i,
+             traccc::edm::spacepoint_collection::host::
+                 INVALID_MEASUREMENT_INDEX,
+             {static_cast<float>(i), 0.f, 0.f},
+             0.f,
+             0.f});
+        traccc::io::csv::measurement_hit_id measurement_hit;
+        measurement_hit.measurement_id = i;
+        measurement_hit.hit_id = i;
+        measurement_hits.push_back(measurement_hit);
+    }
+
+    // Write them into an archive.
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() /
+        "traccc_test_event_archive_unsorted";
+    std::filesystem::create_directories(directory);
+    {
+        traccc::io::event_archive_writer writer{
+            (directory / traccc::io::event_archive_filename).native()};
+        writer.write(0u, vecmem::get_data(spacepoints),
+                     vecmem::get_data(measurements));
+        writer.write(0u, measurement_hits);
+    }
+
+    // Read them back.
+    traccc::edm::spacepoint_collection::host spacepoints_read{host_mr};
+    traccc::measurement_collection_types::host measurements_read{&host_mr};
+    traccc::io::read_spacepoints(spacepoints_read, measurements_read, 0u,
+                                 directory.native(), nullptr,
+                                 traccc::data_format::archive);
+
+    // The measurements must be sorted, and the spacepoints must still point
+    // at their own measurements.
+    ASSERT_EQ(measurements_read.size(), measurements.size());
+    EXPECT_TRUE(std::is_sorted(measurements_read.begin(),
+                               measurements_read.end(),
+                               traccc::measurement_sort_comp{}));
+    ASSERT_EQ(spacepoints_read.size(), spacepoints.size());
+    for (std::size_t i = 0; i < spacepoints.size(); ++i) {
+        EXPECT_EQ(
+            measurements_read.at(spacepoints_read.measurement_index_1().at(i)),
+            measurements.at(i));
+    }
+
+    // The measurement to hit map must be stored as it was written.
+    const auto archive = traccc::io::event_archive_reader::open(
+        (directory / traccc::io::event_archive_filename).native());
+    std::vector<traccc::io::csv::measurement_hit_id> measurement_hits_read;
+    archive->read(0u, measurement_hits_read);
+    ASSERT_EQ(measurement_hits_read.size(), measurement_hits.size());
+    for (std::size_t i = 0; i < measurement_hits.size(); ++i) {
+        EXPECT_EQ(measurement_hits_read[i].measurement_id,
+                  measurement_hits[i].measurement_id);
+        EXPECT_EQ(measurement_hits_read[i].hit_id, measurement_hits[i].hit_id);
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -24,6 +24,14 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+
 TEST(event_data, acts_odd) {
 
     /// Type declarations
@@ -223,3 +231,88 @@ TEST(event_data, mock_data) {
     EXPECT_EQ(has_first_param, true);
     EXPECT_EQ(has_second_param, true);
 }
+
+TEST(event_data, truth_cache) {
+
+    /// Type declarations
+    using host_detector_type = traccc::default_detector::host;
+
+    vecmem::host_memory_resource resource;
+
+    // Work on a copy of the mock data, in a directory used only by this test,
+    // so that the cache file would not be written into the source directory.
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() /
+        ("traccc_test_truth_cache_" + std::to_string(std::random_device{}()));
+    std::filesystem::remove_all(path);
+    std::filesystem::copy(TRACCC_TEST_IO_MOCK_DATA_DIR, path);
+
+    // Read detector file
+    const std::string det_file =
+        "geometries/odd/odd-detray_geometry_detray.json";
+    detray::io::detector_reader_config reader_cfg{};
+    reader_cfg.add_file(traccc::io::data_directory() + det_file);
+
+    auto [host_det, names] =
+        detray::io::read_detector<host_detector_type>(resource, reader_cfg);
+
+    // Read the event from the CSV files, which should create the cache.
+    traccc::event_data csv_data(path.native(), 0u, resource, true, &host_det,
+                                traccc::data_format::csv, true, true);
+    ASSERT_TRUE(std::filesystem::exists(
+        path / traccc::io::get_event_filename(0u, "-truth.cache")));
+
+    // Zero out all values in the CSV files, while keeping their sizes and
+    // modification times, so that the cache would still be considered up to
+    // date, but the CSV files would no longer provide the same information.
+    for (const auto& entry : std::filesystem::directory_iterator{path}) {
+        if (entry.path().extension() != ".csv") {
+            continue;
+        }
+        const std::filesystem::file_time_type time =
+            std::filesystem::last_write_time(entry.path());
+        std::string content;
+        {
+            std::ifstream file(entry.path(), std::ios::binary);
+            content.assign(std::istreambuf_iterator<char>{file},
+                           std::istreambuf_iterator<char>{});
+        }
+        for (std::size_t i = content.find('\n'); i < content.size(); ++i) {
+            if ((content[i] != ',') && (content[i] != '\n')) {
+                content[i] = '0';
+            }
+        }
+        {
+            std::ofstream file(entry.path(),
+                               std::ios::binary | std::ios::trunc);
+            file.write(content.data(),
+                       static_cast<std::streamsize>(content.size()));
+        }
+        std::filesystem::last_write_time(entry.path(), time);
+    }
+
+    // Read the event again. This can only reproduce the original truth
+    // information if it comes from the cache.
+    traccc::event_data cached_data(path.native(), 0u, resource, true,
+                                   &host_det, traccc::data_format::csv, true,
+                                   true);
+
+    // Compare the two.
+    EXPECT_EQ(cached_data.m_measurement_map, csv_data.m_measurement_map);
+    EXPECT_EQ(cached_data.m_particle_map.size(),
+              csv_data.m_particle_map.size());
+    EXPECT_EQ(cached_data.m_cell_to_particle_map.size(),
+              csv_data.m_cell_to_particle_map.size());
+    ASSERT_EQ(cached_data.m_meas_to_ptc_map.size(),
+              csv_data.m_meas_to_ptc_map.size());
+    for (auto const& [meas, ptcs] : csv_data.m_meas_to_ptc_map) {
+        ASSERT_EQ(cached_data.m_meas_to_ptc_map.count(meas), 1u);
+        const auto& cached_ptcs = cached_data.m_meas_to_ptc_map.at(meas);
+        ASSERT_EQ(cached_ptcs.size(), ptcs.size());
+        for (auto const& [ptc, count] : ptcs) {
+            EXPECT_EQ(cached_ptcs.at(ptc), count);
+        }
+    }
+
+    std::filesystem::remove_all(path);
+}
@@ -0,0 +1,160 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2025 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/geometry/silicon_detector_description.hpp"
+#include "traccc/io/map_data.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_detector_description.hpp"
+#include "traccc/io/read_spacepoints.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/io/write.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+// This defines the test suite for memory mapped cell files
+TEST(io_mmap, cell) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string cells_directory = "tml_full/ttbar_mu100/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read the detector description.
+    traccc::silicon_detector_description::host dd{host_mr};
+    traccc::io::read_detector_description(
+        dd, "tml_detector/trackml-detector.csv",
+        "tml_detector/default-geometric-config-generic.json",
+        traccc::data_format::csv);
+
+    // Read csv file
+    traccc::edm::silicon_cell_collection::host cells_csv(host_mr);
+    traccc::io::read_cells(cells_csv, event, cells_directory,
+                           traccc::getDummyLogger().clone(), &dd,
+                           traccc::data_format::csv);
+
+    // Write mmap file
+    traccc::io::write(event, cells_directory, traccc::data_format::mmap,
+                      vecmem::get_data(cells_csv));
+
+    // Read the mmap file, and map it as well.
+    traccc::edm::silicon_cell_collection::host cells_read(host_mr);
+    traccc::io::read_cells(cells_read, event, cells_directory,
+                           traccc::getDummyLogger().clone(), &dd,
+                           traccc::data_format::mmap);
+    const traccc::io::mapped_cells cells_mapped =
+        traccc::io::map_cells(event, cells_directory);
+    const traccc::edm::silicon_cell_collection::const_device cells_device{
+        cells_mapped.view};
+
+    // Check the results
+    EXPECT_GT(cells_csv.size(), 0u);
+    EXPECT_EQ(cells_csv.size(), cells_read.size());
+    EXPECT_EQ(cells_csv.size(), cells_device.size());
+
+    for (std::size_t i = 0; i < cells_csv.size(); i++) {
+        EXPECT_EQ(cells_csv.channel0().at(i), cells_read.channel0().at(i));
+        EXPECT_EQ(cells_csv.module_index().at(i),
+                  cells_read.module_index().at(i));
+        EXPECT_EQ(cells_csv.channel0().at(i), cells_device.channel0().at(i));
+        EXPECT_EQ(cells_csv.channel1().at(i), cells_device.channel1().at(i));
+        EXPECT_EQ(cells_csv.activation().at(i),
+                  cells_device.activation().at(i));
+        EXPECT_EQ(cells_csv.time().at(i), cells_device.time().at(i));
+        EXPECT_EQ(cells_csv.module_index().at(i),
+                  cells_device.module_index().at(i));
+    }
+
+    // Delete mmap file
+    std::string io_cells_file =
+        traccc::io::data_directory() + cells_directory +
+        traccc::io::get_event_filename(event, "-cells.mmap");
+    std::remove(io_cells_file.c_str());
+
+    EXPECT_TRUE(!std::ifstream(io_cells_file));
+}
+
+// This defines the test suite for memory mapped spacepoint and measurement
+// files
+TEST(io_mmap, spacepoint) {
+
+    // Set event configuration
+    const std::size_t event = 0;
+    const std::string hits_directory = "tml_full/ttbar_mu200/";
+
+    // Memory resource used by the EDM.
+    vecmem::host_memory_resource host_mr;
+
+    // Read csv file
+    traccc::measurement_collection_types::host measurements_csv(&host_mr);
+    traccc::edm::spacepoint_collection::host spacepoints_csv(host_mr);
+    traccc::io::read_spacepoints(spacepoints_csv, measurements_csv, event,
+                                 hits_directory);
+
+    // Write mmap files
+    traccc::io::write(event, hits_directory, traccc::data_format::mmap,
+                      vecmem::get_data(spacepoints_csv),
+                      vecmem::get_data(measurements_csv));
+
+    // Map the files
+    const traccc::io::mapped_spacepoints spacepoints_mapped =
+        traccc::io::map_spacepoints(event, hits_directory);
+    const traccc::io::mapped_measurements measurements_mapped =
+        traccc::io::map_measurements(event, hits_directory);
+    const traccc::edm::spacepoint_collection::const_device spacepoints_device{
+        spacepoints_mapped.view};
+    const traccc::measurement_collection_types::const_device
+        measurements_device{measurements_mapped.view};
+
+    // Check the results
+    EXPECT_GT(spacepoints_csv.size(), 0u);
+    EXPECT_EQ(spacepoints_csv.size(), spacepoints_device.size());
+    for (std::size_t i = 0; i < spacepoints_csv.size(); i++) {
+        EXPECT_EQ(spacepoints_csv.measurement_index_1().at(i),
+                  spacepoints_device.measurement_index_1().at(i));
+        EXPECT_EQ(spacepoints_csv.measurement_index_2().at(i),
+                  spacepoints_device.measurement_index_2().at(i));
+        for (unsigned int j = 0; j < 3u; ++j) {
+            EXPECT_EQ(spacepoints_csv.global().at(i)[j],
+                      spacepoints_device.global().at(i)[j]);
+        }
+        EXPECT_EQ(spacepoints_csv.z_variance().at(i),
+                  spacepoints_device.z_variance().at(i));
+        EXPECT_EQ(spacepoints_csv.radius_variance().at(i),
+                  spacepoints_device.radius_variance().at(i));
+    }
+    EXPECT_GT(measurements_csv.size(), 0u);
+    EXPECT_EQ(measurements_csv.size(), measurements_device.size());
+    for (std::size_t i = 0; i < measurements_csv.size(); i++) {
+        EXPECT_EQ(measurements_csv[i], measurements_device[i]);
+    }
+
+    // Delete mmap files
+    for (const char* suffix : {"-hits.mmap", "-measurements.mmap"}) {
+        std::string io_file = traccc::io::data_directory() + hits_directory +
+                              traccc::io::get_event_filename(event, suffix);
+        std::remove(io_file.c_str());
+        EXPECT_TRUE(!std::ifstream(io_file));
+    }
+
+    // Files in other formats are rejected
+    EXPECT_THROW(traccc::io::map_cells(
+                     traccc::io::data_directory() + hits_directory +
+                     traccc::io::get_event_filename(event, "-hits.csv")),
+                 std::runtime_error);
+}